@@ -380,6 +380,63 @@ function(mygui_unit_test PROJECTNAME)
 endfunction(mygui_unit_test)
 
 
+#setup console tests and benchmarks, they run without render window
+function(mygui_console_app PROJECTNAME SOLUTIONFOLDER)
+	include_directories(
+		.
+		${MYGUI_SOURCE_DIR}/UnitTests/Common
+		${MYGUI_SOURCE_DIR}/Common
+		${MYGUI_SOURCE_DIR}/MyGUIEngine/include
+	)
+	# define the sources
+	include(${PROJECTNAME}.list)
+
+	if (MSVC)
+		# disable: "no suitable definition provided for explicit template instantiation request"
+		# Occurs for no justifiable reason on all #includes of Singleton
+		add_definitions(/wd4661)
+		add_definitions(/wd4819)
+		add_definitions(/wd4275)
+	endif ()
+
+	# benchmarks read real resources from Media folder of sources
+	add_definitions("-DMYGUI_MEDIA_FOLDER=\"${MYGUI_SOURCE_DIR}/Media\"")
+
+	# Dummy platform gives headless Gui, other platforms need a window
+	if(MYGUI_RENDERSYSTEM EQUAL 1 OR MYGUI_BUILD_HEADLESS_TESTS)
+		add_definitions("-DMYGUI_DUMMY_PLATFORM")
+		include_directories(
+			${MYGUI_SOURCE_DIR}/Platforms/Dummy/DummyPlatform/include
+		)
+	endif()
+
+	add_executable(${PROJECTNAME} ${HEADER_FILES} ${SOURCE_FILES})
+	set_target_properties(${PROJECTNAME} PROPERTIES FOLDER ${SOLUTIONFOLDER})
+
+	add_dependencies(${PROJECTNAME} MyGUIEngine)
+
+	mygui_config_common(${PROJECTNAME})
+
+	if(MYGUI_RENDERSYSTEM EQUAL 1 OR MYGUI_BUILD_HEADLESS_TESTS)
+		add_dependencies(${PROJECTNAME} MyGUI.DummyPlatform)
+		target_link_libraries(${PROJECTNAME} MyGUI.DummyPlatform)
+	endif()
+	target_link_libraries(${PROJECTNAME}
+		MyGUIEngine
+	)
+endfunction(mygui_console_app)
+
+
+function(mygui_console_test PROJECTNAME)
+	mygui_console_app(${PROJECTNAME} UnitTest)
+endfunction(mygui_console_test)
+
+
+function(mygui_benchmark PROJECTNAME)
+	mygui_console_app(${PROJECTNAME} Benchmark)
+endfunction(mygui_benchmark)
+
+
 function(mygui_tool_dll PROJECTNAME)
 	mygui_dll(${PROJECTNAME} Tools)
 	if (MYGUI_INSTALL_TOOLS)
@@ -532,11 +532,37 @@ namespace base
 
 	void* BaseManager::loadImage(int& _width, int& _height, MyGUI::PixelFormat& _format, const std::string& _filename)
 	{
-		std::string fullname = MyGUI::OpenGLDataManager::getInstance().getDataPath(_filename);
-
 		void* result = 0;
 
-		Gdiplus::Bitmap* image = Gdiplus::Bitmap::FromFile(MyGUI::UString(fullname).asWStr_c_str());
+		// read through data manager, so images from packs are found too
+		MyGUI::IDataStream* data = MyGUI::OpenGLDataManager::getInstance().getData(_filename);
+		if (data == nullptr)
+			return result;
+
+		size_t size = data->size();
+		HGLOBAL global = ::GlobalAlloc(GMEM_MOVEABLE, size);
+		if (global != nullptr && size != 0)
+		{
+			void* memory = ::GlobalLock(global);
+			const unsigned char* source = data->data();
+			if (source != nullptr)
+				memcpy(memory, source, size);
+			else
+				size = data->read(memory, size);
+			::GlobalUnlock(global);
+		}
+		MyGUI::OpenGLDataManager::getInstance().freeData(data);
+
+		// stream owns global memory and releases it
+		IStream* stream = nullptr;
+		if (global == nullptr || FAILED(::CreateStreamOnHGlobal(global, TRUE, &stream)))
+		{
+			if (global != nullptr)
+				::GlobalFree(global);
+			return result;
+		}
+
+		Gdiplus::Bitmap* image = Gdiplus::Bitmap::FromStream(stream);
 		if (image)
 		{
 			_width = image->GetWidth();
@@ -567,6 +593,8 @@ namespace base
 			delete image;
 		}
 
+		stream->Release();
+
 		return result;
 	}
 
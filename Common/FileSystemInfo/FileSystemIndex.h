@@ -0,0 +1,250 @@
+/*!
+	@file
+	@date		10/2026
+	@module
+*/
+#ifndef __FILE_SYSTEM_INDEX_H__
+#define __FILE_SYSTEM_INDEX_H__
+
+#include "FileSystemInfo/FileSystemInfo.h"
+#include <cwctype>
+#include <map>
+
+namespace common
+{
+
+	/** Index of files inside a set of resource locations.
+		Locations are scanned once, lookups by name are done through the map.
+		Results are the same as calling scanFolder for every location in order.
+		The index is rebuilt lazily after invalidate() or addLocation(), so even find() changes the index.
+		Class is not thread safe, data managers lock their mutex around every call.
+	*/
+	class FileSystemIndex
+	{
+	public:
+		FileSystemIndex() :
+			mValid(false)
+		{
+		}
+
+		void addLocation(const std::wstring& _folder, bool _recursive)
+		{
+			Location location;
+			location.folder = _folder;
+			if (!location.folder.empty() && *location.folder.rbegin() != '/' && *location.folder.rbegin() != '\\')
+				location.folder += L"/";
+			location.recursive = _recursive;
+			mLocations.push_back(location);
+
+			invalidate();
+		}
+
+		/** Mark index as outdated, it will be rebuilt on next lookup. Call it when files were added or removed on disk. */
+		void invalidate()
+		{
+			mValid = false;
+		}
+
+		bool isValid() const
+		{
+			return mValid;
+		}
+
+		/** Scan all locations now instead of at first lookup. */
+		void rebuild()
+		{
+			mEntries.clear();
+			mNames.clear();
+
+			for (size_t index = 0; index < mLocations.size(); ++index)
+				scanLocation(index, mLocations[index].folder, std::wstring());
+
+			mValid = true;
+		}
+
+		/** Find files matching _pattern in all locations.
+			@param _pattern File name, may contain directory part and '*' or '?' in file part.
+			@param _fullpath Return full path or name relative to the folder where file was found.
+		*/
+		void find(VectorWString& _result, const std::wstring& _pattern, bool _fullpath)
+		{
+			if (!mValid)
+				rebuild();
+
+			std::wstring directory;
+			std::wstring mask = _pattern;
+			size_t pos = _pattern.find_last_of(L"/\\");
+			if (pos != _pattern.npos)
+			{
+				directory = _pattern.substr(0, pos);
+				mask = _pattern.substr(pos + 1);
+			}
+
+			std::wstring directoryKey = normalise(directory);
+			std::wstring maskKey = normalise(mask);
+
+			if (maskKey.find_first_of(L"*?") == maskKey.npos)
+			{
+				MapIndices::const_iterator item = mNames.find(maskKey);
+				if (item == mNames.end())
+					return;
+
+				const VectorIndices& indices = item->second;
+				for (VectorIndices::const_iterator index = indices.begin(); index != indices.end(); ++index)
+					addResult(_result, mEntries[*index], directory, directoryKey, _fullpath);
+			}
+			else
+			{
+				bool any = maskKey == L"*" || maskKey == L"*.*";
+				for (VectorEntry::const_iterator entry = mEntries.begin(); entry != mEntries.end(); ++entry)
+				{
+					if (any || matchMask(entry->nameKey.c_str(), maskKey.c_str()))
+						addResult(_result, *entry, directory, directoryKey, _fullpath);
+				}
+			}
+		}
+
+		size_t getFilesCount()
+		{
+			if (!mValid)
+				rebuild();
+			return mEntries.size();
+		}
+
+	private:
+		struct Location
+		{
+			std::wstring folder;
+			bool recursive;
+		};
+		typedef std::vector<Location> VectorLocation;
+
+		struct Entry
+		{
+			size_t location;
+			std::wstring name;
+			std::wstring nameKey;
+			std::wstring directoryKey;
+			std::wstring fullpath;
+		};
+		typedef std::vector<Entry> VectorEntry;
+		typedef std::vector<size_t> VectorIndices;
+		typedef std::map<std::wstring, VectorIndices> MapIndices;
+
+		static std::wstring normalise(const std::wstring& _value)
+		{
+			std::wstring result = _value;
+			for (std::wstring::iterator symbol = result.begin(); symbol != result.end(); ++symbol)
+			{
+				if (*symbol == '\\')
+					*symbol = '/';
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+				else
+					*symbol = (wchar_t)towlower(*symbol);
+#endif
+			}
+			return result;
+		}
+
+		static bool matchMask(const wchar_t* _name, const wchar_t* _mask)
+		{
+			const wchar_t* star = 0;
+			const wchar_t* retry = 0;
+			while (*_name != 0)
+			{
+				if (*_mask == '*')
+				{
+					star = ++_mask;
+					retry = _name;
+				}
+				else if (*_mask == '?' || *_mask == *_name)
+				{
+					++_mask;
+					++_name;
+				}
+				else if (star != 0)
+				{
+					_mask = star;
+					_name = ++retry;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			while (*_mask == '*')
+				++_mask;
+			return *_mask == 0;
+		}
+
+		void scanLocation(size_t _location, const std::wstring& _folder, const std::wstring& _directoryKey)
+		{
+			VectorFileInfo result;
+			getSystemFileList(result, _folder, L"*");
+
+			for (VectorFileInfo::const_iterator item = result.begin(); item != result.end(); ++item)
+			{
+				if (item->folder)
+					continue;
+
+				Entry entry;
+				entry.location = _location;
+				entry.name = item->name;
+				entry.nameKey = normalise(item->name);
+				entry.directoryKey = _directoryKey;
+				entry.fullpath = _folder + item->name;
+
+				mNames[entry.nameKey].push_back(mEntries.size());
+				mEntries.push_back(entry);
+			}
+
+			if (mLocations[_location].recursive)
+			{
+				for (VectorFileInfo::const_iterator item = result.begin(); item != result.end(); ++item)
+				{
+					if (!item->folder
+						|| item->name == L".."
+						|| item->name == L".") continue;
+
+					std::wstring directoryKey = normalise(item->name);
+					if (!_directoryKey.empty())
+						directoryKey = _directoryKey + L"/" + directoryKey;
+					scanLocation(_location, _folder + item->name + L"/", directoryKey);
+				}
+			}
+		}
+
+		void addResult(VectorWString& _result, const Entry& _entry, const std::wstring& _directory, const std::wstring& _directoryKey, bool _fullpath) const
+		{
+			// file must be inside _directory relative to location root, or to any of its subfolders for recursive locations
+			if (_entry.directoryKey != _directoryKey)
+			{
+				if (!mLocations[_entry.location].recursive)
+					return;
+
+				if (!_directoryKey.empty())
+				{
+					size_t count = _directoryKey.size();
+					if (_entry.directoryKey.size() <= count
+						|| _entry.directoryKey[_entry.directoryKey.size() - count - 1] != '/'
+						|| _entry.directoryKey.compare(_entry.directoryKey.size() - count, count, _directoryKey) != 0)
+						return;
+				}
+			}
+
+			if (_fullpath)
+				_result.push_back(_entry.fullpath);
+			else
+				_result.push_back(concatenatePath(_directory, _entry.name));
+		}
+
+	private:
+		VectorLocation mLocations;
+		VectorEntry mEntries;
+		MapIndices mNames;
+		bool mValid;
+	};
+
+} // namespace common
+
+#endif // __FILE_SYSTEM_INDEX_H__
@@ -125,6 +125,7 @@ namespace common
 		if (dir == NULL)
 		{
 			/* opendir() failed */
+			return;
 		}
 
 		rewinddir (dir);
@@ -134,9 +135,13 @@ namespace common
 			if (!isReservedDir(MyGUI::UString(dp->d_name).asWStr_c_str()))
 			{
 				struct stat fInfo;
-				char path[NAME_MAX];
-				//snprintf(path, NAME_MAX, "%s/%s", MyGUI::UString(_folder).asUTF8_c_str(), dp->d_name);
-				if (stat(path, &fInfo) == -1)perror("stat");
+				char path[PATH_MAX];
+				snprintf(path, PATH_MAX, "%s/%s", MyGUI::UString(_folder).asUTF8_c_str(), dp->d_name);
+				if (stat(path, &fInfo) == -1)
+				{
+					perror("stat");
+					continue;
+				}
 				_result.push_back(FileInfo(MyGUI::UString(dp->d_name).asWStr(), (S_ISDIR(fInfo.st_mode))));
 			}
 		}
@@ -84,6 +84,9 @@
 #include "MyGUI_PolygonalSkin.h"
 #include "MyGUI_RotatingSkin.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_VertexUtility.h"
+#include "MyGUI_DirtyRegion.h"
+#include "MyGUI_TextureAtlasBaker.h"
 #include "MyGUI_Constants.h"
 #include "MyGUI_Bitwise.h"
 
@@ -35,10 +35,50 @@
 #include <algorithm>
 
 #include <typeinfo>
+#include <new>
 
 namespace MyGUI
 {
 
+	/** Types stored by Any in place, without heap allocation.
+		Type must be trivially copyable and not bigger than double or pointer.
+		Specialise it for own small POD types to store them in place too.
+	*/
+	template<typename ValueType>
+	struct AnyInPlace
+	{
+		enum { value = false };
+	};
+
+	template<typename ValueType>
+	struct AnyInPlace<ValueType*>
+	{
+		enum { value = true };
+	};
+
+#define MYGUI_ANY_IN_PLACE(type) \
+	template<> \
+	struct AnyInPlace<type> \
+	{ \
+		enum { value = true }; \
+	};
+
+	MYGUI_ANY_IN_PLACE(bool)
+	MYGUI_ANY_IN_PLACE(char)
+	MYGUI_ANY_IN_PLACE(signed char)
+	MYGUI_ANY_IN_PLACE(unsigned char)
+	MYGUI_ANY_IN_PLACE(wchar_t)
+	MYGUI_ANY_IN_PLACE(short)
+	MYGUI_ANY_IN_PLACE(unsigned short)
+	MYGUI_ANY_IN_PLACE(int)
+	MYGUI_ANY_IN_PLACE(unsigned int)
+	MYGUI_ANY_IN_PLACE(long)
+	MYGUI_ANY_IN_PLACE(unsigned long)
+	MYGUI_ANY_IN_PLACE(float)
+	MYGUI_ANY_IN_PLACE(double)
+
+#undef MYGUI_ANY_IN_PLACE
+
 	/** @example "Class Any usage"
 	@code
 	void f()
@@ -88,10 +128,24 @@ namespace MyGUI
 
 		template<typename ValueType>
 		Any(const ValueType& value) :
-			mContent(new Holder<ValueType>(value))
+			mInPlaceType(nullptr)
 		{
+			if (AnyInPlace<ValueType>::value && sizeof(ValueType) <= sizeof(Storage))
+			{
+				new (mStorage.buffer) ValueType(value);
+				mInPlaceType = &typeid(ValueType);
+			}
+			else
+			{
+				mStorage.content = new Holder<ValueType>(value);
+			}
 		}
 
+#ifdef MYGUI_USE_RVALUE_REFERENCES
+		Any(Any&& other) noexcept;
+		Any& operator = (Any&& rhs) noexcept;
+#endif
+
 		~Any();
 
 		Any& swap(Any& rhs);
@@ -113,8 +167,15 @@ namespace MyGUI
 		template<typename ValueType>
 		ValueType* castType(bool _throw = true) const
 		{
-			if (this->getType() == typeid(ValueType))
-				return &static_cast<Any::Holder<ValueType> *>(this->mContent)->held;
+			if (mInPlaceType != nullptr)
+			{
+				if (mInPlaceType == &typeid(ValueType) || *mInPlaceType == typeid(ValueType))
+					return reinterpret_cast<ValueType*>(const_cast<char*>(mStorage.buffer));
+			}
+			else if (mStorage.content != nullptr && mStorage.content->getType() == typeid(ValueType))
+			{
+				return &static_cast<Any::Holder<ValueType> *>(mStorage.content)->held;
+			}
 			MYGUI_ASSERT(!_throw, "Bad cast from type '" << getType().name() << "' to '" << typeid(ValueType).name() << "'");
 			return nullptr;
 		}
@@ -161,7 +222,18 @@ namespace MyGUI
 		};
 
 	private:
-		Placeholder* mContent;
+		// in-place value or pointer to holder, in-place value is trivially copyable so it's copied with the union
+		union Storage
+		{
+			Placeholder* content;
+			double alignDouble;
+			void* alignPointer;
+			char buffer[sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*)];
+		};
+
+		// type of in-place value, nullptr if value is in holder or Any is empty
+		const std::type_info* mInPlaceType;
+		Storage mStorage;
 	};
 
 } // namespace MyGUI
@@ -44,6 +44,11 @@ namespace MyGUI
 			return mRect;
 		}
 
+		void setRect(const FloatRect& _value)
+		{
+			mRect = _value;
+		}
+
 	private:
 		virtual void deserialization(xml::ElementPtr _node, Version _version)
 		{
@@ -83,6 +88,11 @@ namespace MyGUI
 			return mRect;
 		}
 
+		void setRect(const FloatRect& _value)
+		{
+			mRect = _value;
+		}
+
 		const IntSize& getTileSize() const
 		{
 			return mTileSize;
@@ -0,0 +1,56 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_DATA_MAPPED_STREAM_H__
+#define __MYGUI_DATA_MAPPED_STREAM_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_DataMemoryStream.h"
+
+namespace MyGUI
+{
+
+	/** Read only stream over file mapped into memory.
+		Content is available through data() without copying.
+	*/
+	class MYGUI_EXPORT DataMappedStream :
+		public DataMemoryStream
+	{
+	public:
+		DataMappedStream();
+		virtual ~DataMappedStream();
+
+		/** Map file into memory.
+			@param _filename File name in UTF-8
+			@return false if file can't be opened or mapped (for example file is empty)
+		*/
+		bool open(const std::string& _filename);
+		void close();
+
+		bool isOpen() const;
+
+	private:
+		void* mFile;
+		void* mMapping;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_DATA_MAPPED_STREAM_H__
@@ -41,14 +41,12 @@ namespace MyGUI
         virtual void seek(size_t offset);
 		virtual void readline(std::string& _source, Char _delim);
 		virtual size_t read(void* _buf, size_t _count);
-
-	private:
-		void prepareStream();
+		virtual const unsigned char* data();
 
 	protected:
 		unsigned char* mData;
 		size_t mSize;
-		std::stringstream* mStream;
+		size_t mPosition;
 	};
 
 } // namespace MyGUI
@@ -0,0 +1,107 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_DATA_PACK_H__
+#define __MYGUI_DATA_PACK_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_IDataStream.h"
+#include "MyGUI_DataMappedStream.h"
+
+namespace MyGUI
+{
+
+	/** Read only archive of resource files in one file.
+		Pack contains header, index of entries sorted by name, names and data of entries.
+		Each entry data is aligned inside pack and can be compressed.
+		Uncompressed entries are returned as streams over mapped pack without copying.
+	*/
+	class MYGUI_EXPORT DataPack
+	{
+	public:
+		enum Compression
+		{
+			CompressionNone,
+			CompressionLZ4
+		};
+
+		DataPack();
+		~DataPack();
+
+		/** Open pack file.
+			@param _filename File name in UTF-8
+		*/
+		bool load(const std::string& _filename);
+		void unload();
+
+		bool isLoaded() const;
+		const std::string& getFileName() const;
+
+		/** Get stream with entry content or nullptr if there is no such entry. Delete stream after use. */
+		IDataStream* getData(const std::string& _name) const;
+
+		bool isDataExist(const std::string& _name) const;
+
+		/** Add names of entries matching _pattern ('*' and '?' supported) to _result. */
+		void getDataListNames(const std::string& _pattern, VectorString& _result) const;
+
+		size_t getEntriesCount() const;
+
+		/** Write pack file.
+			@param _filename Pack file name
+			@param _names Entry names, must be unique
+			@param _files Files with entries content, same order as _names
+			@param _compression Compression for entries, entry is stored uncompressed if compression doesn't reduce its size
+			@param _alignment Alignment of entries data in pack, power of two
+		*/
+		static bool build(const std::string& _filename, const VectorString& _names, const VectorString& _files, Compression _compression, size_t _alignment = 16);
+
+		/** Compress data in LZ4 block format. */
+		static void compressLZ4(const uint8* _source, size_t _size, vector<uint8>::type& _result);
+		/** Decompress data in LZ4 block format, _size must be exact size of uncompressed data. */
+		static bool decompressLZ4(const uint8* _source, size_t _sourceSize, uint8* _result, size_t _size);
+
+	private:
+		struct Entry
+		{
+			const char* name;
+			size_t nameLength;
+			size_t offset;
+			size_t size;
+			size_t packedSize;
+			Compression compression;
+		};
+		typedef vector<Entry>::type VectorEntry;
+
+		const Entry* findEntry(const std::string& _name) const;
+
+		static bool compareEntry(const Entry& _entry, const std::string& _name);
+
+	private:
+		DataMappedStream mStream;
+		const uint8* mData;
+		VectorEntry mEntries;
+		std::string mFileName;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_DATA_PACK_H__
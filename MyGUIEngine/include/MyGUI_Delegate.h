@@ -23,7 +23,8 @@
 #define __MYGUI_DELEGATE_H__
 
 #include "MyGUI_Diagnostic.h"
-#include <list>
+#include <vector>
+#include <algorithm>
 
 #include <typeinfo>
 
@@ -40,14 +40,26 @@ namespace delegates
 	class MYGUI_I_DELEGATE
 	{
 	public:
+		MYGUI_I_DELEGATE() : mObject(nullptr), mUnlink(nullptr) { }
+		MYGUI_I_DELEGATE(const void* _object, IDelegateUnlink* _unlink) : mObject(_object), mUnlink(_unlink) { }
 		virtual ~MYGUI_I_DELEGATE() { }
 		virtual bool isType( const std::type_info& _type) = 0;
 		virtual void invoke( MYGUI_PARAMS ) = 0;
 		virtual bool compare(  MYGUI_I_DELEGATE MYGUI_TEMPLATE_ARGS* _delegate) const = 0;
 		virtual bool compare(IDelegateUnlink* _unlink) const
 		{
-			return false;
+			return mUnlink != nullptr && mUnlink == _unlink;
+		}
+
+		// delegates of different objects are never equal, so most pairs are rejected without virtual call and typeid
+		bool equal(  MYGUI_I_DELEGATE MYGUI_TEMPLATE_ARGS* _delegate) const
+		{
+			return _delegate != nullptr && mObject == _delegate->mObject && compare(_delegate);
 		}
+
+	private:
+		const void* mObject;
+		IDelegateUnlink* mUnlink;
 	};
 
 
@@ -93,7 +105,12 @@ namespace delegates
 	public:
 		typedef void (T::*Method)( MYGUI_PARAMS );
 
-		MYGUI_C_METHOD_DELEGATE(IDelegateUnlink* _unlink, T* _object, Method _method) : mUnlink(_unlink), mObject(_object), mMethod(_method) { }
+		MYGUI_C_METHOD_DELEGATE(IDelegateUnlink* _unlink, T* _object, Method _method) :
+			MYGUI_I_DELEGATE MYGUI_TEMPLATE_ARGS (_object, _unlink),
+			mObject(_object),
+			mMethod(_method)
+		{
+		}
 
 		virtual bool isType( const std::type_info& _type)
 		{
@@ -112,13 +129,9 @@ namespace delegates
 			return cast->mObject == mObject && cast->mMethod == mMethod;
 		}
 
-		virtual bool compare(IDelegateUnlink* _unlink) const
-		{
-			return mUnlink == _unlink;
-		}
+		using MYGUI_I_DELEGATE MYGUI_TEMPLATE_ARGS::compare;
 
 	private:
-		IDelegateUnlink* mUnlink;
 		T* mObject;
 		Method mMethod;
 	};
@@ -223,11 +236,12 @@ namespace delegates
 	{
 	public:
 		typedef  MYGUI_I_DELEGATE MYGUI_TEMPLATE_ARGS  IDelegate;
-		typedef MYGUI_TYPENAME list<IDelegate* /*, Allocator<IDelegate*>*/ >::type ListDelegate;
-		typedef MYGUI_TYPENAME ListDelegate::iterator ListDelegateIterator;
-		typedef MYGUI_TYPENAME ListDelegate::const_iterator ConstListDelegateIterator;
+		// removed delegates are set to nullptr and erased when no call is in progress
+		typedef MYGUI_TYPENAME vector<IDelegate*>::type VectorDelegate;
+		typedef MYGUI_TYPENAME VectorDelegate::iterator VectorDelegateIterator;
+		typedef MYGUI_TYPENAME VectorDelegate::const_iterator ConstVectorDelegateIterator;
 
-		MYGUI_C_MULTI_DELEGATE () { }
+		MYGUI_C_MULTI_DELEGATE () : mCallDepth(0), mHasEmpty(false) { }
 		~MYGUI_C_MULTI_DELEGATE ()
 		{
 			clear();
@@ -235,7 +249,7 @@ namespace delegates
 
 		bool empty() const
 		{
-			for (ConstListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (ConstVectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
 				if (*iter) return false;
 			}
@@ -244,94 +258,115 @@ namespace delegates
 
 		void clear()
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
 				if (*iter)
 				{
 					delete (*iter);
 					(*iter) = nullptr;
+					mHasEmpty = true;
 				}
 			}
+			compact();
 		}
 
 		void clear(IDelegateUnlink* _unlink)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
 				if ((*iter) && (*iter)->compare(_unlink))
 				{
 					delete (*iter);
 					(*iter) = nullptr;
+					mHasEmpty = true;
 				}
 			}
+			compact();
 		}
 
 		MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& operator+=(IDelegate* _delegate)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
-				if ((*iter) && (*iter)->compare(_delegate))
+				if ((*iter) && (*iter)->equal(_delegate))
 				{
 					MYGUI_EXCEPT("Trying to add same delegate twice.");
 				}
 			}
-			mListDelegates.push_back(_delegate);
+			mVectorDelegates.push_back(_delegate);
 			return *this;
 		}
 
 		MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& operator-=(IDelegate* _delegate)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
-				if ((*iter) && (*iter)->compare(_delegate))
+				if ((*iter) && (*iter)->equal(_delegate))
 				{
 					// проверяем на идентичность делегатов
 					if ((*iter) != _delegate) delete (*iter);
 					(*iter) = nullptr;
+					mHasEmpty = true;
 					break;
 				}
 			}
 			delete _delegate;
+			compact();
 			return *this;
 		}
 
+		// same as -= newDelegate(_object, _method), but without allocation of delegate to compare with
+		template <typename T>
+		void remove(T* _object, void (T::*_method)( MYGUI_PARAMS ))
+		{
+			MYGUI_C_METHOD_DELEGATE MYGUI_T_TEMPLATE_ARGS key(GetDelegateUnlink(_object), _object, _method);
+			removeEqual(&key);
+		}
+
+		// same as -= newDelegate(_func), but without allocation of delegate to compare with
+		void remove(void (*_func)( MYGUI_PARAMS ))
+		{
+			MYGUI_C_STATIC_DELEGATE MYGUI_TEMPLATE_ARGS key(_func);
+			removeEqual(&key);
+		}
+
 		void operator()( MYGUI_PARAMS )
 		{
-			ListDelegateIterator iter = mListDelegates.begin();
-			while (iter != mListDelegates.end())
+			CallGuard guard(*this);
+
+			// delegates added during the call are called too, storage can grow so index is used
+			for (size_t index = 0; index < mVectorDelegates.size(); ++index)
 			{
-				if (nullptr == (*iter))
-				{
-					iter = mListDelegates.erase(iter);
-				}
-				else
-				{
-					(*iter)->invoke( MYGUI_ARGS );
-					++iter;
-				}
+				IDelegate* del = mVectorDelegates[index];
+				if (del != nullptr)
+					del->invoke( MYGUI_ARGS );
 			}
 		}
 
-		MYGUI_C_MULTI_DELEGATE (const MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& _event)
+		MYGUI_C_MULTI_DELEGATE (const MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& _event) : mCallDepth(0), mHasEmpty(false)
 		{
 			// забираем себе владение
-			ListDelegate del = _event.mListDelegates;
-			const_cast< MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates.clear();
+			VectorDelegate del = _event.mVectorDelegates;
+			const_cast< MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& >(_event).mVectorDelegates.clear();
 
 			safe_clear(del);
 
-			mListDelegates = del;
+			mVectorDelegates = del;
+			mHasEmpty = true;
+			compact();
 		}
 
 		MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& operator=(const MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& _event)
 		{
 			// забираем себе владение
-			ListDelegate del = _event.mListDelegates;
-			const_cast< MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& >(_event).mListDelegates.clear();
+			VectorDelegate del = _event.mVectorDelegates;
+			const_cast< MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& >(_event).mVectorDelegates.clear();
 
 			safe_clear(del);
 
-			mListDelegates = del;
+			mVectorDelegates = del;
+			mHasEmpty = true;
+			compact();
 
 			return *this;
 		}
@@ -345,24 +380,70 @@ namespace delegates
 		}
 
 	private:
-		void safe_clear(ListDelegate& _delegates)
+		// keeps removed delegates in place while any call is in progress, even if a delegate throws
+		class CallGuard
+		{
+		public:
+			CallGuard(MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& _owner) : mOwner(_owner)
+			{
+				mOwner.mCallDepth ++;
+			}
+			~CallGuard()
+			{
+				mOwner.mCallDepth --;
+				mOwner.compact();
+			}
+
+		private:
+			CallGuard(const CallGuard&);
+			CallGuard& operator = (const CallGuard&);
+
+			MYGUI_C_MULTI_DELEGATE  MYGUI_TEMPLATE_ARGS& mOwner;
+		};
+
+		void removeEqual(IDelegate* _delegate)
+		{
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
+			{
+				if ((*iter) && (*iter)->equal(_delegate))
+				{
+					delete (*iter);
+					(*iter) = nullptr;
+					mHasEmpty = true;
+					break;
+				}
+			}
+			compact();
+		}
+
+		void compact()
+		{
+			if (mCallDepth != 0 || !mHasEmpty)
+				return;
+
+			mHasEmpty = false;
+			mVectorDelegates.erase(std::remove(mVectorDelegates.begin(), mVectorDelegates.end(), (IDelegate*)nullptr), mVectorDelegates.end());
+		}
+
+		void safe_clear(VectorDelegate& _delegates)
 		{
-			for (ListDelegateIterator iter = mListDelegates.begin(); iter != mListDelegates.end(); ++iter)
+			for (VectorDelegateIterator iter = mVectorDelegates.begin(); iter != mVectorDelegates.end(); ++iter)
 			{
 				if (*iter)
 				{
 					IDelegate* del = (*iter);
 					(*iter) = nullptr;
+					mHasEmpty = true;
 					delete_is_not_found(del, _delegates);
 				}
 			}
 		}
 
-		void delete_is_not_found(IDelegate* _del, ListDelegate& _delegates)
+		void delete_is_not_found(IDelegate* _del, VectorDelegate& _delegates)
 		{
-			for (ListDelegateIterator iter = _delegates.begin(); iter != _delegates.end(); ++iter)
+			for (VectorDelegateIterator iter = _delegates.begin(); iter != _delegates.end(); ++iter)
 			{
-				if ((*iter) && (*iter)->compare(_del))
+				if ((*iter) && (*iter)->equal(_del))
 				{
 					return;
 				}
@@ -372,7 +453,9 @@ namespace delegates
 		}
 
 	private:
-		ListDelegate mListDelegates;
+		VectorDelegate mVectorDelegates;
+		size_t mCallDepth;
+		bool mHasEmpty;
 	};
 
 
@@ -0,0 +1,84 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_DIRTY_REGION_H__
+#define __MYGUI_DIRTY_REGION_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+
+namespace MyGUI
+{
+
+	/** Screen rectangles changed since previous frame.
+		Layers add rectangles of changed render items, overlapping ones are merged and optimise() crops them to view,
+		so platform can redraw only these rectangles or skip frame if region is empty.
+	*/
+	class MYGUI_EXPORT DirtyRegion
+	{
+	public:
+		typedef vector<IntRect>::type VectorIntRect;
+
+	public:
+		DirtyRegion();
+
+		/** Add changed rectangle in layer coordinates, rectangle without area is ignored.
+			Rectangle is merged with overlapping ones at once, above getMaxRectCount() rectangles all are merged to bounding one.
+		*/
+		void addRect(const IntRect& _rect);
+
+		/** Mark whole view as changed. */
+		void setFull();
+		bool isFull() const;
+
+		/** True if nothing changed. */
+		bool empty() const;
+
+		void clear();
+
+		/** Crop rectangles to view.
+			Region becomes full if rectangles cover most of view, full region has one rectangle of view size.
+		*/
+		void optimise(const IntSize& _viewSize);
+
+		const VectorIntRect& getRects() const;
+
+		/** True if _rect has to be redrawn. */
+		bool intersect(const IntRect& _rect) const;
+
+		/** Maximum count of rectangles, more rectangles are merged to bounding one. 8 by default. */
+		void setMaxRectCount(size_t _value);
+		size_t getMaxRectCount() const;
+
+		/** Bounding rectangle of both rectangles, rectangles without area are ignored. */
+		static IntRect combine(const IntRect& _first, const IntRect& _second);
+
+	private:
+		void mergeRect(const IntRect& _rect);
+
+	private:
+		VectorIntRect mRects;
+		bool mFull;
+		size_t mMaxRectCount;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_DIRTY_REGION_H__
@@ -50,8 +50,10 @@ namespace MyGUI
 		/*internal:*/
 		void _unloadDelayDynLibs();
 
-	private:
+		// called by Gui at the beginning of frame
 		void notifyEventFrameStart(float _time);
+		/** 0 if libraries wait for delayed unloading, -1 otherwise */
+		float _getNextFrameDelay() const;
 
 	private:
 		//! Dynamic libraries map
@@ -31,6 +31,7 @@
 #include "MyGUI_RenderFormat.h"
 #include "MyGUI_TextView.h"
 #include "MyGUI_VertexData.h"
+#include "MyGUI_VertexUtility.h"
 
 namespace MyGUI
 {
@@ -130,23 +131,19 @@ namespace MyGUI
 	private:
 		void _setTextColour(const Colour& _value);
 		void checkVertexSize();
-
-		void drawQuad(
-			Vertex*& _vertex,
-			size_t& _vertexCount,
-			const FloatRect& _vertexRect,
-			float _vertexZ,
-			const FloatRect& _textureRect,
-			uint32 _colour) const;
+		void notifyGlyphsReady(IFont* _font);
 
 		void drawGlyph(
-			const RenderTargetInfo& renderTargetInfo,
-			Vertex*& _vertex,
-			size_t& _vertexCount,
+			vertex_utility::QuadWriter& _writer,
 			FloatRect _vertexRect,
 			FloatRect _textureRect,
 			uint32 _colour) const;
 
+		template <bool Tagged, bool Selection>
+		void drawLines(
+			RenderItem* _render,
+			vertex_utility::QuadWriter& _writer) const;
+
 	protected:
 		bool mEmptyView;
 		uint32 mCurrentColourNative;
@@ -156,6 +153,8 @@ namespace MyGUI
 		IntCoord mCurrentCoord;
 
 		UString mCaption;
+		// caption contains colour tags
+		bool mCaptionTagged;
 		bool mTextOutDate;
 		Align mTextAlign;
 
@@ -185,6 +184,8 @@ namespace MyGUI
 		bool mWordWrap;
 		bool mManualColour;
 		int mOldWidth;
+		// caption uses glyphs that are rendered in background, subscribed to FontManager::eventGlyphsReady
+		bool mWaitGlyphs;
 
 		TextView mTextView;
 
@@ -30,11 +30,16 @@
 namespace MyGUI
 {
 
+	/** Registered factory for one category and type, see FactoryManager::getFactoryHandle. */
+	struct FactoryItem;
+	typedef FactoryItem* FactoryHandle;
+
 	class MYGUI_EXPORT FactoryManager :
 		public Singleton<FactoryManager>
 	{
 	public:
 		FactoryManager();
+		~FactoryManager();
 
 		void initialise();
 		void shutdown();
@@ -83,13 +88,30 @@ namespace MyGUI
 			return nullptr;
 		}
 
+		/** Get handle of factory for _category and _type.\n
+			Handle stays valid until FactoryManager is destroyed, even if factory is not registered yet or unregistered later,
+			so it can be stored and used to create objects without name lookups.
+		*/
+		FactoryHandle getFactoryHandle(const std::string& _category, const std::string& _type);
+		/** Create object with factory handle. Return nullptr if there's no registered factory for it. */
+		IObject* createObject(FactoryHandle _handle);
+
 		/** Destroy object */
 		void destroyObject(IObject* _object);
 
 	private:
-		typedef map<std::string, Delegate>::type MapFactoryItem;
-		typedef map<std::string, MapFactoryItem>::type MapRegisterFactoryItem;
-		MapRegisterFactoryItem mRegisterFactoryItems;
+		FactoryItem* findItem(const std::string& _category, const std::string& _type, size_t _hash) const;
+		FactoryItem* getItem(const std::string& _category, const std::string& _type, bool _rename);
+		void rehash(size_t _bucketsCount);
+
+		static size_t getHash(const std::string& _category, const std::string& _type);
+
+	private:
+		// items are never deleted while manager exists, they are referenced by handles
+		typedef vector<FactoryItem*>::type VectorFactoryItem;
+		VectorFactoryItem mItems;
+		// open hash table of items by category and type
+		vector<FactoryItem*>::type mBuckets;
 
 		bool mIsInitialise;
 	};
@@ -54,6 +54,11 @@ namespace MyGUI
 	private:
 		std::ofstream mStream;
 		std::string mFileName;
+
+		int mTimeHour;
+		int mTimeMinute;
+		int mTimeSecond;
+		char mTimeText[9];
 	};
 
 } // namespace MyGUI
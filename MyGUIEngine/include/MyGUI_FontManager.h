@@ -29,6 +29,8 @@
 #include "MyGUI_XmlDocument.h"
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_BackwardCompatibility.h"
+#include "MyGUI_Delegate.h"
+#include "MyGUI_GlyphAtlas.h"
 
 namespace MyGUI
 {
@@ -66,6 +68,19 @@ namespace MyGUI
 
         void prepareFont();
 
+		/** Check if fonts wait for prepareFont */
+		bool isPrepareRequired() const;
+
+		/** Get texture pages shared by glyphs of all fonts */
+		GlyphAtlas& getGlyphAtlas();
+
+		/*events:*/
+		/** Event : Glyphs rendered in background were added to font textures.\n
+			signature : void method(MyGUI::IFont* _font)\n
+			@param _font Font that got new glyphs
+		*/
+		delegates::CMultiDelegate1<IFont*> eventGlyphsReady;
+
 	private:
 		void _load(xml::ElementPtr _node, const std::string& _file, Version _version);
 
@@ -84,6 +99,8 @@ namespace MyGUI
         FontPrepareRegistry mDirtyFont;
 
         FontDataImpl* mFontImpl;
+
+		GlyphAtlas mGlyphAtlas;
 	};
 
 } // namespace MyGUI
@@ -36,6 +36,28 @@ namespace MyGUI
 		enum Side {Left, Right, Top, Bottom};
 		void cropPolygonSide(VectorFloatPoint& _verticies, int _sideCoord, Side _side);
 
+		/** Maximum count of verticies that cropping of polygon with _size verticies can produce */
+		inline size_t getCropPolygonMaxSize(size_t _size)
+		{
+			return _size + 4;
+		}
+
+		/** Crop polygon without allocations.
+			@param _baseVerticiesPos Source polygon.
+			@param _size Count of source verticies.
+			@param _cropRectangle Rectangle to crop by.
+			@param _result Destination buffer, must hold at least getCropPolygonMaxSize(_size) verticies.
+			@param _temp Temporary buffer of the same size as _result.
+			@return Count of verticies written to _result.
+		*/
+		size_t cropPolygon(const FloatPoint* _baseVerticiesPos, size_t _size, const IntCoord& _cropRectangle, FloatPoint* _result, FloatPoint* _temp);
+
+		/** Crop polygon by one side, writes result into _result and returns count of result verticies */
+		size_t cropPolygonSide(const FloatPoint* _verticies, size_t _size, FloatPoint* _result, float _sideCoord, Side _side);
+
+		/** Check if all polygon verticies are inside rectangle */
+		bool isPolygonInsideRect(const FloatPoint* _verticies, size_t _size, const IntCoord& _rect);
+
 		// get point position relative to rectangle
 		FloatPoint getPositionInsideRect(const FloatPoint& _point, const FloatPoint& _corner0, const FloatPoint& _corner1, const FloatPoint& _corner2);
 
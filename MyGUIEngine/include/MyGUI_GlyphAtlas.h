@@ -0,0 +1,155 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_GLYPH_ATLAS_H__
+#define __MYGUI_GLYPH_ATLAS_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_RenderFormat.h"
+
+namespace MyGUI
+{
+
+	class ITexture;
+
+	/** Texture pages shared by glyphs of all fonts.
+		Rectangles are packed with bottom-left skyline packer. Pages are grouped by pixel format and usage,
+		fonts with the same format put glyphs on the same pages, so text in different fonts is drawn in one batch.
+	*/
+	class MYGUI_EXPORT GlyphAtlas
+	{
+	public:
+		/** Allocated rectangle. */
+		struct Region
+		{
+			Region() :
+				texture(nullptr),
+				memory(nullptr),
+				pitch(0)
+			{
+			}
+
+			ITexture* texture;
+			/** First pixel of the rectangle in page memory. */
+			uint8* memory;
+			/** Bytes from one row of the page to the next. */
+			size_t pitch;
+			IntCoord coord;
+			FloatRect uvRect;
+			IntSize textureSize;
+		};
+
+		struct Statistics
+		{
+			Statistics() :
+				pages(0),
+				owners(0),
+				usedPixels(0),
+				totalPixels(0)
+			{
+			}
+
+			/** Used part of pages area, from 0 to 1. */
+			float getOccupancy() const
+			{
+				return totalPixels == 0 ? 0.0f : (float)usedPixels / (float)totalPixels;
+			}
+
+			size_t pages;
+			/** Sum of owners count of all pages, font with glyphs on two pages is counted twice. */
+			size_t owners;
+			size_t usedPixels;
+			size_t totalPixels;
+		};
+
+	public:
+		GlyphAtlas();
+		~GlyphAtlas();
+
+		/** Allocate rectangle on a page with _format and _usage, new page is created if no page has space.
+			Memory of the rectangle is cleared, page is uploaded to texture in update().
+			@param _owner Owner of the rectangle, all rectangles of the owner are freed by release()
+			@return false if rectangle is bigger than page
+		*/
+		bool allocate(const void* _owner, int _width, int _height, PixelFormat _format, TextureUsage _usage, Region& _region);
+
+		/** Free all rectangles of _owner. Page is destroyed when all its rectangles are freed. */
+		void release(const void* _owner);
+
+		/** Mark page of region as changed after writing to its memory outside of allocate(). */
+		void setDirty(const Region& _region);
+
+		/** Upload changed pages to textures. */
+		void update();
+
+		/** Destroy all pages. */
+		void clear();
+
+		/** Size of new pages in pixels, 512 by default. */
+		void setPageSize(int _value);
+		int getPageSize() const;
+
+		Statistics getStatistics() const;
+
+		/** Size of pixel in bytes or 0 if format is not supported by atlas. */
+		static size_t getNumElemBytes(PixelFormat _format);
+
+	private:
+		struct Segment
+		{
+			int x;
+			int y;
+			int width;
+		};
+		typedef vector<Segment>::type VectorSegment;
+
+		typedef map<const void*, size_t>::type MapOwnerPixels;
+
+		struct Page
+		{
+			ITexture* texture;
+			uint8* memory;
+			int size;
+			size_t numElemBytes;
+			PixelFormat format;
+			TextureUsage usage;
+			VectorSegment skyline;
+			MapOwnerPixels owners;
+			size_t usedPixels;
+			bool dirty;
+		};
+		typedef vector<Page*>::type VectorPage;
+
+		Page* createPage(PixelFormat _format, TextureUsage _usage);
+		void destroyPage(Page* _page);
+
+		// Finds the lowest place for rectangle on skyline, returns false if there is no place.
+		bool findPosition(const Page* _page, int _width, int _height, int& _x, int& _y, size_t& _index) const;
+		void addSkylineLevel(Page* _page, size_t _index, int _x, int _y, int _width, int _height);
+
+	private:
+		VectorPage mPages;
+		int mPageSize;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_GLYPH_ATLAS_H__
@@ -175,10 +175,24 @@ namespace MyGUI
 		*/
 		void frameEvent(float _time);
 
+		/** Check if next frameEvent and render would change anything.
+			False means that nothing is animated, no input is waiting and no layer changed, so frame can be skipped.
+			Time of skipped frames should be added to _time of next frameEvent.
+		*/
+		bool isFrameRequired() const;
+
+		/** Get seconds till next frame is required.
+			@return 0 if frame is required now, -1 if nothing happens until next input,
+				otherwise time left to the nearest timer (key repeat or tool tip delay).
+			Application can sleep or wait for input events for this time.
+		*/
+		float getNextFrameDelay() const;
+
 		/*events:*/
 		/** Event : Multidelegate. GUI per frame call.\n
 			signature : void method(float _time)\n
 			@param _time Time elapsed since last frame
+		@note While this event has any delegate, every frame is required.
 		*/
 		EventHandle_FrameEventDelegate
 			eventFrameStart;
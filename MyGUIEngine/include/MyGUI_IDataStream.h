@@ -38,6 +38,14 @@ namespace MyGUI
         virtual void seek(size_t offset) = 0;
 		virtual void readline(std::string& _source, Char _delim = '\n') = 0;
 		virtual size_t read(void* _buf, size_t _count) = 0;
+
+		/** Get pointer to whole stream content if it is located in memory contiguously.
+			@return Pointer to size() bytes or nullptr if stream can be accessed only through read().
+		*/
+		virtual const unsigned char* data()
+		{
+			return nullptr;
+		}
 	};
 
 } // namespace MyGUI
@@ -50,6 +50,12 @@ namespace MyGUI
         virtual void prepareString(const UString& text) = 0;
 
         virtual void prepareTexture() = 0;
+
+		// Returns true while glyphs requested by prepareString are not ready yet and substitute glyph is shown instead.
+		virtual bool hasPendingGlyphs() const
+		{
+			return false;
+		}
 	};
 
 } // namespace MyGUI
@@ -77,6 +77,18 @@ namespace MyGUI
 
 		virtual void resizeView(const IntSize& _viewSize) = 0;
 
+		/** Add rectangles that change on next render, layer that can't track its changes marks whole view. */
+		virtual void addDirtyRegion(DirtyRegion& _region)
+		{
+			_region.setFull();
+		}
+
+		/** Check if layer changes on next render, layer that can't track its changes is always out of date. */
+		virtual bool isOutOfDate() const
+		{
+			return true;
+		}
+
 	protected:
 		std::string mName;
 	};
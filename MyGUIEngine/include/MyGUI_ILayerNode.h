@@ -26,6 +26,7 @@
 #include "MyGUI_Enumerator.h"
 #include "MyGUI_IObject.h"
 #include "MyGUI_IRenderTarget.h"
+#include "MyGUI_DirtyRegion.h"
 
 namespace MyGUI
 {
@@ -87,6 +88,12 @@ namespace MyGUI
 		virtual void resizeView(const IntSize& _viewSize) = 0;
 
 		virtual float getNodeDepth() = 0;
+
+		/** Add rectangles that change on next render, node that can't track its changes marks whole view. */
+		virtual void addDirtyRegion(DirtyRegion& _region)
+		{
+			_region.setFull();
+		}
 	};
 
 } // namespace MyGUI
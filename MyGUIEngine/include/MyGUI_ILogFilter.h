@@ -40,6 +40,14 @@ namespace MyGUI
 		{
 			return true;
 		}
+
+		/** Check if messages with this level can be logged, called before message is formatted.\n
+			Return true if filter depends on something else than level.
+		*/
+		virtual bool isLevelEnabled(LogLevel _level) const
+		{
+			return true;
+		}
 	};
 
 } // namespace MyGUI
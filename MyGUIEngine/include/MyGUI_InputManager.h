@@ -127,6 +127,41 @@ namespace MyGUI
 		/** Unlink widget from input manager. */
 		void unlinkWidget(Widget* _widget);
 
+		/** Enable or disable coalescing of mouse moves.\n
+			When enabled injectMouseMove only stores position and widget under mouse is picked once,
+			at the beginning of frame or right before next button, wheel or key event, so order of events is kept.
+			injectMouseMove then returns result of the last processed event.\n
+			Disabled (false) by default.
+		*/
+		void setMouseMoveCoalescing(bool _value);
+		/** Get mouse move coalescing flag */
+		bool getMouseMoveCoalescing() const;
+
+		/** Process stored mouse move now, use it when result of picking is needed before next frame. */
+		void flushMouseMove();
+
+		struct Statistics
+		{
+			Statistics() :
+				eventsReceived(0),
+				eventsProcessed(0),
+				picks(0)
+			{
+			}
+
+			/** Events injected by application. */
+			size_t eventsReceived;
+			/** Events delivered to widgets, coalesced mouse moves are not counted. */
+			size_t eventsProcessed;
+			/** Searches of widget under mouse. */
+			size_t picks;
+		};
+
+		/** Get input statistics since last resetStatistics */
+		const Statistics& getStatistics() const;
+		/** Reset input statistics */
+		void resetStatistics();
+
 		/** Event : MultiDelegate. Mouse focus was changed.\n
 			signature : void method(MyGUI::Widget* _widget)\n
 			@param _widget
@@ -144,11 +179,16 @@ namespace MyGUI
 		/*internal:*/
 		void _resetMouseFocusWidget();
 
+		// called by Gui at the beginning of frame
+		void frameEntered(float _frame);
+		/** Seconds till input needs next frame: 0 after injected input, time till key repeat, -1 if nothing is waited */
+		float _getNextFrameDelay() const;
+
 	private:
 		// удаляем данный виджет из всех возможных мест
 		void _unlinkWidget(Widget* _widget);
 
-		void frameEntered(float _frame);
+		bool processMouseMove(int _absx, int _absy, int _absz);
 
 		void firstEncoding(KeyCode _key, bool bIsKeyPressed);
 
@@ -189,6 +229,15 @@ namespace MyGUI
 		float mTimerKey;
 		int mOldAbsZ;
 
+		// input was injected after beginning of frame
+		bool mInputPending;
+
+		// mouse move stored in mMousePosition is not processed yet
+		bool mMouseMoveCoalescing;
+		bool mMouseMoveQueued;
+
+		Statistics mStatistics;
+
 		// список виджетов с модальным режимом
 		VectorWidgetPtr mVectorModalRootWidget;
 
@@ -29,6 +29,7 @@
 #include "MyGUI_IUnlinkWidget.h"
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_ILayer.h"
+#include "MyGUI_DirtyRegion.h"
 #include "MyGUI_BackwardCompatibility.h"
 
 namespace MyGUI
@@ -82,6 +83,25 @@ namespace MyGUI
 		/** Render all layers to specified target */
 		void renderToTarget(IRenderTarget* _target, bool _update);
 
+		/** Collect rectangles that changed since last render, empty region means frame can be skipped.
+			Call right before renderToTarget, otherwise renderToTarget collects them itself.
+		*/
+		const DirtyRegion& updateDirtyRegion(bool _update);
+		/** Get rectangles collected for current frame */
+		const DirtyRegion& getDirtyRegion() const;
+		/** Check if any layer changes on next render */
+		bool isOutOfDate() const;
+
+		/** Enable or disable partial redraw.\n
+			In partial redraw only render items that intersect dirty region are drawn,
+			platform must restrict output to rectangles of getDirtyRegion() and keep previous frame outside of them.\n
+			Enabling is refused with warning if RenderManager::isPartialRedrawSupported is false.\n
+			Disabled (false) by default.
+		*/
+		void setPartialRedraw(bool _value);
+		/** Get partial redraw flag */
+		bool getPartialRedraw() const;
+
 		void resizeView(const IntSize& _viewSize);
 
 		const std::string& getCategoryName() const;
@@ -100,6 +120,10 @@ namespace MyGUI
 
 		bool mIsInitialise;
 		std::string mCategoryName;
+
+		DirtyRegion mDirtyRegion;
+		bool mDirtyRegionReady;
+		bool mPartialRedraw;
 	};
 
 } // namespace MyGUI
@@ -86,9 +86,32 @@ namespace MyGUI
 
 		bool isOutOfDate() const;
 
+		/** Render node with its child nodes to texture and draw it as one quad while nothing in the node changes.
+			Texture covers coordinate of the single layer item of the node (root widget of overlapped layer),
+			node with several layer items or platform without render target textures is rendered as usual.
+		*/
+		void setCacheToTexture(bool _value);
+		bool getCacheToTexture() const;
+
+		/** Memory in bytes used by cache textures of all nodes. */
+		static size_t getCacheTextureMemory();
+
+		virtual void addDirtyRegion(DirtyRegion& _region);
+
+		/** Rectangle covered by last render of node and its child nodes. */
+		IntRect getNodeRect() const;
+
 	protected:
 		void updateCompression();
 
+		void renderNodeToTarget(IRenderTarget* _target, bool _update);
+
+	private:
+		// returns false if node can't be cached now and has to be rendered as usual
+		bool renderToCache(IRenderTarget* _target, bool _update);
+		bool checkCacheTexture(const IntSize& _size);
+		void destroyCache();
+
 	protected:
 		// список двух очередей отрисовки, для сабскинов и текста
 		VectorRenderItem mFirstRenderItems;
@@ -105,6 +128,19 @@ namespace MyGUI
 		ILayer* mLayer;
 		bool mOutOfDate;
 		float mDepth;
+		// rectangle of destroyed or raised child nodes
+		IntRect mDirtyRect;
+
+	private:
+		bool mCacheToTexture;
+		// render items have vertices for other target, next render regenerates them
+		bool mCacheMajorUpdate;
+		ITexture* mCacheTexture;
+		IVertexBuffer* mCacheVertexBuffer;
+		IntSize mCacheTextureSize;
+		IntCoord mCacheCoord;
+
+		static size_t msCacheTextureMemory;
 	};
 
 } // namespace MyGUI
@@ -26,16 +26,23 @@
 #include "MyGUI_LogStream.h"
 #include "MyGUI_LogSource.h"
 #include "MyGUI_Diagnostic.h"
+#include <time.h>
 
 namespace MyGUI
 {
 
+	// message is formatted only if some log source accepts its level
 	#define MYGUI_LOGGING(section, level, text) \
-		MyGUI::LogManager::getInstance().log(section, MyGUI::LogLevel::level, MyGUI::LogStream() << text << MyGUI::LogStream::End(), __FILE__, __LINE__)
+		do \
+		{ \
+			if (MyGUI::LogManager::getInstance().isLevelEnabled(MyGUI::LogLevel::level)) \
+				MyGUI::LogManager::getInstance().log(section, MyGUI::LogLevel::level, MyGUI::LogStream() << text << MyGUI::LogStream::End(), __FILE__, __LINE__); \
+		} while (false)
 
 	class ConsoleLogListener;
 	class FileLogListener;
 	class LevelLogFilter;
+	struct LogQueue;
 
 	class MYGUI_EXPORT LogManager
 	{
@@ -46,11 +53,33 @@ namespace MyGUI
 		static LogManager& getInstance();
 		static LogManager* getInstancePtr();
 
-		/** Call LogSource::flush() for all log sources. */
+		/** Call LogSource::flush() for all log sources.\n
+			In asynchronous mode waits until all queued messages are written.
+		*/
 		void flush();
-		/** Call LogSource::log for all log sources. */
+		/** Call LogSource::log for all log sources.\n
+			In asynchronous mode message is queued and written by background thread.
+		*/
 		void log(const std::string& _section, LogLevel _level, const std::string& _message, const char* _file, int _line);
 
+		/** Is there log source that accepts messages with this level. */
+		bool isLevelEnabled(LogLevel _level) const;
+
+		/** Write messages from background thread.\n
+			Messages are queued in ring buffer of _queueSize messages (rounded up to power of two),
+			messages that don't fit are dropped and counted. Critical messages are always waited for.
+			Log listeners are called from background thread in this mode.
+			Does nothing if engine is built without threads support.
+		*/
+		void setAsynchronous(bool _value, size_t _queueSize = 4096);
+		/** Are messages written from background thread. */
+		bool getAsynchronous() const;
+
+		/** Count of messages dropped because queue was full. */
+		size_t getDroppedCount() const;
+		/** Count of messages passed to log sources. */
+		size_t getWrittenCount() const;
+
 		/** Create default LevelLogFilter, FileLogListener and ConsoleLogListener. */
 		void createDefaultSource(const std::string& _logname);
 
@@ -66,12 +95,20 @@ namespace MyGUI
 		/** Get default LevelLogFilter level. */
 		LogLevel getLoggingLevel() const;
 
-		/** Add log source. */
+		/** Add log source.\n
+			In asynchronous mode waits until background thread finishes writing current messages.
+			isLevelEnabled reads sources without lock, so sources should be added before other threads start logging.
+		*/
 		void addLogSource(LogSource* _source);
 
 	private:
 		void close();
 
+		void writeMessage(const std::string& _section, LogLevel _level, time_t _time, const std::string& _message, const char* _file, int _line);
+		const struct tm* getTime(time_t _time);
+
+		void writeQueue();
+
 	private:
 		static LogManager* msInstance;
 
@@ -85,6 +122,14 @@ namespace MyGUI
 
 		LogLevel mLevel;
 		bool mConsoleEnable;
+
+		time_t mCachedTime;
+		struct tm mCachedTm;
+
+		LogQueue* mQueue;
+		volatile long mDroppedCount;
+		volatile long mReportedDroppedCount;
+		volatile long mWrittenCount;
 	};
 
 } // namespace MyGUI
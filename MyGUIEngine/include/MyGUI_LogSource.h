@@ -48,6 +48,8 @@ namespace MyGUI
 		void flush();
 		/** Call ILogListener::log for all listeners for messages that match LogSource filter (@see void setLogFilter(ILogFilter* _filter)). */
 		void log(const std::string& _section, LogLevel _level, const struct tm* _time, const std::string& _message, const char* _file, int _line);
+		/** Can messages with this level pass LogSource filter (@see ILogFilter::isLevelEnabled). */
+		bool isLevelEnabled(LogLevel _level) const;
 
 	private:
 		typedef vector<ILogListener*>::type VectorLogListeners;
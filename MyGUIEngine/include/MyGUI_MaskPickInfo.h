@@ -28,20 +28,37 @@
 namespace MyGUI
 {
 
+	struct MaskPickData;
+
 	class MYGUI_EXPORT MaskPickInfo
 	{
 	public:
 		MaskPickInfo();
+		MaskPickInfo(const MaskPickInfo& _other);
+		~MaskPickInfo();
+
+		MaskPickInfo& operator = (const MaskPickInfo& _other);
 
+		/** Load mask from image or from file saved with save().
+			Mask data is shared between all MaskPickInfo loaded from same file.
+		*/
 		bool load(const std::string& _file);
 
+		/** Save mask in packed format, that can be loaded without image decoding. */
+		bool save(const std::string& _file) const;
+
 		bool pick(const IntPoint& _point, const IntCoord& _coord) const;
 
 		bool empty() const;
 
+		/** Get size in bytes of mask data. */
+		size_t getDataSize() const;
+
+	private:
+		void setData(MaskPickData* _data);
+
 	private:
-		vector<uint8>::type data;
-		int width, height;
+		MaskPickData* mData;
 	};
 
 } // namespace MyGUI
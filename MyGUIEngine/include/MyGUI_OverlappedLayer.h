@@ -67,13 +67,17 @@ namespace MyGUI
 
 		virtual void resizeView(const IntSize& _viewSize);
 
-		bool isOutOfDate() const;
+		virtual void addDirtyRegion(DirtyRegion& _region);
+
+		virtual bool isOutOfDate() const;
 
 	protected:
 		bool mIsPick;
 		VectorILayerNode mChildItems;
 		bool mOutOfDate;
 		IntSize mViewSize;
+		// rectangle of destroyed or raised nodes
+		IntRect mDirtyRect;
 	};
 
 } // namespace MyGUI
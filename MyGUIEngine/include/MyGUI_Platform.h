@@ -71,6 +71,21 @@
 #	define MYGUI_FORCEINLINE __inline
 #endif
 
+// Find available SIMD instruction set
+#if !defined(MYGUI_DISABLE_SIMD)
+#	if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#		define MYGUI_USE_SSE
+#	endif
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		define MYGUI_USE_SSE2
+#	endif
+#endif
+
+// See if compiler supports rvalue references and noexcept
+#if (defined(__cplusplus) && __cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#	define MYGUI_USE_RVALUE_REFERENCES
+#endif
+
 
 // Windows settings
 #if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
@@ -76,6 +76,10 @@ namespace MyGUI
 		delegates::CMultiDelegate1<const std::string&>
 			eventChangeMousePointer;
 
+		/*internal:*/
+		// called by Gui at the beginning of frame
+		void notifyFrameStart(float _time);
+
 	private:
 		void _unlinkWidget(Widget* _widget);
 		void _load(xml::ElementPtr _node, const std::string& _file, Version _version);
@@ -91,7 +95,6 @@ namespace MyGUI
 
 		void Update();
 
-		void notifyFrameStart(float _time);
 		void notifyChangeMouseFocus(Widget* _widget);
 		void setPointer(const std::string& _name, Widget* _owner);
 
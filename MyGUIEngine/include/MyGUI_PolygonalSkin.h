@@ -41,6 +41,18 @@ namespace MyGUI
 
 		/** Set line points. */
 		void setPoints(const vector<FloatPoint>::type& _points);
+		/** Set line points.
+			@param _points Pointer to first point, points are copied into internal buffer that is reused between calls.
+			@param _count Count of points.
+		*/
+		void setPoints(const FloatPoint* _points, size_t _count);
+
+		/** Set several independent lines, that are rendered as one draw item.
+			@param _points Points of all lines one after another.
+			@param _sizes Count of points in each line.
+			@param _linesCount Count of lines.
+		*/
+		void setLines(const FloatPoint* _points, const size_t* _sizes, size_t _linesCount);
 
 		/** Set line width in pixels. */
 		void setWidth(float _width);
@@ -68,6 +80,9 @@ namespace MyGUI
 
 	protected:
 		void _rebuildGeometry();
+		void _addLine(const FloatPoint* _points, size_t _count);
+		void _updateVertexCount();
+		void _buildLineGeometry(const FloatPoint* _points, size_t _count, float _length, const FloatPoint* _baseVerticiesUV);
 		FloatPoint _getPerpendicular(const FloatPoint& _point1, const FloatPoint& _point2);
 		// line from center of p1-p2 line to p3
 		FloatPoint _getMiddleLine(const FloatPoint& _point1, const FloatPoint& _point2, const FloatPoint& _point3);
@@ -76,11 +91,16 @@ namespace MyGUI
 		bool mGeometryOutdated;
 
 		float mLineWidth;
+		// points of all lines one after another
 		vector<FloatPoint>::type mLinePoints;
-		float mLineLength;
+		vector<size_t>::type mLineSizes;
+		vector<float>::type mLineLengths;
 
 		vector<FloatPoint>::type mResultVerticiesPos;
 		vector<FloatPoint>::type mResultVerticiesUV;
+		// buffers for cropped geometry, swapped with result on every rebuild to keep memory
+		vector<FloatPoint>::type mCroppedVerticiesPos;
+		vector<FloatPoint>::type mCroppedVerticiesUV;
 
 		size_t mVertexCount;
 
@@ -106,7 +106,8 @@ namespace MyGUI
 			Stream = MYGUI_FLAG(2),
 			Read = MYGUI_FLAG(3),
 			Write = MYGUI_FLAG(4),
-			RenderTarget = MYGUI_FLAG(5)
+			RenderTarget = MYGUI_FLAG(5),
+			DistanceField = MYGUI_FLAG(6) // alpha holds signed distance field, see texture_utility::generateDistanceField
 		};
 
 		TextureUsage(Enum _value = Default) :
@@ -35,6 +35,7 @@ namespace MyGUI
 	typedef vector<DrawItemInfo>::type VectorDrawItem;
 
     class RotatingSkin;
+	class DirtyRegion;
 
 	class MYGUI_EXPORT RenderItem
 	{
@@ -71,6 +72,14 @@ namespace MyGUI
 
 		bool getCompression();
 
+		/** Rectangle in layer coordinates covered by vertices of last render. */
+		const IntRect& getRenderRect() const;
+		/** Add rectangles that change on next render, if render item is out of date. */
+		void addDirtyRegion(DirtyRegion& _region) const;
+
+	private:
+		static IntRect getDrawItemRect(ISubWidget* _item);
+
 	private:
 #if MYGUI_DEBUG_MODE == 1
 		std::string mTextureName;
@@ -97,6 +106,8 @@ namespace MyGUI
 		bool mManualRender;
 
         RotatingSkin* mRotatingSkin;
+
+		IntRect mRenderRect;
 	};
 
 } // namespace MyGUI
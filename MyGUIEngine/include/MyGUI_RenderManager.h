@@ -61,6 +61,11 @@ namespace MyGUI
 		/** Check if texture format supported by hardware */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
 
+		/** Check if platform restricts output to dirty rectangles and keeps previous frame outside of them,
+			see LayerManager::setPartialRedraw. False by default.
+		*/
+		virtual bool isPartialRedrawSupported() const;
+
 #if MYGUI_DEBUG_MODE == 1
 		/** Check if texture is valid */
 		virtual bool checkTexture(ITexture* _texture);
@@ -70,6 +75,12 @@ namespace MyGUI
 		virtual void onResizeView(const IntSize& _viewSize);
 		virtual void onRenderToTarget(IRenderTarget* _target, bool _update);
 		virtual void onFrameEvent(float _time);
+
+		/** Prepare fonts and collect changed rectangles of layers, see LayerManager::updateDirtyRegion.
+			Call between onFrameEvent and onRenderToTarget.
+			@return false if frame would be the same as previous one and rendering can be skipped
+		*/
+		virtual bool onPrepareFrame(bool _update);
 	};
 
 } // namespace MyGUI
@@ -27,6 +27,8 @@
 namespace MyGUI
 {
 
+	class DirtyRegion;
+
 	struct MYGUI_EXPORT RenderTargetInfo
 	{
 	public:
@@ -38,7 +40,8 @@ namespace MyGUI
 			vOffset(0),
 			aspectCoef(1),
 			leftOffset(0),
-			topOffset(0)
+			topOffset(0),
+			dirtyRegion(nullptr)
 		{
 		}
 
@@ -48,6 +51,12 @@ namespace MyGUI
 			topOffset = _top;
 		}
 
+		// render items outside of region are not drawn, nullptr to draw everything
+		void setDirtyRegion(const DirtyRegion* _region) const
+		{
+			dirtyRegion = _region;
+		}
+
 	public:
 		float maximumDepth;
 		float pixScaleX;
@@ -58,6 +67,8 @@ namespace MyGUI
 
 		mutable int leftOffset;
 		mutable int topOffset;
+
+		mutable const DirtyRegion* dirtyRegion;
 	};
 
 
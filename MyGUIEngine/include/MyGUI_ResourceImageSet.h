@@ -58,6 +58,9 @@ namespace MyGUI
 
 		void AddGroupImage(const GroupImage& _group);
 
+		/** Move groups with _oldTexture to _texture where _oldTexture lies at _point. Used by TextureAtlasBaker. */
+		void replaceTexture(const std::string& _oldTexture, const std::string& _texture, const IntPoint& _point);
+
 	private:
 		ResourceImageSet();
 		virtual ~ResourceImageSet();
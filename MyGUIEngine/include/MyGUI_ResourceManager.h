@@ -85,9 +85,19 @@ namespace MyGUI
 
 		const std::string& getCategoryName() const;
 
+		/** Parse files from List tag on several threads.
+			Files are still loaded into managers on calling thread and in the order of the list,
+			so result is the same as with sequential loading. Enabled by default, does nothing
+			when engine is built without MYGUI_USE_THREADS or there is only one hardware thread.
+		*/
+		void setParallelLoading(bool _value);
+		bool getParallelLoading() const;
+
 	private:
 		void _loadList(xml::ElementPtr _node, const std::string& _file, Version _version);
+		size_t _loadListParallel(const VectorString& _files);
 		bool _loadImplement(const std::string& _file, bool _match, const std::string& _type, const std::string& _instance);
+		bool _loadDocument(xml::Document& _doc, const std::string& _file, bool _match, const std::string& _type, const std::string& _instance);
 
 	private:
 		// карта с делегатами для парсинга хмл блоков
@@ -100,6 +110,7 @@ namespace MyGUI
 		VectorResource mRemovedResoures;
 
 		bool mIsInitialise;
+		bool mParallelLoading;
 		std::string mCategoryName;
 		std::string mXmlListTagName;
 	};
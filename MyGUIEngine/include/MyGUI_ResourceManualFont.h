@@ -57,11 +57,16 @@ namespace MyGUI
 		// Loads the texture specified by mSource.
 		void loadTexture();
 
+		// Copies glyphs from mTexture to pages of FontManager::getGlyphAtlas(), so text in this font is batched with text in
+		// other fonts. The source texture is destroyed if this font created it. Keeps mTexture if it can't be read.
+		void copyToGlyphAtlas(bool _ownTexture);
+
 		// A map of code points to glyph info objects.
 		typedef map<Char, GlyphInfo>::type CharMap;
 
 		// The following variables are set directly from values specified by the user.
 		std::string mSource; // Source (filename) of the font.
+		bool mSharedAtlas; // Whether or not to copy glyphs to the glyph atlas shared by all fonts.
 
 		// The following variables are calculated automatically.
 		int mDefaultHeight; // The nominal height of the font in pixels.
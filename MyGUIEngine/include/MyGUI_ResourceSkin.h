@@ -52,6 +52,11 @@ namespace MyGUI
 		const VectorChildSkinInfo& getChild() const;
 		const std::string& getSkinName() const;
 
+		/** Move skin to _texture where its current texture lies at _coord. Used by TextureAtlasBaker.
+			@return false if skin has states with unknown texture coordinates, skin isn't changed then
+		*/
+		bool replaceTexture(const std::string& _texture, const IntCoord& _coord);
+
 	private:
 		void setInfo(const IntSize& _size, const std::string& _texture);
 		void addInfo(const SubWidgetBinding& _bind);
@@ -35,15 +35,7 @@ namespace MyGUI
 {
 
     struct FontDataImpl;
-
-    struct GlyphTexture
-    {
-        ITexture* mTexture;
-        uint8* mMemory;
-        bool mDirty;
-
-        GlyphTexture() : mTexture(nullptr), mMemory(nullptr), mDirty(false) {}
-    };
+    struct GlyphRenderQueue;
 
 	class MYGUI_EXPORT ResourceTrueTypeFont :
 		public IFont
@@ -69,6 +61,30 @@ namespace MyGUI
 
         virtual void prepareTexture();
 
+		virtual bool hasPendingGlyphs() const;
+
+		// Statistics of asynchronous glyph rendering. Latency is measured in milliseconds from the request in prepareString to
+		// the commit into the texture in prepareTexture.
+		struct AsyncStatistics
+		{
+			AsyncStatistics() :
+				requested(0),
+				committed(0),
+				failed(0),
+				latencyTotal(0),
+				latencyMax(0)
+			{
+			}
+
+			size_t requested;
+			size_t committed;
+			size_t failed;
+			unsigned long latencyTotal;
+			unsigned long latencyMax;
+		};
+
+		const AsyncStatistics& getAsyncStatistics() const;
+
 		// Returns a collection of code-point ranges that are supported by this font. Each range is specified as [first, second];
 		// for example, a range containing a single code point will have the same value for both first and second.
 		vector<std::pair<Char, Char> >::type getCodePointRanges() const;
@@ -90,6 +106,25 @@ namespace MyGUI
 		void setSubstituteCode(int _value);
 		void setDistance(int _value);
 
+		// Render glyphs missing in prepareString on a background thread with its own FreeType face. The substitute glyph is used
+		// until the glyph is committed into the texture on one of the next frames. Ignored when the engine is built without
+		// MYGUI_USE_THREADS.
+		void setAsynchronous(bool _value);
+		bool getAsynchronous() const;
+
+		// Store glyphs as signed distance fields instead of coverage. Glyphs are rasterised once at the font size and can be drawn
+		// at any other size with FontHeight or with fonts that use this one as DistanceFieldBase. Textures are created with
+		// TextureUsage::DistanceField, render systems turn the field into alpha when drawing them.
+		void setDistanceField(bool _value);
+		bool getDistanceField() const;
+
+		// Distance in pixels around the glyph edge that is kept in the field.
+		void setDistanceFieldSpread(int _value);
+
+		// Name of a distance field font this font is scaled from. Such font doesn't load the source and has no own textures, it
+		// shares glyphs of the base font and scales them to own size. The base font must be loaded before this font.
+		void setDistanceFieldBase(const std::string& _value);
+
         void addCodePointRange(Char _first, Char _second) {}
         void removeCodePointRange(Char _first, Char _second) {}
 
@@ -98,13 +133,9 @@ namespace MyGUI
         FontDataImpl* mFontDataImpl;
         FT_Face mFontFace;
 
-        typedef list<GlyphTexture*>::type GlyphTextureAltas;
-        GlyphTextureAltas mGlyphTextureAtlas;
-
-        GlyphTexture* mCurGlyphTexture;
-
-        uint mPtNextX, mPtNextY;
-        uint mTextureSize;
+        // Page of FontManager::getGlyphAtlas() with the first glyph of the font. Glyphs are allocated on shared pages and may
+        // lie on several of them, each GlyphInfo keeps its own texture.
+        ITexture* mTexture;
 
         int mFontAscent, mFontDescent;
         FT_Int32 mFtLoadFlags;
@@ -134,10 +165,19 @@ namespace MyGUI
 		float mTabWidth; // The width of the "Tab" special character, in pixels.
 		int mOffsetHeight; // How far up to nudge text rendered in this font, in pixels. May be negative to nudge text down.
 		Char mSubstituteCodePoint; // The code point to use as a substitute for code points that don't exist in the font.
+		bool mAsynchronous; // Whether or not to render glyphs requested by prepareString on a background thread.
+		bool mDistanceField; // Whether or not to store glyphs as signed distance fields.
+		int mDistanceFieldSpread; // Distance in pixels kept around glyph edges in the distance field.
+		std::string mDistanceFieldBase; // Name of the distance field font that provides glyphs for this font.
 
 		// The following variables are calculated automatically.
 		int mDefaultHeight; // The nominal height of the font in pixels.
 		GlyphInfo* mSubstituteGlyphInfo; // The glyph info to use as a substitute for code points that don't exist in the font.
+		GlyphRenderQueue* mRenderQueue; // Background renderer, created on first asynchronous request.
+		set<Char>::type mRequestedGlyphs; // Code points that were passed to the background renderer.
+		AsyncStatistics mAsyncStatistics;
+		ResourceTrueTypeFont* mBaseFont; // Distance field font that provides glyphs, or nullptr if this font renders its own.
+		float mBaseScale; // Size of this font relative to the size of mBaseFont.
 
 		// The following constants used to be mutable, but they no longer need to be. Do not modify their values!
 		static const int mDefaultGlyphSpacing; // How far apart the glyphs are placed from each other in the font texture, in pixels.
@@ -161,8 +201,19 @@ namespace MyGUI
 
         void cleanupGlyphTextureAtlas();
 
-        template<bool LAMode>
-        GlyphTexture* createFontTexture();
+		// Initialises this font as scaled view of mDistanceFieldBase. Returns false if the base font is not a distance field font.
+		bool initialiseBase();
+
+		// Returns the glyph of mBaseFont scaled to the size of this font.
+		GlyphInfo* getBaseGlyphInfo(Char _id);
+
+		// Creates the background renderer. Returns false if threads are not available, asynchronous rendering is disabled then.
+		bool startRenderQueue();
+		void stopRenderQueue();
+
+		// Copies glyphs rendered in background into the texture atlas.
+		template<bool LAMode, bool Antialias>
+		bool commitGlyphs();
 
 		// Creates a GlyphInfo object using the specified information.
 		GlyphInfo createFaceGlyphInfo(Char _codePoint, int _fontAscent, FT_GlyphSlot _glyph);
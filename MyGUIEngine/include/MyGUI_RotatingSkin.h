@@ -83,6 +83,8 @@ namespace MyGUI
 		bool mGeometryOutdated;
 
 		float mAngle;
+		float mAngleSin;
+		float mAngleCos;
 		FloatPoint mCenterPos;
 
 #ifndef MYGUI_RENDER_UE
@@ -27,6 +27,8 @@
 namespace MyGUI
 {
 
+	struct FactoryItem;
+
 	// информация, об одном сабвиджете
 	struct SubWidgetInfo
 	{
@@ -34,7 +36,8 @@ namespace MyGUI
 		SubWidgetInfo(const std::string& _type, const IntCoord& _coord, Align _align) :
 			coord(_coord),
 			align(_align),
-			type(_type)
+			type(_type),
+			factory(nullptr)
 		{
 		}
 
@@ -42,6 +45,8 @@ namespace MyGUI
 		IntCoord coord;
 		Align align;
 		std::string type;
+		// фабрика сабвиджета, чтобы не искать по имени при создании
+		FactoryItem* factory;
 	};
 
 	typedef vector<SubWidgetInfo>::type VectorSubWidgetInfo;
@@ -20,6 +20,13 @@ namespace MyGUI
 		TextView();
 
 		void update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
+		/** Update with already known text kind, _tagged is result of isTagged for _text. */
+		void update(const UString& _text, bool _tagged, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
+
+		/** Is text contain colour tags, texts without them use faster layout. */
+		static bool isTagged(const UString& _text);
+		/** Is last updated text contain colour tags. */
+		bool isTagged() const;
 
 		size_t getCursorPosition(const IntPoint& _value);
 
@@ -31,11 +38,16 @@ namespace MyGUI
 
 		const VectorLineInfo& getData() const;
 
+	private:
+		template <bool Tagged>
+		void updateText(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth);
+
 	private:
 		IntSize mViewSize;
 		size_t mLength;
 		VectorLineInfo mLineInfo;
 		int mFontHeight;
+		bool mTagged;
 	};
 
 } // namespace MyGUI
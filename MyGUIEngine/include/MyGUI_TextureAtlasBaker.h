@@ -0,0 +1,124 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_TEXTURE_ATLAS_BAKER_H__
+#define __MYGUI_TEXTURE_ATLAS_BAKER_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_GlyphAtlas.h"
+
+namespace MyGUI
+{
+
+	class ResourceSkin;
+	class ResourceImageSet;
+
+	/** Packs textures of skins and image sets into shared pages, so widgets with different skins are drawn in one batch.
+		Skins and image sets are moved to pages, widgets created before bake() keep old textures.
+
+		Example of load-time bake:
+		@code
+		MyGUI::TextureAtlasBaker* baker = new MyGUI::TextureAtlasBaker();
+		baker->addAllResources();
+		baker->bake();
+		@endcode
+		Baker owns pages made by bake() and must live while widgets use them.
+
+		Offline bake is saved by save() and applied later by load(), that only loads pages and moves resources.
+	*/
+	class MYGUI_EXPORT TextureAtlasBaker
+	{
+	public:
+		struct Statistics
+		{
+			Statistics() :
+				textures(0),
+				bakedTextures(0),
+				pages(0),
+				skins(0),
+				imageSets(0)
+			{
+			}
+
+			/** Different textures of added resources. */
+			size_t textures;
+			/** Textures put on pages. */
+			size_t bakedTextures;
+			size_t pages;
+			/** Skins moved to pages. */
+			size_t skins;
+			/** Image sets moved to pages. */
+			size_t imageSets;
+		};
+
+	public:
+		TextureAtlasBaker();
+		~TextureAtlasBaker();
+
+		void addSkin(ResourceSkin* _skin);
+		void addImageSet(ResourceImageSet* _imageSet);
+		/** Add all skins and image sets loaded in ResourceManager. */
+		void addAllResources();
+
+		/** Copy textures of added resources to pages and move resources to them.
+			Textures bigger than page, with unknown format or that can't be read stay separate.
+			@return false if no texture was put on a page
+		*/
+		bool bake();
+
+		/** Save pages made by bake() next to _fileName and save their layout to xml file _fileName. */
+		bool save(const std::string& _fileName);
+		/** Move added resources to pages saved by save(). */
+		bool load(const std::string& _fileName);
+
+		/** Size of pages in pixels, 2048 by default. */
+		void setPageSize(int _value);
+		int getPageSize() const;
+
+		const Statistics& getStatistics() const;
+
+	private:
+		struct Placement
+		{
+			std::string page;
+			/** Texture on the page, without border. */
+			IntCoord coord;
+		};
+		typedef map<std::string, Placement>::type MapPlacement;
+
+		typedef vector<ResourceSkin*>::type VectorSkin;
+		typedef vector<ResourceImageSet*>::type VectorImageSet;
+
+		void collectTextures(set<std::string>::type& _textures) const;
+		bool copyTexture(const std::string& _texture, Placement& _placement);
+		void replaceTextures();
+
+	private:
+		GlyphAtlas mAtlas;
+		MapPlacement mPlacements;
+		VectorSkin mSkins;
+		VectorImageSet mImageSets;
+		Statistics mStatistics;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_TEXTURE_ATLAS_BAKER_H__
@@ -35,6 +35,22 @@ namespace MyGUI
 		MYGUI_EXPORT const IntSize& getTextureSize(const std::string& _texture, bool _cache = true);
 		MYGUI_EXPORT uint32 toColourARGB(const Colour& _colour);
 
+		/** Generate signed distance field from 8 bit coverage bitmap.
+			@param _source Coverage, pixels with value 128 and above are inside of the shape
+			@param _dest Field of _destWidth x _destHeight bytes, source is placed with offset _spread at both axes
+			@param _spread Distance in pixels that maps to the full range, 128 is the edge, 255 and 0 are
+				_spread pixels or more inside and outside of the shape
+		*/
+		MYGUI_EXPORT void generateDistanceField(
+			const uint8* _source,
+			int _sourceWidth,
+			int _sourceHeight,
+			int _sourcePitch,
+			uint8* _dest,
+			int _destWidth,
+			int _destHeight,
+			int _spread);
+
 		MYGUI_FORCEINLINE void convertColour(uint32& _colour, VertexColourType _format)
 		{
 			if (_format == VertexColourType::ColourABGR)
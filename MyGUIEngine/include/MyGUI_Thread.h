@@ -0,0 +1,138 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_THREAD_H__
+#define __MYGUI_THREAD_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Delegate.h"
+
+namespace MyGUI
+{
+
+	/** Minimal threading primitives used by engine.
+		Without MYGUI_USE_THREADS all of them are no-ops and Thread::start() fails,
+		so users have to keep synchronous fallback.
+	*/
+	class MYGUI_EXPORT Mutex
+	{
+	public:
+		Mutex();
+		~Mutex();
+
+		void lock();
+		void unlock();
+
+	private:
+		Mutex(const Mutex&);
+		Mutex& operator = (const Mutex&);
+
+	private:
+		void* mHandle;
+	};
+
+	class MutexLock
+	{
+	public:
+		explicit MutexLock(Mutex& _mutex) :
+			mMutex(_mutex)
+		{
+			mMutex.lock();
+		}
+
+		~MutexLock()
+		{
+			mMutex.unlock();
+		}
+
+	private:
+		MutexLock(const MutexLock&);
+		MutexLock& operator = (const MutexLock&);
+
+	private:
+		Mutex& mMutex;
+	};
+
+	/** Auto reset event, set() wakes one waiting thread or next wait() call. */
+	class MYGUI_EXPORT ThreadEvent
+	{
+	public:
+		ThreadEvent();
+		~ThreadEvent();
+
+		void set();
+		void wait();
+
+	private:
+		ThreadEvent(const ThreadEvent&);
+		ThreadEvent& operator = (const ThreadEvent&);
+
+	private:
+		void* mHandle;
+	};
+
+	class MYGUI_EXPORT Thread
+	{
+	public:
+		typedef delegates::CDelegate0 ThreadDelegate;
+
+		Thread();
+		/** Waits for thread if it is running. */
+		~Thread();
+
+		/** Start thread executing _delegate.
+			@return false if thread can't be started (for example built without MYGUI_USE_THREADS)
+		*/
+		bool start(ThreadDelegate::IDelegate* _delegate);
+		/** Wait until thread finishes. */
+		void join();
+
+		bool isRunning() const;
+
+		/** Is engine built with threads support. */
+		static bool isSupported();
+		/** Number of hardware threads, 1 if unknown. */
+		static size_t getHardwareConcurrency();
+
+	private:
+		Thread(const Thread&);
+		Thread& operator = (const Thread&);
+
+	private:
+		ThreadDelegate mDelegate;
+		void* mHandle;
+	};
+
+	/** Atomic operations with full memory barrier. */
+	namespace atomic
+	{
+		/** Increment value, returns new value. */
+		MYGUI_EXPORT long increment(volatile long& _value);
+		/** Decrement value, returns new value. */
+		MYGUI_EXPORT long decrement(volatile long& _value);
+		/** Set value to _exchange if it equals _comparand, returns initial value. */
+		MYGUI_EXPORT long compareExchange(volatile long& _value, long _exchange, long _comparand);
+		MYGUI_EXPORT long load(volatile long& _value);
+		MYGUI_EXPORT void store(volatile long& _value, long _new);
+	}
+
+} // namespace MyGUI
+
+#endif // __MYGUI_THREAD_H__
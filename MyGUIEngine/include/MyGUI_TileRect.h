@@ -79,12 +79,6 @@ namespace MyGUI
 		IntSize mTileSize;
 		size_t mCountVertex;
 
-		float mRealTileWidth;
-		float mRealTileHeight;
-
-		float mTextureHeightOne;
-		float mTextureWidthOne;
-
 		bool mTileH;
 		bool mTileV;
 	};
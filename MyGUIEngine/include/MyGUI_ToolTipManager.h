@@ -45,9 +45,12 @@ namespace MyGUI
 		/*internal:*/
 		void _unlinkWidget(Widget* _widget);
 
-	private:
+		// called by Gui at the beginning of frame
 		void notifyEventFrameStart(float _time);
+		/** Seconds till tool tip is shown, 0 if mouse focus changed, -1 if nothing is waited */
+		float _getNextFrameDelay() const;
 
+	private:
 		void hideToolTip(Widget* _widget);
 		void showToolTip(Widget* _widget, size_t _index, const IntPoint& _point);
 		void moveToolTip(Widget* _widget, size_t _index, const IntPoint& _point);
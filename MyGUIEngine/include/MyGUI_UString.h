@@ -514,6 +514,7 @@ namespace MyGUI
 		//!\name Stream variations
 		//@{
 		//! returns the current string in UTF-8 form within a std::string
+		/*! The result is cached until the string is modified, a string assigned from UTF-8 keeps its source and returns it without conversion. */
 		const std::string& asUTF8() const;
 		//! returns the current string in UTF-8 form as a nul-terminated char array
 		const char* asUTF8_c_str() const;
@@ -647,6 +648,7 @@ namespace MyGUI
 		UString& insert( size_type index, const UString& str );
 		//! inserts \a str into the current string, at location \a index
 		UString& insert( size_type index, const code_point* str ) {
+			_dataChanged();
 			mData.insert( index, str );
 			return *this;
 		}
@@ -943,6 +945,8 @@ namespace MyGUI
 		static size_type _verifyUTF8( const unsigned char* c_str );
 		//! verifies a UTF-8 stream, returning the total number of Unicode characters found
 		static size_type _verifyUTF8( const std::string& str );
+		//! returns \c true if all \a num bytes of \a c_str are 7 bit ASCII characters, such data needs no UTF-8 decoding
+		static bool _isASCII( const char* c_str, size_type num );
 		//@}
 
 	private:
@@ -960,6 +964,15 @@ namespace MyGUI
 		//! common constructor operations
 		void _init();
 
+		//! drops the cached UTF-8 form, called by every member that modifies the data
+		void _dataChanged();
+		//! the whole data is replaced, references and iterators handed out before are no longer valid
+		void _dataReplaced();
+		//! a writable reference or iterator is handed out, the UTF-8 form isn't cached until the data is replaced
+		void _dataExposed();
+		//! keeps \a num bytes of \a c_str as the cached UTF-8 form of the data
+		void _storeUTF8( const char* c_str, size_type num ) const;
+
 		///////////////////////////////////////////////////////////////////////
 		// Scratch buffer
 		//! auto cleans the scratch buffer using the proper delete for the stored type
@@ -976,8 +989,15 @@ namespace MyGUI
 		void _load_buffer_WStr() const;
 		void _load_buffer_UTF32() const;
 
+		//! returns \c true if all code points are 7 bit ASCII characters
+		bool _isASCII() const;
+		//! returns \c true if string contains surrogate pairs
+		bool _hasSurrogates() const;
+
 		mutable BufferType m_bufferType; // identifies the data type held in m_buffer
 		mutable size_t m_bufferSize; // size of the CString buffer
+		mutable bool m_bufferUTF8Valid; // m_buffer holds the UTF-8 form of the current data
+		bool m_dataExposed; // writable references to mData were handed out, see _dataExposed()
 
 		// multi-purpose buffer used everywhere we need a throw-away buffer
 		union {
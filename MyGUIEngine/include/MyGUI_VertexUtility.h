@@ -0,0 +1,126 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef __MYGUI_VERTEX_UTILITY_H__
+#define __MYGUI_VERTEX_UTILITY_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_VertexData.h"
+#include "MyGUI_RenderTargetInfo.h"
+
+namespace MyGUI
+{
+
+	namespace vertex_utility
+	{
+
+		/** One rectangle for writeQuads. */
+		struct QuadInfo
+		{
+			FloatRect vertex;
+			FloatRect texture;
+			uint32 colour;
+		};
+
+		/** Linear transform of vertex rectangles, x * scaleX + offsetX and y * scaleY + offsetY. */
+		struct QuadTransform
+		{
+			/** Identity transform, for rectangles already in render target coordinates. */
+			QuadTransform() :
+				scaleX(1),
+				scaleY(1),
+				offsetX(0),
+				offsetY(0)
+			{
+			}
+
+			/** Transform from pixels to render target coordinates.
+				@param _left Pixel added to x before transform
+				@param _top Pixel added to y before transform
+			*/
+			QuadTransform(const RenderTargetInfo& _info, float _left, float _top);
+
+			float scaleX;
+			float scaleY;
+			float offsetX;
+			float offsetY;
+		};
+
+		/** Transform and write _count quads to vertex buffer, VertexQuad::VertexCount verticies per quad.
+			Uses SSE when it's available.
+		*/
+		MYGUI_EXPORT void writeQuads(Vertex* _vertex, const QuadInfo* _quads, size_t _count, float _z, const QuadTransform& _transform);
+
+		/** Collects quads and writes them to vertex buffer by batches with writeQuads. */
+		class MYGUI_EXPORT QuadWriter
+		{
+		public:
+			QuadWriter(Vertex* _vertex, float _z, const QuadTransform& _transform) :
+				mVertex(_vertex),
+				mZ(_z),
+				mTransform(_transform),
+				mCount(0),
+				mVertexCount(0)
+			{
+			}
+
+			void add(const FloatRect& _vertex, const FloatRect& _texture, uint32 _colour)
+			{
+				QuadInfo& quad = mQuads[mCount];
+				quad.vertex = _vertex;
+				quad.texture = _texture;
+				quad.colour = _colour;
+
+				if (++mCount == BatchSize)
+					flush();
+			}
+
+			/** Write collected quads, must be called before vertex count is used. */
+			void flush()
+			{
+				writeQuads(mVertex, mQuads, mCount, mZ, mTransform);
+				mVertex += mCount * VertexQuad::VertexCount;
+				mVertexCount += mCount * VertexQuad::VertexCount;
+				mCount = 0;
+			}
+
+			/** Count of written verticies. */
+			size_t getVertexCount() const
+			{
+				return mVertexCount;
+			}
+
+		private:
+			enum { BatchSize = 64 };
+
+			Vertex* mVertex;
+			float mZ;
+			QuadTransform mTransform;
+			QuadInfo mQuads[BatchSize];
+			size_t mCount;
+			size_t mVertexCount;
+		};
+
+	} // namespace vertex_utility
+
+} // namespace MyGUI
+
+#endif // __MYGUI_VERTEX_UTILITY_H__
@@ -189,6 +189,16 @@ namespace MyGUI
 		/** Get inherits alpha mode flag */
 		bool getInheritsAlpha() const;
 
+		/** Enable or disable cache as bitmap mode.\n
+			Widget with all its children is rendered to texture once and drawn with single quad
+			until something in it changes. Useful for complex windows that rarely change.
+			Works only for root widgets on layers where each root widget has its own node (overlapped layers).\n
+			Disabled (false) by default.
+		*/
+		void setCacheToTexture(bool _value);
+		/** Get cache as bitmap mode flag */
+		bool getCacheToTexture() const;
+
 		void setColour(const Colour& _value);
 
 		// являемся ли мы рутовым виджетом
@@ -323,6 +333,10 @@ namespace MyGUI
 		void _setAlign(const IntSize& _oldsize, const IntSize& _newSize);
 		bool _checkPoint(int _left, int _top) const;
 
+		/** Apply coordinate changes postponed in deferred layout mode, see WidgetManager::setDeferredLayout */
+		void _updateLayout();
+		bool _isLayoutDirty() const;
+
 		Widget* _createSkinWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer = "", const std::string& _name = "");
 
 		// сброс всех данных контейнера, тултипы и все остальное
@@ -363,6 +377,9 @@ namespace MyGUI
 
 		void _updateView(); // обновления себя и детей
 
+		/** True if widget is fully outside of its cropped parent and its subtree is hidden */
+		bool _isCulled() const;
+
 		// создает виджет
 		Widget* baseCreateWidget(WidgetStyle _style, const std::string& _type, const std::string& _skin, const IntCoord& _coord, Align _align, const std::string& _layer, const std::string& _name, bool _template);
 
@@ -413,6 +430,15 @@ namespace MyGUI
 		void _updateAlpha();
 		void _updateAbsolutePoint();
 
+		// hides the subtree once when it leaves the view, culled children are already hidden
+		void _cullView();
+		void _uncullView();
+
+		// in deferred layout mode remembers coordinate before the first change in frame, returns true if change is postponed
+		bool _deferLayout();
+		// coordinate before postponed changes, alignment of children is calculated from it, clears the change
+		IntCoord _takeLayoutOldCoord();
+
 		// для внутреннего использования
 		void _updateVisible();
 
@@ -432,6 +458,9 @@ namespace MyGUI
 		void setSkinProperty(ResourceSkin* _info);
 
 		virtual void resizeLayerItemView(const IntSize& _oldView, const IntSize& _newView);
+		virtual void attachItemToNode(ILayer* _layer, ILayerNode* _node);
+
+		void _updateCacheToTexture();
 
 	private:
 		// клиентская зона окна
@@ -468,6 +497,19 @@ namespace MyGUI
 		Align mAlign;
 		bool mVisible;
 
+		// subtree is hidden while widget is outside of cropped parent, see _cullView
+		bool mIsCulled;
+		// absolute positions of children weren't updated while widget was culled
+		bool mIsCulledPositionDirty;
+
+		// coordinate was changed in deferred layout mode and children are not aligned yet
+		bool mLayoutDirty;
+		// widget is in the queue of WidgetManager
+		bool mLayoutQueued;
+		IntCoord mLayoutOldCoord;
+
+		bool mCacheToTexture;
+
 		void* mHandler;
 
         std::string mMousePressEvent;
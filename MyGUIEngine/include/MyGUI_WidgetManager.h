@@ -61,14 +61,31 @@ namespace MyGUI
 		/** Check if factory with specified widget type exist */
 		bool isFactoryExist(const std::string& _type);
 
+		/** Enable deferred layout mode.
+			In this mode setCoord, setSize and setPosition only store new coordinate and mark widget,
+			children are aligned once per frame in Gui::frameEvent. Disabled by default.
+			Disabling the mode applies all postponed changes.
+		*/
+		void setDeferredLayout(bool _value);
+		/** Get deferred layout mode */
+		bool getDeferredLayout() const;
+
 		/*internal:*/
 		void _deleteWidget(Widget* _widget);
 		void _deleteDelayWidgets();
 
-		const std::string& getCategoryName() const;
+		/** Align all widgets changed in deferred layout mode, parents go first */
+		void _updateLayout();
+		bool _isLayoutDeferred() const;
+		void _addLayoutWidget(Widget* _widget);
+		void _removeLayoutWidget(Widget* _widget);
 
-	private:
+		// called by Gui at the beginning of frame
 		void notifyEventFrameStart(float _time);
+		/** 0 if widgets wait for delayed destruction or deferred layout, -1 otherwise */
+		float _getNextFrameDelay() const;
+
+		const std::string& getCategoryName() const;
 
 	private:
 		bool mIsInitialise;
@@ -79,6 +96,11 @@ namespace MyGUI
 
 		// список виджетов для удаления
 		VectorWidgetPtr mDestroyWidgets;
+
+		bool mDeferredLayout;
+		bool mLayoutUpdating;
+		// widgets with postponed coordinate changes
+		VectorWidgetPtr mLayoutWidgets;
 	};
 
 } // namespace MyGUI
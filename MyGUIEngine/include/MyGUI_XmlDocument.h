@@ -354,6 +354,9 @@ namespace MyGUI
 
 			bool parseLine(std::string& _line, ElementPtr& _element);
 
+			// разбирает очередную строку из файла
+			bool parseReadLine(std::string& _read, std::string& _line, ElementPtr& _element);
+
 			// ищет символ без учета ковычек
 			size_t find(const std::string& _text, char _char, size_t _start = 0);
 
@@ -29,35 +29,61 @@ namespace MyGUI
 	Any::AnyEmpty Any::Null;
 
 	Any::Any() :
-		mContent(nullptr)
+		mInPlaceType(nullptr)
 	{
+		mStorage.content = nullptr;
 	}
 
 	Any::Any(const Any::AnyEmpty& value) :
-		mContent(nullptr)
+		mInPlaceType(nullptr)
 	{
+		mStorage.content = nullptr;
 	}
 
 	Any::Any(const Any& other) :
-		mContent(other.mContent ? other.mContent->clone() : nullptr)
+		mInPlaceType(other.mInPlaceType)
 	{
+		if (mInPlaceType != nullptr)
+			mStorage = other.mStorage;
+		else
+			mStorage.content = other.mStorage.content ? other.mStorage.content->clone() : nullptr;
 	}
 
+#ifdef MYGUI_USE_RVALUE_REFERENCES
+	Any::Any(Any&& other) noexcept :
+		mInPlaceType(other.mInPlaceType),
+		mStorage(other.mStorage)
+	{
+		other.mInPlaceType = nullptr;
+		other.mStorage.content = nullptr;
+	}
+
+	Any& Any::operator = (Any&& rhs) noexcept
+	{
+		Any(static_cast<Any&&>(rhs)).swap(*this);
+		return *this;
+	}
+#endif
+
 	Any::~Any()
 	{
-		delete mContent;
+		if (mInPlaceType == nullptr)
+			delete mStorage.content;
 	}
 
 	Any& Any::swap(Any& rhs)
 	{
-		std::swap(mContent, rhs.mContent);
+		std::swap(mInPlaceType, rhs.mInPlaceType);
+		std::swap(mStorage, rhs.mStorage);
 		return *this;
 	}
 
 	Any& Any::operator = (const Any::AnyEmpty& rhs)
 	{
-		delete mContent;
-		mContent = nullptr;
+		if (mInPlaceType == nullptr)
+			delete mStorage.content;
+		mInPlaceType = nullptr;
+		mStorage.content = nullptr;
 		return *this;
 	}
 
@@ -69,17 +95,21 @@ namespace MyGUI
 
 	bool Any::empty() const
 	{
-		return !mContent;
+		return mInPlaceType == nullptr && mStorage.content == nullptr;
 	}
 
 	const std::type_info& Any::getType() const
 	{
-		return mContent ? mContent->getType() : typeid(void);
+		if (mInPlaceType != nullptr)
+			return *mInPlaceType;
+		return mStorage.content ? mStorage.content->getType() : typeid(void);
 	}
 
 	void* Any::castUnsafe() const
 	{
-		return mContent ? static_cast<Any::Holder<void*> *>(this->mContent)->held : nullptr;
+		if (mInPlaceType != nullptr)
+			return *reinterpret_cast<void* const*>(mStorage.buffer);
+		return mStorage.content ? static_cast<Any::Holder<void*> *>(mStorage.content)->held : nullptr;
 	}
 
 } // namespace MyGUI
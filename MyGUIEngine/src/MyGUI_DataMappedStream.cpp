@@ -0,0 +1,136 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_DataMappedStream.h"
+#include "MyGUI_UString.h"
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace MyGUI
+{
+
+	DataMappedStream::DataMappedStream() :
+		mFile(nullptr),
+		mMapping(nullptr)
+	{
+	}
+
+	DataMappedStream::~DataMappedStream()
+	{
+		close();
+	}
+
+	bool DataMappedStream::open(const std::string& _filename)
+	{
+		close();
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+		HANDLE file = ::CreateFileW(UString(_filename).asWStr_c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0 || (unsigned long long)size.QuadPart > (size_t)-1)
+		{
+			::CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			::CloseHandle(file);
+			return false;
+		}
+
+		void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (data == nullptr)
+		{
+			::CloseHandle(mapping);
+			::CloseHandle(file);
+			return false;
+		}
+
+		mFile = file;
+		mMapping = mapping;
+		mData = (unsigned char*)data;
+		mSize = (size_t)size.QuadPart;
+#else
+		int file = ::open(_filename.c_str(), O_RDONLY);
+		if (file == -1)
+			return false;
+
+		struct stat info;
+		if (::fstat(file, &info) != 0 || info.st_size <= 0)
+		{
+			::close(file);
+			return false;
+		}
+
+		void* data = ::mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		// mapping stays valid after descriptor is closed
+		::close(file);
+		if (data == MAP_FAILED)
+			return false;
+
+		mMapping = data;
+		mData = (unsigned char*)data;
+		mSize = (size_t)info.st_size;
+#endif
+
+		mPosition = 0;
+		return true;
+	}
+
+	void DataMappedStream::close()
+	{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+		if (mData != nullptr)
+			::UnmapViewOfFile(mData);
+		if (mMapping != nullptr)
+			::CloseHandle((HANDLE)mMapping);
+		if (mFile != nullptr)
+			::CloseHandle((HANDLE)mFile);
+#else
+		if (mMapping != nullptr)
+			::munmap(mMapping, mSize);
+#endif
+
+		mFile = nullptr;
+		mMapping = nullptr;
+		mData = nullptr;
+		mSize = 0;
+		mPosition = 0;
+	}
+
+	bool DataMappedStream::isOpen() const
+	{
+		return mData != nullptr;
+	}
+
+} // namespace MyGUI
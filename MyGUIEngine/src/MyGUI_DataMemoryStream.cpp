@@ -28,20 +28,19 @@ namespace MyGUI
 	DataMemoryStream::DataMemoryStream() :
 		mData(nullptr),
 		mSize(0),
-		mStream(0)
+		mPosition(0)
 	{
 	}
 
 	DataMemoryStream::DataMemoryStream(unsigned char* _data, size_t _size) :
 		mData(_data),
 		mSize(_size),
-		mStream(nullptr)
+		mPosition(0)
 	{
 	}
 
 	DataMemoryStream::~DataMemoryStream()
 	{
-		delete mStream;
 	}
 
 	size_t DataMemoryStream::size()
@@ -49,28 +48,34 @@ namespace MyGUI
 		return mSize;
 	}
 
-    void DataMemoryStream::seek(size_t offset)
-    {
-        if (mStream == nullptr)
-            prepareStream();
-
-        mStream->seekg(offset);
-    }
+	void DataMemoryStream::seek(size_t offset)
+	{
+		mPosition = (std::min)(offset, mSize);
+	}
 
 	bool DataMemoryStream::eof()
 	{
-		if (mStream == nullptr)
-			prepareStream();
-
-		return mStream->eof();
+		return mPosition >= mSize;
 	}
 
 	void DataMemoryStream::readline(std::string& _source, Char _delim)
 	{
-		if (mStream == nullptr)
-			prepareStream();
+		_source.clear();
+		if (mData == nullptr || mPosition >= mSize)
+			return;
 
-		std::getline(*mStream, _source, (char)_delim);
+		const unsigned char* start = mData + mPosition;
+		const unsigned char* end = (const unsigned char*)::memchr(start, (unsigned char)_delim, mSize - mPosition);
+		if (end == nullptr)
+		{
+			_source.assign((const char*)start, mSize - mPosition);
+			mPosition = mSize;
+		}
+		else
+		{
+			_source.assign((const char*)start, end - start);
+			mPosition += (end - start) + 1;
+		}
 	}
 
 	size_t DataMemoryStream::read(void* _buf, size_t _count)
@@ -78,17 +83,15 @@ namespace MyGUI
 		if (mData == nullptr)
 			return 0;
 
-		size_t count = (std::min)(size(), _count);
-		::memcpy(_buf, mData, count);
+		size_t count = (std::min)(mSize - mPosition, _count);
+		::memcpy(_buf, mData + mPosition, count);
+		mPosition += count;
 		return count;
 	}
 
-	void DataMemoryStream::prepareStream()
+	const unsigned char* DataMemoryStream::data()
 	{
-		if (mData == nullptr)
-			return;
-
-		mStream = new std::stringstream((const char*)mData);
+		return mData;
 	}
 
 } // namespace MyGUI
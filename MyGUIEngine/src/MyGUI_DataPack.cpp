@@ -0,0 +1,508 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_DataPack.h"
+#include <fstream>
+
+namespace MyGUI
+{
+
+	// pack file: header, index of entries sorted by name, names, entries data
+	// all numbers are 32 bit little endian
+	const uint32 PackFileMagic = 0x4B50474D; // "MGPK"
+	const uint32 PackFileVersion = 1;
+	const size_t PackHeaderSize = 8 * 4;
+	const size_t PackEntrySize = 6 * 4;
+
+	// LZ4 block format limits
+	const size_t LZ4MinMatch = 4;
+	const size_t LZ4LastLiterals = 5;
+	const size_t LZ4MatchSearchLimit = 12;
+	const size_t LZ4HashLog = 12;
+	const size_t LZ4MaxOffset = 65535;
+
+	// stream owning buffer with decompressed entry
+	class DataPackBufferStream :
+		public DataMemoryStream
+	{
+	public:
+		DataPackBufferStream(unsigned char* _data, size_t _size) :
+			DataMemoryStream(_data, _size)
+		{
+		}
+
+		virtual ~DataPackBufferStream()
+		{
+			delete[] mData;
+		}
+	};
+
+	static uint32 readUInt32(const uint8* _data)
+	{
+		return (uint32)_data[0] | ((uint32)_data[1] << 8) | ((uint32)_data[2] << 16) | ((uint32)_data[3] << 24);
+	}
+
+	static void writeUInt32(std::ofstream& _stream, uint32 _value)
+	{
+		uint8 bytes[4] = { (uint8)(_value & 0xFF), (uint8)((_value >> 8) & 0xFF), (uint8)((_value >> 16) & 0xFF), (uint8)((_value >> 24) & 0xFF) };
+		_stream.write((const char*)bytes, 4);
+	}
+
+	static void writePadding(std::ofstream& _stream, size_t _count)
+	{
+		for (size_t index = 0; index < _count; ++index)
+			_stream.put(0);
+	}
+
+	static size_t alignSize(size_t _value, size_t _alignment)
+	{
+		return (_value + _alignment - 1) & ~(_alignment - 1);
+	}
+
+	static bool matchMask(const char* _name, const char* _nameEnd, const char* _mask)
+	{
+		const char* star = nullptr;
+		const char* retry = nullptr;
+		while (_name != _nameEnd)
+		{
+			if (*_mask == '*')
+			{
+				star = ++_mask;
+				retry = _name;
+			}
+			else if (*_mask == '?' || (*_mask != 0 && *_mask == *_name))
+			{
+				++_mask;
+				++_name;
+			}
+			else if (star != nullptr)
+			{
+				_mask = star;
+				_name = ++retry;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		while (*_mask == '*')
+			++_mask;
+		return *_mask == 0;
+	}
+
+	static void writeLZ4Length(vector<uint8>::type& _result, size_t _length)
+	{
+		while (_length >= 255)
+		{
+			_result.push_back(255);
+			_length -= 255;
+		}
+		_result.push_back((uint8)_length);
+	}
+
+	static void writeLZ4Sequence(vector<uint8>::type& _result, const uint8* _literals, size_t _literalsCount, size_t _offset, size_t _matchLength)
+	{
+		size_t matchCode = _matchLength != 0 ? _matchLength - LZ4MinMatch : 0;
+		uint8 token = (uint8)((std::min(_literalsCount, (size_t)15) << 4) | std::min(matchCode, (size_t)15));
+		_result.push_back(token);
+		if (_literalsCount >= 15)
+			writeLZ4Length(_result, _literalsCount - 15);
+
+		_result.insert(_result.end(), _literals, _literals + _literalsCount);
+
+		// last sequence has literals only
+		if (_matchLength == 0)
+			return;
+
+		_result.push_back((uint8)(_offset & 0xFF));
+		_result.push_back((uint8)(_offset >> 8));
+		if (matchCode >= 15)
+			writeLZ4Length(_result, matchCode - 15);
+	}
+
+	static bool readLZ4Length(const uint8*& _source, const uint8* _sourceEnd, size_t& _length)
+	{
+		uint8 value = 255;
+		while (value == 255)
+		{
+			if (_source == _sourceEnd)
+				return false;
+			value = *_source++;
+			_length += value;
+		}
+		return true;
+	}
+
+	DataPack::DataPack() :
+		mData(nullptr)
+	{
+	}
+
+	DataPack::~DataPack()
+	{
+		unload();
+	}
+
+	bool DataPack::load(const std::string& _filename)
+	{
+		unload();
+
+		if (!mStream.open(_filename))
+			return false;
+
+		const uint8* data = mStream.data();
+		size_t size = mStream.size();
+
+		if (size < PackHeaderSize
+			|| readUInt32(data) != PackFileMagic
+			|| readUInt32(data + 4) != PackFileVersion)
+		{
+			unload();
+			return false;
+		}
+
+		size_t count = readUInt32(data + 8);
+		size_t indexOffset = readUInt32(data + 12);
+		size_t namesOffset = readUInt32(data + 16);
+		size_t namesSize = readUInt32(data + 20);
+
+		if (indexOffset > size
+			|| count > (size - indexOffset) / PackEntrySize
+			|| namesOffset > size
+			|| namesSize > size - namesOffset)
+		{
+			unload();
+			return false;
+		}
+
+		mEntries.resize(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			const uint8* item = data + indexOffset + index * PackEntrySize;
+			Entry& entry = mEntries[index];
+
+			size_t nameOffset = readUInt32(item);
+			entry.nameLength = readUInt32(item + 4);
+			entry.offset = readUInt32(item + 8);
+			entry.size = readUInt32(item + 12);
+			entry.packedSize = readUInt32(item + 16);
+			entry.compression = (Compression)readUInt32(item + 20);
+			entry.name = (const char*)(data + namesOffset + nameOffset);
+
+			if (nameOffset > namesSize
+				|| entry.nameLength > namesSize - nameOffset
+				|| entry.offset > size
+				|| entry.packedSize > size - entry.offset
+				|| (entry.compression != CompressionNone && entry.compression != CompressionLZ4)
+				|| (entry.compression == CompressionNone && entry.packedSize != entry.size))
+			{
+				MYGUI_LOG(Error, "Pack '" << _filename << "' is corrupted");
+				unload();
+				return false;
+			}
+		}
+
+		mData = data;
+		mFileName = _filename;
+		return true;
+	}
+
+	void DataPack::unload()
+	{
+		mEntries.clear();
+		mStream.close();
+		mData = nullptr;
+		mFileName.clear();
+	}
+
+	bool DataPack::isLoaded() const
+	{
+		return mStream.isOpen();
+	}
+
+	const std::string& DataPack::getFileName() const
+	{
+		return mFileName;
+	}
+
+	bool DataPack::compareEntry(const Entry& _entry, const std::string& _name)
+	{
+		return _name.compare(0, _name.size(), _entry.name, _entry.nameLength) > 0;
+	}
+
+	const DataPack::Entry* DataPack::findEntry(const std::string& _name) const
+	{
+		VectorEntry::const_iterator item = std::lower_bound(mEntries.begin(), mEntries.end(), _name, compareEntry);
+		if (item == mEntries.end() || _name.compare(0, _name.size(), item->name, item->nameLength) != 0)
+			return nullptr;
+		return &(*item);
+	}
+
+	IDataStream* DataPack::getData(const std::string& _name) const
+	{
+		const Entry* entry = findEntry(_name);
+		if (entry == nullptr)
+			return nullptr;
+
+		// pack is read only, entry data is not modified through stream
+		unsigned char* data = const_cast<unsigned char*>(mData) + entry->offset;
+
+		if (entry->compression == CompressionNone)
+			return new DataMemoryStream(data, entry->size);
+
+		unsigned char* buffer = new unsigned char[entry->size];
+		if (!decompressLZ4(data, entry->packedSize, buffer, entry->size))
+		{
+			MYGUI_LOG(Error, "Entry '" << _name << "' in pack '" << mFileName << "' is corrupted");
+			delete[] buffer;
+			return nullptr;
+		}
+
+		return new DataPackBufferStream(buffer, entry->size);
+	}
+
+	bool DataPack::isDataExist(const std::string& _name) const
+	{
+		return findEntry(_name) != nullptr;
+	}
+
+	void DataPack::getDataListNames(const std::string& _pattern, VectorString& _result) const
+	{
+		if (_pattern.find_first_of("*?") == std::string::npos)
+		{
+			if (isDataExist(_pattern))
+				_result.push_back(_pattern);
+			return;
+		}
+
+		for (VectorEntry::const_iterator entry = mEntries.begin(); entry != mEntries.end(); ++entry)
+		{
+			if (matchMask(entry->name, entry->name + entry->nameLength, _pattern.c_str()))
+				_result.push_back(std::string(entry->name, entry->nameLength));
+		}
+	}
+
+	size_t DataPack::getEntriesCount() const
+	{
+		return mEntries.size();
+	}
+
+	bool DataPack::build(const std::string& _filename, const VectorString& _names, const VectorString& _files, Compression _compression, size_t _alignment)
+	{
+		if (_names.size() != _files.size() || _alignment == 0 || (_alignment & (_alignment - 1)) != 0)
+			return false;
+
+		// index is sorted by name for binary search
+		MapString sorted;
+		for (size_t index = 0; index < _names.size(); ++index)
+		{
+			if (!sorted.insert(std::make_pair(_names[index], _files[index])).second)
+			{
+				MYGUI_LOG(Error, "Duplicate pack entry '" << _names[index] << "'");
+				return false;
+			}
+		}
+
+		size_t count = sorted.size();
+		size_t indexOffset = PackHeaderSize;
+		size_t namesOffset = indexOffset + count * PackEntrySize;
+		size_t namesSize = 0;
+		for (MapString::const_iterator item = sorted.begin(); item != sorted.end(); ++item)
+			namesSize += item->first.size();
+
+		std::ofstream stream(_filename.c_str(), std::ios_base::binary);
+		if (!stream.is_open())
+			return false;
+
+		// entries data is written after index and names, index is filled in second pass
+		size_t dataOffset = alignSize(namesOffset + namesSize, _alignment);
+		stream.seekp((std::streamoff)dataOffset);
+
+		vector<uint32>::type index;
+		index.reserve(count * 6);
+		size_t nameOffset = 0;
+		size_t offset = dataOffset;
+		vector<uint8>::type content;
+		vector<uint8>::type packed;
+
+		for (MapString::const_iterator item = sorted.begin(); item != sorted.end(); ++item)
+		{
+			std::ifstream file(item->second.c_str(), std::ios_base::binary);
+			if (!file.is_open())
+			{
+				MYGUI_LOG(Error, "Can't open file '" << item->second << "'");
+				return false;
+			}
+
+			file.seekg(0, std::ios::end);
+			content.resize((size_t)file.tellg());
+			file.seekg(0, std::ios::beg);
+			if (!content.empty())
+				file.read((char*)&content[0], content.size());
+
+			Compression compression = CompressionNone;
+			const uint8* data = content.empty() ? nullptr : &content[0];
+			size_t packedSize = content.size();
+
+			if (_compression == CompressionLZ4 && !content.empty())
+			{
+				compressLZ4(&content[0], content.size(), packed);
+				if (packed.size() < content.size())
+				{
+					compression = CompressionLZ4;
+					data = &packed[0];
+					packedSize = packed.size();
+				}
+			}
+
+			if (packedSize != 0)
+				stream.write((const char*)data, packedSize);
+
+			size_t nextOffset = alignSize(offset + packedSize, _alignment);
+			writePadding(stream, nextOffset - offset - packedSize);
+
+			index.push_back((uint32)nameOffset);
+			index.push_back((uint32)item->first.size());
+			index.push_back((uint32)offset);
+			index.push_back((uint32)content.size());
+			index.push_back((uint32)packedSize);
+			index.push_back((uint32)compression);
+
+			nameOffset += item->first.size();
+			offset = nextOffset;
+		}
+
+		stream.seekp(0);
+		writeUInt32(stream, PackFileMagic);
+		writeUInt32(stream, PackFileVersion);
+		writeUInt32(stream, (uint32)count);
+		writeUInt32(stream, (uint32)indexOffset);
+		writeUInt32(stream, (uint32)namesOffset);
+		writeUInt32(stream, (uint32)namesSize);
+		writeUInt32(stream, (uint32)_alignment);
+		writeUInt32(stream, 0);
+
+		for (vector<uint32>::type::const_iterator item = index.begin(); item != index.end(); ++item)
+			writeUInt32(stream, *item);
+
+		for (MapString::const_iterator item = sorted.begin(); item != sorted.end(); ++item)
+			stream.write(item->first.c_str(), item->first.size());
+
+		writePadding(stream, dataOffset - namesOffset - namesSize);
+
+		return stream.good();
+	}
+
+	void DataPack::compressLZ4(const uint8* _source, size_t _size, vector<uint8>::type& _result)
+	{
+		_result.clear();
+		_result.reserve(_size + _size / 255 + 16);
+
+		// positions + 1 of last occurrence of 4 byte sequence, 0 is empty
+		vector<size_t>::type table(1 << LZ4HashLog, 0);
+
+		size_t position = 0;
+		size_t anchor = 0;
+		size_t limit = _size > LZ4MatchSearchLimit ? _size - LZ4MatchSearchLimit : 0;
+
+		while (position < limit)
+		{
+			uint32 sequence = readUInt32(_source + position);
+			size_t hash = (size_t)((sequence * 2654435761u) >> (32 - LZ4HashLog));
+			size_t reference = table[hash];
+			table[hash] = position + 1;
+
+			if (reference == 0
+				|| position - (reference - 1) > LZ4MaxOffset
+				|| readUInt32(_source + reference - 1) != sequence)
+			{
+				++position;
+				continue;
+			}
+
+			reference -= 1;
+			size_t length = LZ4MinMatch;
+			size_t matchEnd = _size - LZ4LastLiterals;
+			while (position + length < matchEnd && _source[reference + length] == _source[position + length])
+				++length;
+
+			writeLZ4Sequence(_result, _source + anchor, position - anchor, position - reference, length);
+
+			position += length;
+			anchor = position;
+		}
+
+		writeLZ4Sequence(_result, _source + anchor, _size - anchor, 0, 0);
+	}
+
+	bool DataPack::decompressLZ4(const uint8* _source, size_t _sourceSize, uint8* _result, size_t _size)
+	{
+		const uint8* source = _source;
+		const uint8* sourceEnd = _source + _sourceSize;
+		uint8* result = _result;
+		uint8* resultEnd = _result + _size;
+
+		while (source != sourceEnd)
+		{
+			uint8 token = *source++;
+
+			size_t literals = token >> 4;
+			if (literals == 15 && !readLZ4Length(source, sourceEnd, literals))
+				return false;
+
+			if ((size_t)(sourceEnd - source) < literals || (size_t)(resultEnd - result) < literals)
+				return false;
+
+			::memcpy(result, source, literals);
+			source += literals;
+			result += literals;
+
+			// last sequence has no match
+			if (source == sourceEnd)
+				break;
+
+			if (sourceEnd - source < 2)
+				return false;
+
+			size_t offset = (size_t)source[0] | ((size_t)source[1] << 8);
+			source += 2;
+			if (offset == 0 || offset > (size_t)(result - _result))
+				return false;
+
+			size_t length = token & 15;
+			if (length == 15 && !readLZ4Length(source, sourceEnd, length))
+				return false;
+			length += LZ4MinMatch;
+
+			if ((size_t)(resultEnd - result) < length)
+				return false;
+
+			// match can overlap output, copy bytewise
+			const uint8* match = result - offset;
+			for (size_t index = 0; index < length; ++index)
+				result[index] = match[index];
+			result += length;
+		}
+
+		return result == resultEnd;
+	}
+
+} // namespace MyGUI
@@ -0,0 +1,197 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_DirtyRegion.h"
+
+namespace MyGUI
+{
+
+	namespace
+	{
+
+		bool hasArea(const IntRect& _rect)
+		{
+			return _rect.right > _rect.left && _rect.bottom > _rect.top;
+		}
+
+		int getArea(const IntRect& _rect)
+		{
+			return _rect.width() * _rect.height();
+		}
+
+		// touching rectangles are merged too, they give one scissor instead of two
+		bool isAdjacent(const IntRect& _first, const IntRect& _second)
+		{
+			return _first.left <= _second.right && _second.left <= _first.right && _first.top <= _second.bottom && _second.top <= _first.bottom;
+		}
+
+	} // namespace
+
+	DirtyRegion::DirtyRegion() :
+		mFull(false),
+		mMaxRectCount(8)
+	{
+	}
+
+	void DirtyRegion::addRect(const IntRect& _rect)
+	{
+		if (!mFull && hasArea(_rect))
+			mergeRect(_rect);
+	}
+
+	void DirtyRegion::setFull()
+	{
+		mFull = true;
+		mRects.clear();
+	}
+
+	bool DirtyRegion::isFull() const
+	{
+		return mFull;
+	}
+
+	bool DirtyRegion::empty() const
+	{
+		return !mFull && mRects.empty();
+	}
+
+	void DirtyRegion::clear()
+	{
+		mFull = false;
+		mRects.clear();
+	}
+
+	void DirtyRegion::optimise(const IntSize& _viewSize)
+	{
+		IntRect view(0, 0, _viewSize.width, _viewSize.height);
+
+		if (!mFull)
+		{
+			for (VectorIntRect::iterator item = mRects.begin(); item != mRects.end(); )
+			{
+				item->set(
+					std::max(item->left, view.left),
+					std::max(item->top, view.top),
+					std::min(item->right, view.right),
+					std::min(item->bottom, view.bottom));
+
+				if (hasArea(*item))
+					++item;
+				else
+					item = mRects.erase(item);
+			}
+
+			// scissoring doesn't pay off when almost everything is redrawn
+			int area = 0;
+			for (VectorIntRect::const_iterator item = mRects.begin(); item != mRects.end(); ++item)
+				area += getArea(*item);
+			if (area * 4 >= getArea(view) * 3 && hasArea(view))
+				mFull = true;
+		}
+
+		if (mFull)
+			mRects.assign(1, view);
+	}
+
+	void DirtyRegion::mergeRect(const IntRect& _rect)
+	{
+		// region never holds more than mMaxRectCount rectangles, so thousands of changed items cost linear time
+		IntRect rect = _rect;
+		for (size_t index = 0; index < mRects.size(); )
+		{
+			IntRect bounds = combine(mRects[index], rect);
+			if (isAdjacent(mRects[index], rect) || getArea(bounds) <= getArea(mRects[index]) + getArea(rect))
+			{
+				rect = bounds;
+				mRects[index] = mRects.back();
+				mRects.pop_back();
+				index = 0;
+			}
+			else
+			{
+				++index;
+			}
+		}
+
+		if (mRects.size() < mMaxRectCount)
+		{
+			mRects.push_back(rect);
+		}
+		else
+		{
+			for (VectorIntRect::const_iterator item = mRects.begin(); item != mRects.end(); ++item)
+				rect = combine(rect, *item);
+			mRects.assign(1, rect);
+		}
+	}
+
+	const DirtyRegion::VectorIntRect& DirtyRegion::getRects() const
+	{
+		return mRects;
+	}
+
+	bool DirtyRegion::intersect(const IntRect& _rect) const
+	{
+		if (mFull)
+			return true;
+
+		for (VectorIntRect::const_iterator item = mRects.begin(); item != mRects.end(); ++item)
+		{
+			if (_rect.left < item->right && item->left < _rect.right && _rect.top < item->bottom && item->top < _rect.bottom)
+				return true;
+		}
+
+		return false;
+	}
+
+	void DirtyRegion::setMaxRectCount(size_t _value)
+	{
+		mMaxRectCount = std::max(_value, (size_t)1);
+
+		if (mRects.size() > mMaxRectCount)
+		{
+			IntRect bounds;
+			for (VectorIntRect::const_iterator item = mRects.begin(); item != mRects.end(); ++item)
+				bounds = combine(bounds, *item);
+			mRects.assign(1, bounds);
+		}
+	}
+
+	size_t DirtyRegion::getMaxRectCount() const
+	{
+		return mMaxRectCount;
+	}
+
+	IntRect DirtyRegion::combine(const IntRect& _first, const IntRect& _second)
+	{
+		if (!hasArea(_first))
+			return _second;
+		if (!hasArea(_second))
+			return _first;
+
+		return IntRect(
+			std::min(_first.left, _second.left),
+			std::min(_first.top, _second.top),
+			std::max(_first.right, _second.right),
+			std::max(_first.bottom, _second.bottom));
+	}
+
+} // namespace MyGUI
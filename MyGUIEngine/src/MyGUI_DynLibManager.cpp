@@ -40,8 +40,6 @@ namespace MyGUI
 		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
 		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
 
-		Gui::getInstance().eventFrameStart += newDelegate(this, &DynLibManager::notifyEventFrameStart);
-
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
 	}
@@ -53,7 +51,6 @@ namespace MyGUI
 
 		unloadAll();
 
-		Gui::getInstance().eventFrameStart -= newDelegate(this, &DynLibManager::notifyEventFrameStart);
 		_unloadDelayDynLibs();
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
@@ -106,6 +103,11 @@ namespace MyGUI
 		_unloadDelayDynLibs();
 	}
 
+	float DynLibManager::_getNextFrameDelay() const
+	{
+		return mDelayDynLib.empty() ? -1.0f : 0.0f;
+	}
+
 	void DynLibManager::_unloadDelayDynLibs()
 	{
 		if (!mDelayDynLib.empty())
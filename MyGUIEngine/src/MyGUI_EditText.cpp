@@ -42,6 +42,7 @@ namespace MyGUI
 		mInverseColourNative(0x00000000),
 		mCurrentAlphaNative(0xFF000000),
 		mShadowColourNative(0x00000000),
+		mCaptionTagged(false),
 		mTextOutDate(false),
 		mTextAlign(Align::Default),
 		mColour(Colour::White),
@@ -62,7 +63,8 @@ namespace MyGUI
 		mShiftText(false),
 		mWordWrap(false),
 		mManualColour(false),
-		mOldWidth(0)
+		mOldWidth(0),
+		mWaitGlyphs(false)
 	{
 		mVertexFormat = RenderManager::getInstance().getVertexFormat();
 
@@ -76,6 +78,8 @@ namespace MyGUI
 
 	EditText::~EditText()
 	{
+		if (mWaitGlyphs)
+			FontManager::getInstance().eventGlyphsReady -= newDelegate(this, &EditText::notifyGlyphsReady);
 	}
 
 	void EditText::setVisible(bool _visible)
@@ -200,10 +204,18 @@ namespace MyGUI
             return;
 
 		mCaption = _value;
+		mCaptionTagged = TextView::isTagged(mCaption);
 		mTextOutDate = true;
 
         mFont->prepareString(mCaption);
 
+        // missing glyphs are shown as substitute until font renders them, then caption is rebuilt
+        if (!mWaitGlyphs && mFont->hasPendingGlyphs())
+        {
+            mWaitGlyphs = true;
+            FontManager::getInstance().eventGlyphsReady += newDelegate(this, &EditText::notifyGlyphsReady);
+        }
+
         RenderGlyphMap::iterator itrFind;
         size_t textvertex = (mShadow ? 2 : 1) * VERTEX_IN_QUAD;
 
@@ -251,6 +263,19 @@ namespace MyGUI
 		outOfData();
 	}
 
+	void EditText::notifyGlyphsReady(IFont* _font)
+	{
+		// fonts scaled from a distance field font get glyphs from it, so the caption is rebuilt for any font
+		if (mFont != nullptr)
+			setCaption(mCaption);
+
+		if (mFont == nullptr || !mFont->hasPendingGlyphs())
+		{
+			mWaitGlyphs = false;
+			FontManager::getInstance().eventGlyphsReady -= newDelegate(this, &EditText::notifyGlyphsReady);
+		}
+	}
+
 	void EditText::checkVertexSize()
 	{
 		// если вершин не хватит, делаем реалок, с учетом выделения * 2 и курсора
@@ -589,7 +614,7 @@ namespace MyGUI
 				width -= 2;
 		}
 
-		mTextView.update(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+		mTextView.update(mCaption, mCaptionTagged, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
 	}
 
 	void EditText::setStateData(IStateInfo* _data)
@@ -619,13 +644,58 @@ namespace MyGUI
 		if (_render->getCurrentUpdate() || mTextOutDate)
 			updateRawData();
 
-		Vertex* vertex = _render->getCurrentVertexBuffer();
-
 		const RenderTargetInfo& renderTargetInfo = _render->getRenderTarget()->getInfo();
 
-		// колличество отрисованных вершин
-		size_t vertexCount = 0;
+		// glyphs are collected in pixels relative to cropped parent and transformed by batches
+		vertex_utility::QuadTransform transform(
+			renderTargetInfo,
+			(float)(mCroppedParent->getAbsoluteLeft() - renderTargetInfo.leftOffset),
+			(float)(mCroppedParent->getAbsoluteTop() - renderTargetInfo.topOffset) + (mShiftText ? 1.0f : 0.0f));
+		vertex_utility::QuadWriter writer(_render->getCurrentVertexBuffer(), mNode->getNodeDepth(), transform);
+
+		// plain text without selection is the most common case, it uses loop without per glyph checks
+		bool selection = mStartSelect < mEndSelect;
+		if (mTextView.isTagged())
+		{
+			if (selection)
+				drawLines<true, true>(_render, writer);
+			else
+				drawLines<true, false>(_render, writer);
+		}
+		else
+		{
+			if (selection)
+				drawLines<false, true>(_render, writer);
+			else
+				drawLines<false, false>(_render, writer);
+		}
+
+		FloatRect vertexRect;
+
+		// Render the cursor, if any, last.
+		if (mVisibleCursor)
+		{
+			IntPoint point = mTextView.getCursorPoint(mCursorPosition) - mViewOffset + mCoord.point();
+			GlyphInfo* cursorGlyph = mFont->getGlyphInfo(static_cast<Char>(FontCodeType::Cursor));
 
+            if (cursorGlyph->texture == _render->getTexture())
+            {
+                vertexRect.set((float)point.left, (float)point.top, (float)point.left + cursorGlyph->width, (float)(point.top + mFontHeight));
+                drawGlyph(writer, vertexRect, cursorGlyph->uvRect, mCurrentColourNative | 0x00FFFFFF);
+            }
+		}
+
+		writer.flush();
+
+		// колличество реально отрисованных вершин
+		_render->setLastVertexCount(writer.getVertexCount());
+	}
+
+	template <bool Tagged, bool Selection>
+	void EditText::drawLines(
+		RenderItem* _render,
+		vertex_utility::QuadWriter& _writer) const
+	{
 		// текущие цвета
 		uint32 colour = mCurrentColourNative;
 		uint32 inverseColour = mInverseColourNative;
@@ -648,7 +718,7 @@ namespace MyGUI
 
 			for (VectorCharInfo::const_iterator sim = line->simbols.begin(); sim != line->simbols.end(); ++sim)
 			{
-				if (sim->isColour())
+				if (Tagged && sim->isColour())
 				{
 					colour = sim->getColour() | (colour & 0xFF000000);
 					inverseColour = colour ^ 0x00FFFFFF;
@@ -657,7 +727,7 @@ namespace MyGUI
 				}
 
 				// смещение текстуры для фона
-				bool select = index >= mStartSelect && index < mEndSelect;
+				bool select = Selection && index >= mStartSelect && index < mEndSelect;
 
 				float fullAdvance = sim->getBearingX() + sim->getAdvance();
 
@@ -666,7 +736,7 @@ namespace MyGUI
                 {
                     vertexRect.set(left, top, left + fullAdvance, top + (float)mFontHeight);
 
-                    drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, selectedUVRect, selectedColour);
+                    drawGlyph(_writer, vertexRect, selectedUVRect, selectedColour);
                 }
 
                 if (sim->getTexture() == _render->getTexture())
@@ -679,7 +749,7 @@ namespace MyGUI
                         vertexRect.right = vertexRect.left + sim->getWidth();
                         vertexRect.bottom = vertexRect.top + sim->getHeight();
 
-                        drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, sim->getUVRect(), mShadowColourNative);
+                        drawGlyph(_writer, vertexRect, sim->getUVRect(), mShadowColourNative);
                     }
 
                     // Render the glyph itself.
@@ -688,7 +758,7 @@ namespace MyGUI
                     vertexRect.right = vertexRect.left + sim->getWidth();
                     vertexRect.bottom = vertexRect.top + sim->getHeight();
 
-                    drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, sim->getUVRect(), (!select || !mInvertSelect) ? colour : inverseColour);
+                    drawGlyph(_writer, vertexRect, sim->getUVRect(), (!select || !mInvertSelect) ? colour : inverseColour);
                 }
 
 				left += fullAdvance;
@@ -699,22 +769,6 @@ namespace MyGUI
 			if (!line->autoNewLine)
 				++index;
 		}
-
-		// Render the cursor, if any, last.
-		if (mVisibleCursor)
-		{
-			IntPoint point = mTextView.getCursorPoint(mCursorPosition) - mViewOffset + mCoord.point();
-			GlyphInfo* cursorGlyph = mFont->getGlyphInfo(static_cast<Char>(FontCodeType::Cursor));
-
-            if (cursorGlyph->texture == _render->getTexture())
-            {
-                vertexRect.set((float)point.left, (float)point.top, (float)point.left + cursorGlyph->width, (float)(point.top + mFontHeight));
-                drawGlyph(renderTargetInfo, vertex, vertexCount, vertexRect, cursorGlyph->uvRect, mCurrentColourNative | 0x00FFFFFF);
-            }
-		}
-
-		// колличество реально отрисованных вершин
-		_render->setLastVertexCount(vertexCount);
 	}
 
 	void EditText::setInvertSelected(bool _value)
@@ -765,66 +819,8 @@ namespace MyGUI
 		return mShadowColour;
 	}
 
-	void EditText::drawQuad(
-		Vertex*& _vertex,
-		size_t& _vertexCount,
-		const FloatRect& _vertexRect,
-		float _vertexZ,
-		const FloatRect& _textureRect,
-		uint32 _colour) const
-	{
-		_vertex[VertexQuad::CornerLT].x = _vertexRect.left;
-		_vertex[VertexQuad::CornerLT].y = _vertexRect.top;
-		_vertex[VertexQuad::CornerLT].z = _vertexZ;
-		_vertex[VertexQuad::CornerLT].colour = _colour;
-		_vertex[VertexQuad::CornerLT].u = _textureRect.left;
-		_vertex[VertexQuad::CornerLT].v = _textureRect.top;
-
-        _vertex[VertexQuad::CornerRB].x = _vertexRect.right;
-        _vertex[VertexQuad::CornerRB].y = _vertexRect.bottom;
-        _vertex[VertexQuad::CornerRB].z = _vertexZ;
-        _vertex[VertexQuad::CornerRB].colour = _colour;
-        _vertex[VertexQuad::CornerRB].u = _textureRect.right;
-        _vertex[VertexQuad::CornerRB].v = _textureRect.bottom;
-
-#ifndef MYGUI_RENDER_UE
-        _vertex[VertexQuad::CornerLB].x = _vertexRect.left;
-        _vertex[VertexQuad::CornerLB].y = _vertexRect.bottom;
-        _vertex[VertexQuad::CornerLB].z = _vertexZ;
-        _vertex[VertexQuad::CornerLB].colour = _colour;
-        _vertex[VertexQuad::CornerLB].u = _textureRect.left;
-        _vertex[VertexQuad::CornerLB].v = _textureRect.bottom;
-
-        _vertex[VertexQuad::CornerRT].x = _vertexRect.right;
-        _vertex[VertexQuad::CornerRT].y = _vertexRect.top;
-        _vertex[VertexQuad::CornerRT].z = _vertexZ;
-        _vertex[VertexQuad::CornerRT].colour = _colour;
-        _vertex[VertexQuad::CornerRT].u = _textureRect.right;
-        _vertex[VertexQuad::CornerRT].v = _textureRect.top;
-
-        _vertex[VertexQuad::CornerLB2].x = _vertexRect.left;
-        _vertex[VertexQuad::CornerLB2].y = _vertexRect.bottom;
-        _vertex[VertexQuad::CornerLB2].z = _vertexZ;
-        _vertex[VertexQuad::CornerLB2].colour = _colour;
-        _vertex[VertexQuad::CornerLB2].u = _textureRect.left;
-        _vertex[VertexQuad::CornerLB2].v = _textureRect.bottom;
-
-		_vertex[VertexQuad::CornerRT2].x = _vertexRect.right;
-		_vertex[VertexQuad::CornerRT2].y = _vertexRect.top;
-		_vertex[VertexQuad::CornerRT2].z = _vertexZ;
-		_vertex[VertexQuad::CornerRT2].colour = _colour;
-		_vertex[VertexQuad::CornerRT2].u = _textureRect.right;
-		_vertex[VertexQuad::CornerRT2].v = _textureRect.top;
-#endif
-
-		_vertex += VERTEX_IN_QUAD;
-		_vertexCount += VERTEX_IN_QUAD;
-	}
-
 	void EditText::drawGlyph(
-		const RenderTargetInfo& _renderTargetInfo,
-		Vertex*& _vertex,
-		size_t& _vertexCount,
+		vertex_utility::QuadWriter& _writer,
 		FloatRect _vertexRect,
 		FloatRect _textureRect,
 		uint32 _colour) const
@@ -889,24 +885,7 @@ namespace MyGUI
 			}
 		}
 
-		float pix_left = mCroppedParent->getAbsoluteLeft() - _renderTargetInfo.leftOffset + _vertexRect.left;
-		float pix_top = mCroppedParent->getAbsoluteTop() - _renderTargetInfo.topOffset + (mShiftText ? 1.0f : 0.0f) + _vertexRect.top;
-
-#ifdef MYGUI_RENDER_UE
-        FloatRect vertexRect(
-            pix_left,
-            pix_top,
-            pix_left + _vertexRect.width(),
-            pix_top + _vertexRect.height());
-#else
-        FloatRect vertexRect(
-            ((_renderTargetInfo.pixScaleX * pix_left + _renderTargetInfo.hOffset) * 2.0f) - 1.0f,
-            -(((_renderTargetInfo.pixScaleY * pix_top + _renderTargetInfo.vOffset) * 2.0f) - 1.0f),
-            ((_renderTargetInfo.pixScaleX * (pix_left + _vertexRect.width()) + _renderTargetInfo.hOffset) * 2.0f) - 1.0f,
-            -(((_renderTargetInfo.pixScaleY * (pix_top + _vertexRect.height()) + _renderTargetInfo.vOffset) * 2.0f) - 1.0f));
-#endif
-
-		drawQuad(_vertex, _vertexCount, vertexRect, mNode->getNodeDepth(), _textureRect, _colour);
+		_writer.add(_vertexRect, _textureRect, _colour);
 	}
 
 } // namespace MyGUI
@@ -26,12 +26,46 @@
 namespace MyGUI
 {
 
+	struct FactoryItem
+	{
+		FactoryItem(const std::string& _category, const std::string& _type, size_t _hash) :
+			category(_category),
+			type(_type),
+			hash(_hash),
+			rename(nullptr),
+			renameChecked(false),
+			next(nullptr)
+		{
+		}
+
+		std::string category;
+		std::string type;
+		size_t hash;
+		FactoryManager::Delegate delegate;
+		// item of new type name for deprecated type
+		FactoryItem* rename;
+		bool renameChecked;
+		// next item in same hash bucket
+		FactoryItem* next;
+	};
+
+	const size_t FactoryBucketsCount = 64;
+
 	template <> FactoryManager* Singleton<FactoryManager>::msInstance = nullptr;
 	template <> const char* Singleton<FactoryManager>::mClassTypeName = "FactoryManager";
 
 	FactoryManager::FactoryManager() :
 		mIsInitialise(false)
 	{
+		mBuckets.resize(FactoryBucketsCount, nullptr);
+	}
+
+	FactoryManager::~FactoryManager()
+	{
+		for (VectorFactoryItem::iterator item = mItems.begin(); item != mItems.end(); ++item)
+			delete *item;
+		mItems.clear();
+		mBuckets.clear();
 	}
 
 	void FactoryManager::initialise()
@@ -54,58 +88,126 @@ namespace MyGUI
 
 	void FactoryManager::registerFactory(const std::string& _category, const std::string& _type, Delegate::IDelegate* _delegate)
 	{
-		//FIXME
-		mRegisterFactoryItems[_category][_type] = _delegate;
+		getItem(_category, _type, false)->delegate = _delegate;
 	}
 
 	void FactoryManager::unregisterFactory(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
-		if (category == mRegisterFactoryItems.end())
+		FactoryItem* item = findItem(_category, _type, getHash(_category, _type));
+		if (item != nullptr)
+			item->delegate.clear();
+	}
+
+	void FactoryManager::unregisterFactory(const std::string& _category)
+	{
+		for (VectorFactoryItem::iterator item = mItems.begin(); item != mItems.end(); ++item)
 		{
-			return;
+			if ((*item)->category == _category)
+				(*item)->delegate.clear();
 		}
-		MapFactoryItem::iterator type = category->second.find(_type);
-		if (type == category->second.end())
+	}
+
+	IObject* FactoryManager::createObject(const std::string& _category, const std::string& _type)
+	{
+		// lookup by name only finds items, so unknown names don't allocate anything
+		FactoryItem* item = findItem(_category, _type, getHash(_category, _type));
+		if (item != nullptr && item->renameChecked)
+			return createObject(item);
+
+		std::string typeName = BackwardCompatibility::getFactoryRename(_category, _type);
+		if (typeName == _type)
 		{
-			return;
+			if (item != nullptr)
+				item->renameChecked = true;
+			return createObject(item);
 		}
 
-		category->second.erase(type);
+		// deprecated names are a fixed set, they are remembered so that the warning is logged once
+		if (item == nullptr)
+			item = getItem(_category, _type, false);
+		item->renameChecked = true;
+		item->rename = getItem(_category, typeName, false);
+		return createObject(item);
 	}
 
-	void FactoryManager::unregisterFactory(const std::string& _category)
+	FactoryHandle FactoryManager::getFactoryHandle(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
-		if (category == mRegisterFactoryItems.end())
+		return getItem(_category, _type, true);
+	}
+
+	IObject* FactoryManager::createObject(FactoryHandle _handle)
+	{
+		if (_handle == nullptr)
+			return nullptr;
+
+		FactoryItem* item = _handle->rename != nullptr ? _handle->rename : _handle;
+		if (item->delegate.empty())
+			return nullptr;
+
+		IObject* result = nullptr;
+		item->delegate(result);
+		return result;
+	}
+
+	size_t FactoryManager::getHash(const std::string& _category, const std::string& _type)
+	{
+		// FNV-1a
+		size_t result = 2166136261u;
+		for (std::string::const_iterator symbol = _category.begin(); symbol != _category.end(); ++symbol)
+			result = (result ^ (unsigned char)*symbol) * 16777619u;
+		result = (result ^ (unsigned char)'/') * 16777619u;
+		for (std::string::const_iterator symbol = _type.begin(); symbol != _type.end(); ++symbol)
+			result = (result ^ (unsigned char)*symbol) * 16777619u;
+		return result;
+	}
+
+	FactoryItem* FactoryManager::findItem(const std::string& _category, const std::string& _type, size_t _hash) const
+	{
+		for (FactoryItem* item = mBuckets[_hash & (mBuckets.size() - 1)]; item != nullptr; item = item->next)
 		{
-			return;
+			if (item->hash == _hash && item->type == _type && item->category == _category)
+				return item;
 		}
-		mRegisterFactoryItems.erase(category);
+		return nullptr;
 	}
 
-	IObject* FactoryManager::createObject(const std::string& _category, const std::string& _type)
+	FactoryItem* FactoryManager::getItem(const std::string& _category, const std::string& _type, bool _rename)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
-		if (category == mRegisterFactoryItems.end())
+		size_t hash = getHash(_category, _type);
+		FactoryItem* item = findItem(_category, _type, hash);
+		if (item == nullptr)
 		{
-			return nullptr;
+			item = new FactoryItem(_category, _type, hash);
+			mItems.push_back(item);
+
+			size_t bucket = hash & (mBuckets.size() - 1);
+			item->next = mBuckets[bucket];
+			mBuckets[bucket] = item;
+
+			if (mItems.size() > mBuckets.size())
+				rehash(mBuckets.size() * 2);
 		}
 
-		std::string typeName = BackwardCompatibility::getFactoryRename(_category, _type);
-		MapFactoryItem::iterator type = category->second.find(typeName);
-		if (type == category->second.end())
+		if (_rename && !item->renameChecked)
 		{
-			return nullptr;
+			item->renameChecked = true;
+			std::string typeName = BackwardCompatibility::getFactoryRename(_category, _type);
+			if (typeName != _type)
+				item->rename = getItem(_category, typeName, false);
 		}
-		if (type->second.empty())
+
+		return item;
+	}
+
+	void FactoryManager::rehash(size_t _bucketsCount)
+	{
+		mBuckets.assign(_bucketsCount, nullptr);
+		for (VectorFactoryItem::iterator item = mItems.begin(); item != mItems.end(); ++item)
 		{
-			return nullptr;
+			size_t bucket = (*item)->hash & (_bucketsCount - 1);
+			(*item)->next = mBuckets[bucket];
+			mBuckets[bucket] = *item;
 		}
-
-		IObject* result = nullptr;
-		type->second(result);
-		return result;
 	}
 
 	void FactoryManager::destroyObject(IObject* _object)
@@ -132,18 +234,8 @@ namespace MyGUI
 
 	bool FactoryManager::isFactoryExist(const std::string& _category, const std::string& _type)
 	{
-		MapRegisterFactoryItem::iterator category = mRegisterFactoryItems.find(_category);
-		if (category == mRegisterFactoryItems.end())
-		{
-			return false;
-		}
-		MapFactoryItem::iterator type = category->second.find(_type);
-		if (type == category->second.end())
-		{
-			return false;
-		}
-
-		return true;
+		FactoryItem* item = findItem(_category, _type, getHash(_category, _type));
+		return item != nullptr && !item->delegate.empty();
 	}
 
 } // namespace MyGUI
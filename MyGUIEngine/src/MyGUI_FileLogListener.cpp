@@ -23,12 +23,21 @@
 #include "MyGUI_FileLogListener.h"
 #include <iomanip>
 #include <time.h>
+#include <stdio.h>
+
+#if MYGUI_COMPILER == MYGUI_COMPILER_MSVC && MYGUI_COMP_VER < 1900
+#	define snprintf _snprintf
+#endif
 
 namespace MyGUI
 {
 
-	FileLogListener::FileLogListener()
+	FileLogListener::FileLogListener() :
+		mTimeHour(-1),
+		mTimeMinute(-1),
+		mTimeSecond(-1)
 	{
+		mTimeText[0] = 0;
 	}
 
 	FileLogListener::~FileLogListener()
@@ -73,12 +82,19 @@ namespace MyGUI
 	{
 		if (mStream.is_open())
 		{
+			// time is formatted once per second, stream is flushed by LogManager
+			if (_time->tm_sec != mTimeSecond || _time->tm_min != mTimeMinute || _time->tm_hour != mTimeHour)
+			{
+				mTimeHour = _time->tm_hour;
+				mTimeMinute = _time->tm_min;
+				mTimeSecond = _time->tm_sec;
+				snprintf(mTimeText, sizeof(mTimeText), "%02u:%02u:%02u", (unsigned int)mTimeHour % 100, (unsigned int)mTimeMinute % 100, (unsigned int)mTimeSecond % 100);
+			}
+
 			const char* separator = "  |  ";
-			mStream << std::setw(2) << std::setfill('0') << _time->tm_hour << ":"
-				<< std::setw(2) << std::setfill('0') << _time->tm_min << ":"
-				<< std::setw(2) << std::setfill('0') << _time->tm_sec << separator
+			mStream << mTimeText << separator
 				<< _section << separator << _level.print() << separator
-				<< _message << separator << _file << separator << _line << std::endl;
+				<< _message << separator << _file << separator << _line << '\n';
 		}
 	}
 
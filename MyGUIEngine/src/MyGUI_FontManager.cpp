@@ -85,6 +85,9 @@ namespace MyGUI
 
 		MyGUI::ResourceManager::getInstance().unregisterLoadXmlDelegate(mXmlFontTagName);
 
+		GlyphAtlas::Statistics statistics = mGlyphAtlas.getStatistics();
+		MYGUI_LOG(Info, "Glyph atlas: " << statistics.pages << " pages, " << (int)(statistics.getOccupancy() * 100) << "% used");
+
 		std::string resourceCategory = ResourceManager::getInstance().getCategoryName();
 		FactoryManager::getInstance().unregisterFactory<ResourceManualFont>(resourceCategory);
 		FactoryManager::getInstance().unregisterFactory<ResourceTrueTypeFont>(resourceCategory);
@@ -226,6 +229,15 @@ namespace MyGUI
         ftStreamRec.size = datastream->size();
         ftStreamRec.pos = 0;
         ftStreamRec.read = ft_stream_read;
+
+        // stream content is in memory, FreeType reads it directly without callbacks
+        const unsigned char* data = datastream->data();
+        if (data != nullptr)
+        {
+            ftStreamRec.base = const_cast<unsigned char*>(data);
+            ftStreamRec.read = nullptr;
+        }
+
         ftStreamRec.close = ft_stream_close;
 
         return pFontDataStream;
@@ -245,14 +257,28 @@ namespace MyGUI
 
     void FontManager::prepareFont()
     {
-        for (FontPrepareRegistry::iterator itr = mDirtyFont.begin(); itr != mDirtyFont.end(); ++itr)
+        // fonts with glyphs still rendering in background register again for the next frame
+        FontPrepareRegistry fonts;
+        fonts.swap(mDirtyFont);
+
+        for (FontPrepareRegistry::iterator itr = fonts.begin(); itr != fonts.end(); ++itr)
         {
             (*itr)->prepareTexture();
         }
 
-        mDirtyFont.clear();
+        mGlyphAtlas.update();
     }
 
+	bool FontManager::isPrepareRequired() const
+	{
+		return !mDirtyFont.empty();
+	}
+
+	GlyphAtlas& FontManager::getGlyphAtlas()
+	{
+		return mGlyphAtlas;
+	}
+
 	const std::string& FontManager::getDefaultFont() const
 	{
 		return mDefaultName;
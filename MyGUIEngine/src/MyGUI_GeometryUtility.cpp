@@ -22,6 +22,10 @@
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_GeometryUtility.h"
 
+#ifdef MYGUI_USE_SSE
+#	include <xmmintrin.h>
+#endif
+
 namespace MyGUI
 {
 
@@ -101,6 +105,87 @@ namespace MyGUI
 			_verticies = newVerticies;
 		}
 
+		size_t cropPolygon(const FloatPoint* _baseVerticiesPos, size_t _size, const IntCoord& _cropRectangle, FloatPoint* _result, FloatPoint* _temp)
+		{
+			// result and temp buffers are used in turn, so after four sides result ends in _result
+			size_t size = cropPolygonSide(_baseVerticiesPos, _size, _temp, (float)_cropRectangle.left, Left);
+			size = cropPolygonSide(_temp, size, _result, (float)_cropRectangle.right(), Right);
+			size = cropPolygonSide(_result, size, _temp, (float)_cropRectangle.top, Top);
+			return cropPolygonSide(_temp, size, _result, (float)_cropRectangle.bottom(), Bottom);
+		}
+
+		size_t cropPolygonSide(const FloatPoint* _verticies, size_t _size, FloatPoint* _result, float _sideCoord, Side _side)
+		{
+			if (_size == 0)
+				return 0;
+
+			const float invert = (_side == Right || _side == Bottom) ? -1.0f : 1.0f;
+			const bool horizontal = (_side == Left || _side == Right);
+
+			size_t count = 0;
+			const FloatPoint* v0 = &_verticies[_size - 1];
+			float distance0 = invert * ((horizontal ? v0->left : v0->top) - _sideCoord);
+			for (size_t i = 0; i < _size; ++i)
+			{
+				const FloatPoint* v1 = &_verticies[i];
+				float distance1 = invert * ((horizontal ? v1->left : v1->top) - _sideCoord);
+
+				if (distance0 >= 0)
+					_result[count++] = *v0;
+
+				// edge crosses side
+				if ((distance0 >= 0 && distance1 < 0) || (distance0 < 0 && distance1 > 0))
+				{
+					float k = distance0 / (distance0 - distance1);
+					if (horizontal)
+						_result[count++] = FloatPoint(_sideCoord, v0->top + k * (v1->top - v0->top));
+					else
+						_result[count++] = FloatPoint(v0->left + k * (v1->left - v0->left), _sideCoord);
+				}
+
+				v0 = v1;
+				distance0 = distance1;
+			}
+
+			return count;
+		}
+
+		bool isPolygonInsideRect(const FloatPoint* _verticies, size_t _size, const IntCoord& _rect)
+		{
+			const float left = (float)_rect.left;
+			const float top = (float)_rect.top;
+			const float right = (float)_rect.right();
+			const float bottom = (float)_rect.bottom();
+
+			size_t index = 0;
+#ifdef MYGUI_USE_SSE
+			// test four verticies at once
+			const __m128 minX = _mm_set1_ps(left);
+			const __m128 minY = _mm_set1_ps(top);
+			const __m128 maxX = _mm_set1_ps(right);
+			const __m128 maxY = _mm_set1_ps(bottom);
+			for (; index + 4 <= _size; index += 4)
+			{
+				const FloatPoint* point = &_verticies[index];
+				__m128 x = _mm_set_ps(point[3].left, point[2].left, point[1].left, point[0].left);
+				__m128 y = _mm_set_ps(point[3].top, point[2].top, point[1].top, point[0].top);
+				__m128 outside = _mm_or_ps(
+					_mm_or_ps(_mm_cmplt_ps(x, minX), _mm_cmpgt_ps(x, maxX)),
+					_mm_or_ps(_mm_cmplt_ps(y, minY), _mm_cmpgt_ps(y, maxY)));
+				if (_mm_movemask_ps(outside) != 0)
+					return false;
+			}
+#endif
+			for (; index < _size; ++index)
+			{
+				const FloatPoint& point = _verticies[index];
+				if (point.left < left || point.left > right || point.top < top || point.top > bottom)
+					return false;
+			}
+
+			return true;
+		}
+
 		FloatPoint getPositionInsideRect(const FloatPoint& _point, const FloatPoint& _corner0, const FloatPoint& _corner1, const FloatPoint& _corner2)
 		{
 			FloatPoint result;
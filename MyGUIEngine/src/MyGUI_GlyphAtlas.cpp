@@ -0,0 +1,293 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_GlyphAtlas.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_ITexture.h"
+
+namespace MyGUI
+{
+
+	GlyphAtlas::GlyphAtlas() :
+		mPageSize(512)
+	{
+	}
+
+	GlyphAtlas::~GlyphAtlas()
+	{
+		clear();
+	}
+
+	bool GlyphAtlas::allocate(const void* _owner, int _width, int _height, PixelFormat _format, TextureUsage _usage, Region& _region)
+	{
+		// empty glyphs still get their own pixel, so they have valid texture coordinates
+		int width = std::max(_width, 1);
+		int height = std::max(_height, 1);
+
+		if (width > mPageSize || height > mPageSize || getNumElemBytes(_format) == 0)
+			return false;
+
+		Page* page = nullptr;
+		int x = 0;
+		int y = 0;
+		size_t index = 0;
+
+		for (VectorPage::iterator item = mPages.begin(); item != mPages.end(); ++item)
+		{
+			if ((*item)->format == _format && (*item)->usage == _usage && findPosition(*item, width, height, x, y, index))
+			{
+				page = *item;
+				break;
+			}
+		}
+
+		if (page == nullptr)
+		{
+			page = createPage(_format, _usage);
+			if (!findPosition(page, width, height, x, y, index))
+				return false;
+		}
+
+		addSkylineLevel(page, index, x, y, width, height);
+
+		size_t pixels = (size_t)(width * height);
+		page->owners[_owner] += pixels;
+		page->usedPixels += pixels;
+		page->dirty = true;
+
+		_region.texture = page->texture;
+		_region.pitch = page->size * page->numElemBytes;
+		_region.memory = page->memory + y * _region.pitch + x * page->numElemBytes;
+		_region.coord.set(x, y, _width, _height);
+		_region.textureSize.set(page->size, page->size);
+		_region.uvRect.set(
+			(float)x / page->size,
+			(float)y / page->size,
+			(float)(x + _width) / page->size,
+			(float)(y + _height) / page->size);
+
+		return true;
+	}
+
+	void GlyphAtlas::release(const void* _owner)
+	{
+		for (VectorPage::iterator item = mPages.begin(); item != mPages.end(); )
+		{
+			Page* page = *item;
+
+			MapOwnerPixels::iterator owner = page->owners.find(_owner);
+			if (owner != page->owners.end())
+			{
+				page->usedPixels -= owner->second;
+				page->owners.erase(owner);
+			}
+
+			// skyline can't free single rectangles, so page lives while any rectangle on it is used
+			if (page->owners.empty())
+			{
+				destroyPage(page);
+				item = mPages.erase(item);
+			}
+			else
+			{
+				++item;
+			}
+		}
+	}
+
+	void GlyphAtlas::setDirty(const Region& _region)
+	{
+		for (VectorPage::iterator item = mPages.begin(); item != mPages.end(); ++item)
+		{
+			if ((*item)->texture == _region.texture)
+			{
+				(*item)->dirty = true;
+				break;
+			}
+		}
+	}
+
+	void GlyphAtlas::update()
+	{
+		for (VectorPage::iterator item = mPages.begin(); item != mPages.end(); ++item)
+		{
+			Page* page = *item;
+			if (page->dirty)
+			{
+				page->texture->loadFromMemory(page->memory);
+				page->dirty = false;
+			}
+		}
+	}
+
+	void GlyphAtlas::clear()
+	{
+		for (VectorPage::iterator item = mPages.begin(); item != mPages.end(); ++item)
+			destroyPage(*item);
+		mPages.clear();
+	}
+
+	void GlyphAtlas::setPageSize(int _value)
+	{
+		mPageSize = _value;
+	}
+
+	int GlyphAtlas::getPageSize() const
+	{
+		return mPageSize;
+	}
+
+	GlyphAtlas::Statistics GlyphAtlas::getStatistics() const
+	{
+		Statistics result;
+		for (VectorPage::const_iterator item = mPages.begin(); item != mPages.end(); ++item)
+		{
+			const Page* page = *item;
+			result.pages ++;
+			result.owners += page->owners.size();
+			result.usedPixels += page->usedPixels;
+			result.totalPixels += (size_t)(page->size * page->size);
+		}
+		return result;
+	}
+
+	size_t GlyphAtlas::getNumElemBytes(PixelFormat _format)
+	{
+		if (_format == PixelFormat::L8)
+			return 1;
+		else if (_format == PixelFormat::L8A8)
+			return 2;
+		else if (_format == PixelFormat::R8G8B8)
+			return 3;
+		else if (_format == PixelFormat::R8G8B8A8)
+			return 4;
+		return 0;
+	}
+
+	GlyphAtlas::Page* GlyphAtlas::createPage(PixelFormat _format, TextureUsage _usage)
+	{
+		static int pageGUID = 0;
+
+		Page* page = new Page();
+		page->size = mPageSize;
+		page->numElemBytes = getNumElemBytes(_format);
+		page->format = _format;
+		page->usage = _usage;
+		page->usedPixels = 0;
+		page->dirty = true;
+
+		size_t size = page->size * page->size * page->numElemBytes;
+		page->memory = new uint8[size];
+		memset(page->memory, 0, size);
+
+		page->texture = RenderManager::getInstance().createTexture(utility::toString(++pageGUID, "_GlyphAtlas"));
+		page->texture->createManual(page->size, page->size, _usage, _format);
+
+		Segment segment = { 0, 0, page->size };
+		page->skyline.push_back(segment);
+
+		mPages.push_back(page);
+		return page;
+	}
+
+	void GlyphAtlas::destroyPage(Page* _page)
+	{
+		if (RenderManager::getInstancePtr() != nullptr)
+			RenderManager::getInstance().destroyTexture(_page->texture);
+
+		delete[] _page->memory;
+		delete _page;
+	}
+
+	bool GlyphAtlas::findPosition(const Page* _page, int _width, int _height, int& _x, int& _y, size_t& _index) const
+	{
+		int bestY = _page->size;
+		bool found = false;
+
+		const VectorSegment& skyline = _page->skyline;
+		for (size_t index = 0; index < skyline.size(); ++index)
+		{
+			int x = skyline[index].x;
+			if (x + _width > _page->size)
+				break;
+
+			// rectangle lies on the highest segment under it
+			int y = skyline[index].y;
+			int widthLeft = _width;
+			for (size_t next = index; widthLeft > 0; ++next)
+			{
+				y = std::max(y, skyline[next].y);
+				widthLeft -= skyline[next].width;
+			}
+
+			if (y + _height <= _page->size && y < bestY)
+			{
+				bestY = y;
+				_x = x;
+				_y = y;
+				_index = index;
+				found = true;
+			}
+		}
+
+		return found;
+	}
+
+	void GlyphAtlas::addSkylineLevel(Page* _page, size_t _index, int _x, int _y, int _width, int _height)
+	{
+		VectorSegment& skyline = _page->skyline;
+
+		Segment segment = { _x, _y + _height, _width };
+		skyline.insert(skyline.begin() + _index, segment);
+
+		// cut segments covered by the new one
+		for (size_t index = _index + 1; index < skyline.size(); )
+		{
+			int end = skyline[index - 1].x + skyline[index - 1].width;
+			if (skyline[index].x >= end)
+				break;
+
+			int shrink = end - skyline[index].x;
+			skyline[index].x += shrink;
+			skyline[index].width -= shrink;
+
+			if (skyline[index].width > 0)
+				break;
+
+			skyline.erase(skyline.begin() + index);
+		}
+
+		// merge neighbours of the same height
+		for (size_t index = 0; index + 1 < skyline.size(); )
+		{
+			if (skyline[index].y == skyline[index + 1].y)
+			{
+				skyline[index].width += skyline[index + 1].width;
+				skyline.erase(skyline.begin() + index + 1);
+			}
+			else
+			{
+				++index;
+			}
+		}
+	}
+
+} // namespace MyGUI
@@ -42,6 +42,7 @@
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_ToolTipManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_Timer.h"
 
 namespace MyGUI
 {
@@ -129,7 +130,11 @@ namespace MyGUI
 
 		// загружаем дефолтные настройки если надо
 		if (!_core.empty())
+		{
+			Timer timer;
 			mResourceManager->load(_core);
+			MYGUI_LOG(Info, "Core resources '" << _core << "' loaded in " << timer.getMilliseconds() << " ms");
+		}
 
 		BackwardCompatibility::initialise();
 
@@ -350,7 +355,50 @@ namespace MyGUI
 
 	void Gui::frameEvent(float _time)
 	{
+		// managers are called directly, so eventFrameStart has delegates only while something is animated
+		mWidgetManager->notifyEventFrameStart(_time);
+		mInputManager->frameEntered(_time);
+		mPointerManager->notifyFrameStart(_time);
+		mDynLibManager->notifyEventFrameStart(_time);
+		mToolTipManager->notifyEventFrameStart(_time);
+
 		eventFrameStart(_time);
+
+		// coordinates changed by input and frame handlers are aligned once before rendering
+		mWidgetManager->_updateLayout();
+	}
+
+	bool Gui::isFrameRequired() const
+	{
+		return getNextFrameDelay() == 0.0f;
+	}
+
+	float Gui::getNextFrameDelay() const
+	{
+		if (!eventFrameStart.empty())
+			return 0.0f;
+
+		if (mLayerManager->isOutOfDate() || mFontManager->isPrepareRequired())
+			return 0.0f;
+
+		float delays[] =
+		{
+			mInputManager->_getNextFrameDelay(),
+			mWidgetManager->_getNextFrameDelay(),
+			mDynLibManager->_getNextFrameDelay(),
+			mToolTipManager->_getNextFrameDelay()
+		};
+
+		float result = -1.0f;
+		for (size_t index = 0; index < sizeof(delays) / sizeof(delays[0]); ++index)
+		{
+			if (delays[index] < 0.0f)
+				continue;
+			if (result < 0.0f || delays[index] < result)
+				result = delays[index];
+		}
+
+		return result;
 	}
 
 } // namespace MyGUI
@@ -50,6 +50,9 @@ namespace MyGUI
 		mFirstPressKey(false),
 		mTimerKey(0.0f),
 		mOldAbsZ(0),
+		mInputPending(false),
+		mMouseMoveCoalescing(false),
+		mMouseMoveQueued(false),
 		mIsInitialise(false)
 	{
 		resetMouseCaptureWidget();
@@ -74,9 +77,9 @@ namespace MyGUI
 		mFirstPressKey = true;
 		mTimerKey = 0.0f;
 		mOldAbsZ = 0;
+		mMouseMoveQueued = false;
 
 		WidgetManager::getInstance().registerUnlinker(this);
-		Gui::getInstance().eventFrameStart += newDelegate(this, &InputManager::frameEntered);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
@@ -87,14 +90,45 @@ namespace MyGUI
 		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
 		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
 
-		Gui::getInstance().eventFrameStart -= newDelegate(this, &InputManager::frameEntered);
 		WidgetManager::getInstance().unregisterUnlinker(this);
 
+		mMouseMoveQueued = false;
+
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
 		mIsInitialise = false;
 	}
 
 	bool InputManager::injectMouseMove(int _absx, int _absy, int _absz)
+	{
+		mInputPending = true;
+		mStatistics.eventsReceived ++;
+
+		// wheel is relative to previous event, so it is never coalesced
+		if (mMouseMoveCoalescing && _absz == mOldAbsZ)
+		{
+			mMousePosition.set(_absx, _absy);
+			mMouseMoveQueued = true;
+			return isCaptureMouse() || isFocusMouse();
+		}
+
+		flushMouseMove();
+
+		mStatistics.eventsProcessed ++;
+		return processMouseMove(_absx, _absy, _absz);
+	}
+
+	void InputManager::flushMouseMove()
+	{
+		if (!mMouseMoveQueued)
+			return;
+
+		mMouseMoveQueued = false;
+
+		mStatistics.eventsProcessed ++;
+		processMouseMove(mMousePosition.left, mMousePosition.top, mOldAbsZ);
+	}
+
+	bool InputManager::processMouseMove(int _absx, int _absy, int _absz)
 	{
 		// запоминаем позицию
 		mMousePosition.set(_absx, _absy);
@@ -146,6 +180,7 @@ namespace MyGUI
 		Widget* old_mouse_focus = mWidgetMouseFocus;
 
 		// ищем активное окно
+		mStatistics.picks ++;
 		Widget* item = LayerManager::getInstance().getWidgetFromPoint(_absx, _absy);
 
 		// ничего не изменилось
@@ -239,7 +274,13 @@ namespace MyGUI
 
 	bool InputManager::injectMousePress(int _absx, int _absy, MouseButton _id)
 	{
-		injectMouseMove(_absx, _absy, mOldAbsZ);
+		mInputPending = true;
+		mStatistics.eventsReceived ++;
+		mStatistics.eventsProcessed ++;
+
+		// stored move is replaced by move to the press position
+		mMouseMoveQueued = false;
+		processMouseMove(_absx, _absy, mOldAbsZ);
 
 		Widget* old_key_focus = mWidgetKeyFocus;
 
@@ -313,6 +354,12 @@ namespace MyGUI
 
 	bool InputManager::injectMouseRelease(int _absx, int _absy, MouseButton _id)
 	{
+		mInputPending = true;
+		mStatistics.eventsReceived ++;
+
+		flushMouseMove();
+		mStatistics.eventsProcessed ++;
+
 		if (isFocusMouse())
 		{
 			// если активный элемент заблокирован
@@ -351,6 +398,7 @@ namespace MyGUI
                         else
                         {
                             // проверяем над тем ли мы окном сейчас что и были при нажатии
+                            mStatistics.picks ++;
                             Widget* item = LayerManager::getInstance().getWidgetFromPoint(_absx, _absy);
                             if ( item == mWidgetMouseFocus)
                             {
@@ -363,7 +411,7 @@ namespace MyGUI
 			}
 
 			// для корректного отображения
-			injectMouseMove(_absx, _absy, mOldAbsZ);
+			processMouseMove(_absx, _absy, mOldAbsZ);
 
 			return true;
 		}
@@ -373,6 +421,12 @@ namespace MyGUI
 
 	bool InputManager::injectKeyPress(KeyCode _key, Char _text)
 	{
+		mInputPending = true;
+		mStatistics.eventsReceived ++;
+
+		flushMouseMove();
+		mStatistics.eventsProcessed ++;
+
 		// проверка на переключение языков
 		firstEncoding(_key, true);
 
@@ -392,6 +446,12 @@ namespace MyGUI
 
 	bool InputManager::injectKeyRelease(KeyCode _key)
 	{
+		mInputPending = true;
+		mStatistics.eventsReceived ++;
+
+		flushMouseMove();
+		mStatistics.eventsProcessed ++;
+
 		// проверка на переключение языков
 		firstEncoding(_key, false);
 
@@ -585,6 +645,11 @@ namespace MyGUI
 
 	void InputManager::frameEntered(float _frame)
 	{
+		// widgets under mouse are picked once per frame
+		flushMouseMove();
+
+		mInputPending = false;
+
 		if ( mHoldKey == KeyCode::None)
 			return;
 
@@ -620,6 +685,18 @@ namespace MyGUI
 
 	}
 
+	float InputManager::_getNextFrameDelay() const
+	{
+		if (mInputPending || mMouseMoveQueued)
+			return 0.0f;
+
+		if (mHoldKey == KeyCode::None)
+			return -1.0f;
+
+		float delay = (mFirstPressKey ? INPUT_DELAY_FIRST_KEY : INPUT_INTERVAL_KEY) - mTimerKey;
+		return std::max(delay, 0.0f);
+	}
+
 	void InputManager::resetKeyFocusWidget(Widget* _widget)
 	{
 		if (mWidgetKeyFocus == _widget)
@@ -697,6 +774,28 @@ namespace MyGUI
 		return mIsShiftPressed;
 	}
 
+	void InputManager::setMouseMoveCoalescing(bool _value)
+	{
+		mMouseMoveCoalescing = _value;
+		if (!mMouseMoveCoalescing)
+			flushMouseMove();
+	}
+
+	bool InputManager::getMouseMoveCoalescing() const
+	{
+		return mMouseMoveCoalescing;
+	}
+
+	const InputManager::Statistics& InputManager::getStatistics() const
+	{
+		return mStatistics;
+	}
+
+	void InputManager::resetStatistics()
+	{
+		mStatistics = Statistics();
+	}
+
 	void InputManager::resetMouseCaptureWidget()
 	{
 		for (int i = MouseButton::Button0; i < MouseButton::MAX; ++i)
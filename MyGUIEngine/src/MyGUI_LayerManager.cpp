@@ -38,7 +38,9 @@ namespace MyGUI
 
 	LayerManager::LayerManager() :
 		mIsInitialise(false),
-		mCategoryName("Layer")
+		mCategoryName("Layer"),
+		mDirtyRegionReady(false),
+		mPartialRedraw(false)
 	{
 	}
 
@@ -221,10 +223,69 @@ namespace MyGUI
 
 	void LayerManager::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		if (!mDirtyRegionReady || _update)
+			updateDirtyRegion(_update);
+		mDirtyRegionReady = false;
+
+		const RenderTargetInfo& info = _target->getInfo();
+		if (mPartialRedraw && !mDirtyRegion.isFull())
+			info.setDirtyRegion(&mDirtyRegion);
+
 		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
 		{
 			(*iter)->renderToTarget(_target, _update);
 		}
+
+		info.setDirtyRegion(nullptr);
+	}
+
+	const DirtyRegion& LayerManager::updateDirtyRegion(bool _update)
+	{
+		mDirtyRegion.clear();
+
+		// layers forget their changes after this, so they are collected even if everything is redrawn
+		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
+			(*iter)->addDirtyRegion(mDirtyRegion);
+
+		if (_update)
+			mDirtyRegion.setFull();
+
+		mDirtyRegion.optimise(RenderManager::getInstance().getViewSize());
+		mDirtyRegionReady = true;
+
+		return mDirtyRegion;
+	}
+
+	const DirtyRegion& LayerManager::getDirtyRegion() const
+	{
+		return mDirtyRegion;
+	}
+
+	bool LayerManager::isOutOfDate() const
+	{
+		for (VectorLayer::const_iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
+		{
+			if ((*iter)->isOutOfDate())
+				return true;
+		}
+
+		return false;
+	}
+
+	void LayerManager::setPartialRedraw(bool _value)
+	{
+		if (_value && !RenderManager::getInstance().isPartialRedrawSupported())
+		{
+			MYGUI_LOG(Warning, "Partial redraw is not supported by render system, it stays disabled");
+			return;
+		}
+
+		mPartialRedraw = _value;
+	}
+
+	bool LayerManager::getPartialRedraw() const
+	{
+		return mPartialRedraw;
 	}
 
 	ILayer* LayerManager::getByName(const std::string& _name, bool _throw) const
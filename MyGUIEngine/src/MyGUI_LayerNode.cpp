@@ -26,20 +26,31 @@
 #include "MyGUI_ITexture.h"
 #include "MyGUI_ISubWidget.h"
 #include "MyGUI_ISubWidgetText.h"
+#include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_Bitwise.h"
 
 namespace MyGUI
 {
 
+	size_t LayerNode::msCacheTextureMemory = 0;
+
 	LayerNode::LayerNode(ILayer* _layer, ILayerNode* _parent) :
 		mParent(_parent),
 		mLayer(_layer),
 		mOutOfDate(false),
-		mDepth(0.0f)
+		mDepth(0.0f),
+		mCacheToTexture(false),
+		mCacheMajorUpdate(false),
+		mCacheTexture(nullptr),
+		mCacheVertexBuffer(nullptr)
 	{
 	}
 
 	LayerNode::~LayerNode()
 	{
+		destroyCache();
+
 		for (VectorRenderItem::iterator iter = mFirstRenderItems.begin(); iter != mFirstRenderItems.end(); ++iter)
 			delete (*iter);
 		mFirstRenderItems.clear();
@@ -69,6 +80,8 @@ namespace MyGUI
 		{
 			if ((*iter) == _node)
 			{
+				mDirtyRect = DirtyRegion::combine(mDirtyRect, static_cast<LayerNode*>(_node)->getNodeRect());
+
 				delete _node;
 				mChildItems.erase(iter);
 
@@ -89,6 +102,8 @@ namespace MyGUI
 				mChildItems.erase(iter);
 				mChildItems.push_back(_item);
 
+				mDirtyRect = DirtyRegion::combine(mDirtyRect, static_cast<LayerNode*>(_item)->getNodeRect());
+
 				mOutOfDate = true;
 
 				return;
@@ -98,6 +113,20 @@ namespace MyGUI
 	}
 
 	void LayerNode::renderToTarget(IRenderTarget* _target, bool _update)
+	{
+		if (mCacheToTexture && renderToCache(_target, _update))
+			return;
+
+		if (mCacheMajorUpdate)
+		{
+			_update = true;
+			mCacheMajorUpdate = false;
+		}
+
+		renderNodeToTarget(_target, _update);
+	}
+
+	void LayerNode::renderNodeToTarget(IRenderTarget* _target, bool _update)
 	{
 		mDepth = _target->getInfo().maximumDepth;
 
@@ -365,4 +394,172 @@ namespace MyGUI
 		return mDepth;
 	}
 
+	void LayerNode::addDirtyRegion(DirtyRegion& _region)
+	{
+		for (VectorRenderItem::const_iterator iter = mFirstRenderItems.begin(); iter != mFirstRenderItems.end(); ++iter)
+			(*iter)->addDirtyRegion(_region);
+
+		for (VectorRenderItem::const_iterator iter = mSecondRenderItems.begin(); iter != mSecondRenderItems.end(); ++iter)
+			(*iter)->addDirtyRegion(_region);
+
+		for (VectorILayerNode::iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
+			(*iter)->addDirtyRegion(_region);
+
+		_region.addRect(mDirtyRect);
+		mDirtyRect.clear();
+	}
+
+	IntRect LayerNode::getNodeRect() const
+	{
+		IntRect result;
+
+		for (VectorRenderItem::const_iterator iter = mFirstRenderItems.begin(); iter != mFirstRenderItems.end(); ++iter)
+			result = DirtyRegion::combine(result, (*iter)->getRenderRect());
+
+		for (VectorRenderItem::const_iterator iter = mSecondRenderItems.begin(); iter != mSecondRenderItems.end(); ++iter)
+			result = DirtyRegion::combine(result, (*iter)->getRenderRect());
+
+		for (VectorILayerNode::const_iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
+			result = DirtyRegion::combine(result, static_cast<const LayerNode*>(*iter)->getNodeRect());
+
+		return result;
+	}
+
+	void LayerNode::setCacheToTexture(bool _value)
+	{
+		if (mCacheToTexture == _value)
+			return;
+
+		mCacheToTexture = _value;
+		if (!mCacheToTexture)
+			destroyCache();
+
+		mCacheMajorUpdate = true;
+	}
+
+	bool LayerNode::getCacheToTexture() const
+	{
+		return mCacheToTexture;
+	}
+
+	size_t LayerNode::getCacheTextureMemory()
+	{
+		return msCacheTextureMemory;
+	}
+
+	bool LayerNode::renderToCache(IRenderTarget* _target, bool _update)
+	{
+		if (mLayerItems.size() != 1)
+		{
+			destroyCache();
+			return false;
+		}
+
+		const IntCoord& coord = mLayerItems.front()->getLayerItemCoord();
+		if (coord.width <= 0 || coord.height <= 0)
+		{
+			destroyCache();
+			return false;
+		}
+
+		bool textureChanged = checkCacheTexture(coord.size());
+		if (mCacheTexture == nullptr)
+			return false;
+
+		IRenderTarget* target = mCacheTexture->getRenderTarget();
+		if (target == nullptr)
+		{
+			MYGUI_LOG(Warning, "Render target textures are not supported, layer node is rendered without cache");
+			mCacheToTexture = false;
+			destroyCache();
+			return false;
+		}
+
+		// any changed render item in subtree marks whole texture as out of date
+		if (_update || textureChanged || mCacheMajorUpdate || coord != mCacheCoord || isOutOfDate())
+		{
+			mCacheCoord = coord;
+
+			// vertices are generated relative to the cached rectangle
+			target->getInfo().setOffset(mCacheCoord.left, mCacheCoord.top);
+
+			target->begin();
+			renderNodeToTarget(target, _update || textureChanged || mCacheMajorUpdate);
+			target->end();
+
+			mCacheMajorUpdate = false;
+
+			const RenderTargetInfo& info = _target->getInfo();
+
+			float vertex_left = ((info.pixScaleX * (float)(mCacheCoord.left - info.leftOffset) + info.hOffset) * 2) - 1;
+			float vertex_right = vertex_left + (info.pixScaleX * (float)mCacheCoord.width * 2);
+			float vertex_top = -(((info.pixScaleY * (float)(mCacheCoord.top - info.topOffset) + info.vOffset) * 2) - 1);
+			float vertex_bottom = vertex_top - (info.pixScaleY * (float)mCacheCoord.height * 2);
+
+			float texture_u = (float)mCacheCoord.width / (float)mCacheTextureSize.width;
+			float texture_v = (float)mCacheCoord.height / (float)mCacheTextureSize.height;
+
+			VertexQuad* quad = reinterpret_cast<VertexQuad*>(mCacheVertexBuffer->lock());
+			if (quad != nullptr)
+			{
+				quad->set(
+					vertex_left, vertex_top, vertex_right, vertex_bottom, info.maximumDepth,
+					0, 0, texture_u, texture_v, 0xFFFFFFFF);
+				mCacheVertexBuffer->unlock();
+			}
+		}
+
+		mDepth = _target->getInfo().maximumDepth;
+
+		const DirtyRegion* region = _target->getInfo().dirtyRegion;
+		if (region == nullptr || region->intersect(IntRect(mCacheCoord.left, mCacheCoord.top, mCacheCoord.right(), mCacheCoord.bottom())))
+			_target->doRender(mCacheVertexBuffer, mCacheTexture, VertexQuad::VertexCount);
+
+		return true;
+	}
+
+	bool LayerNode::checkCacheTexture(const IntSize& _size)
+	{
+		if (mCacheTexture != nullptr && mCacheTextureSize.width >= _size.width && mCacheTextureSize.height >= _size.height)
+			return false;
+
+		destroyCache();
+
+		RenderManager& render = RenderManager::getInstance();
+
+		// texture only grows, so resizing widget doesn't recreate it every frame
+		mCacheTextureSize.set(Bitwise::firstPO2From(_size.width), Bitwise::firstPO2From(_size.height));
+		mCacheTexture = render.createTexture(utility::toString((size_t)this, "_LayerNodeCache"));
+		mCacheTexture->createManual(mCacheTextureSize.width, mCacheTextureSize.height, TextureUsage::RenderTarget, PixelFormat::R8G8B8A8);
+
+		mCacheVertexBuffer = render.createVertexBuffer();
+		mCacheVertexBuffer->setVertexCount(VertexQuad::VertexCount);
+
+		msCacheTextureMemory += (size_t)(mCacheTextureSize.width * mCacheTextureSize.height) * 4;
+
+		return true;
+	}
+
+	void LayerNode::destroyCache()
+	{
+		if (mCacheTexture == nullptr)
+			return;
+
+		msCacheTextureMemory -= (size_t)(mCacheTextureSize.width * mCacheTextureSize.height) * 4;
+
+		if (RenderManager::getInstancePtr() != nullptr)
+		{
+			RenderManager::getInstance().destroyTexture(mCacheTexture);
+			RenderManager::getInstance().destroyVertexBuffer(mCacheVertexBuffer);
+		}
+
+		mCacheTexture = nullptr;
+		mCacheVertexBuffer = nullptr;
+		mCacheTextureSize.clear();
+		mCacheCoord.clear();
+
+		// render items keep vertices for the texture
+		mCacheMajorUpdate = true;
+	}
+
 } // namespace MyGUI
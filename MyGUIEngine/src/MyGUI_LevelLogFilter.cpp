@@ -39,6 +39,11 @@ namespace MyGUI
 		return mLevel <= _level;
 	}
 
+	bool LevelLogFilter::isLevelEnabled(LogLevel _level) const
+	{
+		return mLevel <= _level;
+	}
+
 	void LevelLogFilter::setLoggingLevel(LogLevel _value)
 	{
 		mLevel = _value;
@@ -25,11 +25,118 @@
 #include "MyGUI_ConsoleLogListener.h"
 #include "MyGUI_LevelLogFilter.h"
 #include "MyGUI_LogSource.h"
+#include "MyGUI_Thread.h"
 #include <time.h>
 
 namespace MyGUI
 {
 
+	struct LogRecord
+	{
+		LogRecord() :
+			time(0),
+			file(nullptr),
+			line(0),
+			sequence(0)
+		{
+		}
+
+		std::string section;
+		LogLevel level;
+		time_t time;
+		std::string message;
+		const char* file;
+		int line;
+		// position of record in queue, see LogQueue
+		volatile long sequence;
+	};
+
+	// bounded lock free queue for many producers and one consumer
+	// record is free for producer when its sequence equals enqueue position,
+	// and ready for consumer when its sequence equals dequeue position + 1
+	struct LogQueue
+	{
+		LogQueue(size_t _size) :
+			enqueuePosition(0),
+			dequeuePosition(0),
+			stop(0)
+		{
+			size_t size = 2;
+			while (size < _size)
+				size <<= 1;
+
+			records.resize(size);
+			mask = size - 1;
+			for (size_t index = 0; index < size; ++index)
+				records[index].sequence = (long)index;
+		}
+
+		bool push(const std::string& _section, LogLevel _level, time_t _time, const std::string& _message, const char* _file, int _line)
+		{
+			long position = atomic::load(enqueuePosition);
+			LogRecord* record = nullptr;
+			while (true)
+			{
+				record = &records[(size_t)position & mask];
+				long difference = atomic::load(record->sequence) - position;
+				if (difference == 0)
+				{
+					if (atomic::compareExchange(enqueuePosition, position + 1, position) == position)
+						break;
+				}
+				else if (difference < 0)
+				{
+					// queue is full
+					return false;
+				}
+				position = atomic::load(enqueuePosition);
+			}
+
+			record->section = _section;
+			record->level = _level;
+			record->time = _time;
+			record->message = _message;
+			record->file = _file;
+			record->line = _line;
+			atomic::store(record->sequence, position + 1);
+			return true;
+		}
+
+		bool pop(LogRecord& _record)
+		{
+			long position = dequeuePosition;
+			LogRecord& record = records[(size_t)position & mask];
+			if (atomic::load(record.sequence) - (position + 1) < 0)
+				return false;
+
+			_record.section.swap(record.section);
+			_record.message.swap(record.message);
+			_record.level = record.level;
+			_record.time = record.time;
+			_record.file = record.file;
+			_record.line = record.line;
+
+			atomic::store(record.sequence, position + (long)mask + 1);
+			atomic::store(dequeuePosition, position + 1);
+			return true;
+		}
+
+		vector<LogRecord>::type records;
+		size_t mask;
+		volatile long enqueuePosition;
+		volatile long dequeuePosition;
+		volatile long stop;
+
+		Thread thread;
+		// wakes writer thread
+		ThreadEvent writerEvent;
+		// set by writer thread after queue is written
+		ThreadEvent writtenEvent;
+		Mutex flushMutex;
+		// held by writer thread while it uses log sources
+		Mutex sourcesMutex;
+	};
+
 	LogManager* LogManager::msInstance = nullptr;
 
 	LogManager::LogManager() :
@@ -38,13 +145,20 @@ namespace MyGUI
 		mFilter(nullptr),
 		mDefaultSource(nullptr),
 		mLevel(LogLevel::Info),
-		mConsoleEnable(true)
+		mConsoleEnable(true),
+		mCachedTime(0),
+		mQueue(nullptr),
+		mDroppedCount(0),
+		mReportedDroppedCount(0),
+		mWrittenCount(0)
 	{
+		memset(&mCachedTm, 0, sizeof(mCachedTm));
 		msInstance = this;
 	}
 
 	LogManager::~LogManager()
 	{
+		setAsynchronous(false);
 		flush();
 		close();
 
@@ -77,19 +191,158 @@ namespace MyGUI
 
 	void LogManager::flush()
 	{
+		if (mQueue != nullptr)
+		{
+			// writer thread flushes sources after queue is written
+			MutexLock lock(mQueue->flushMutex);
+			long position = atomic::load(mQueue->enqueuePosition);
+			while (atomic::load(mQueue->dequeuePosition) - position < 0)
+			{
+				mQueue->writerEvent.set();
+				mQueue->writtenEvent.wait();
+			}
+			return;
+		}
+
 		for (VectorLogSource::iterator item = mSources.begin(); item != mSources.end(); ++item)
 			(*item)->flush();
 	}
 
 	void LogManager::log(const std::string& _section, LogLevel _level, const std::string& _message, const char* _file, int _line)
 	{
-		time_t ctTime;
-		time(&ctTime);
-		struct tm* currentTime;
-		currentTime = localtime(&ctTime);
+		time_t currentTime = time(nullptr);
+
+		if (mQueue != nullptr)
+		{
+			bool pushed = mQueue->push(_section, _level, currentTime, _message, _file, _line);
+			if (!pushed && _level == LogLevel::Critical)
+			{
+				flush();
+				pushed = mQueue->push(_section, _level, currentTime, _message, _file, _line);
+			}
+
+			if (pushed)
+				mQueue->writerEvent.set();
+			else
+				atomic::increment(mDroppedCount);
+
+			// critical message is usually followed by exception, make sure it is written
+			if (_level == LogLevel::Critical)
+				flush();
+			return;
+		}
+
+		writeMessage(_section, _level, currentTime, _message, _file, _line);
+		flush();
+	}
+
+	bool LogManager::isLevelEnabled(LogLevel _level) const
+	{
+		for (VectorLogSource::const_iterator item = mSources.begin(); item != mSources.end(); ++item)
+		{
+			if ((*item)->isLevelEnabled(_level))
+				return true;
+		}
+		return false;
+	}
+
+	void LogManager::writeMessage(const std::string& _section, LogLevel _level, time_t _time, const std::string& _message, const char* _file, int _line)
+	{
+		const struct tm* currentTime = getTime(_time);
 
 		for (VectorLogSource::iterator item = mSources.begin(); item != mSources.end(); ++item)
 			(*item)->log(_section, _level, currentTime, _message, _file, _line);
+
+		atomic::increment(mWrittenCount);
+	}
+
+	const struct tm* LogManager::getTime(time_t _time)
+	{
+		// localtime is slow, messages usually come in bursts within one second
+		if (_time != mCachedTime)
+		{
+			struct tm* currentTime = localtime(&_time);
+			if (currentTime != nullptr)
+				mCachedTm = *currentTime;
+			mCachedTime = _time;
+		}
+		return &mCachedTm;
+	}
+
+	void LogManager::setAsynchronous(bool _value, size_t _queueSize)
+	{
+		if (_value == (mQueue != nullptr))
+			return;
+
+		if (_value)
+		{
+			mQueue = new LogQueue(_queueSize);
+			if (!mQueue->thread.start(newDelegate(this, &LogManager::writeQueue)))
+			{
+				delete mQueue;
+				mQueue = nullptr;
+			}
+		}
+		else
+		{
+			atomic::store(mQueue->stop, 1);
+			mQueue->writerEvent.set();
+			mQueue->thread.join();
+
+			delete mQueue;
+			mQueue = nullptr;
+		}
+	}
+
+	bool LogManager::getAsynchronous() const
+	{
+		return mQueue != nullptr;
+	}
+
+	size_t LogManager::getDroppedCount() const
+	{
+		return (size_t)mDroppedCount;
+	}
+
+	size_t LogManager::getWrittenCount() const
+	{
+		return (size_t)mWrittenCount;
+	}
+
+	void LogManager::writeQueue()
+	{
+		LogRecord record;
+		while (true)
+		{
+			mQueue->writerEvent.wait();
+			bool stop = atomic::load(mQueue->stop) != 0;
+
+			// lock is taken per message, continuous logging must not block addLogSource
+			while (mQueue->pop(record))
+			{
+				MutexLock lock(mQueue->sourcesMutex);
+				writeMessage(record.section, record.level, record.time, record.message, record.file, record.line);
+			}
+
+			{
+				MutexLock lock(mQueue->sourcesMutex);
+
+				long dropped = atomic::load(mDroppedCount);
+				if (dropped != mReportedDroppedCount)
+				{
+					writeMessage(MYGUI_LOG_SECTION, LogLevel::Warning, time(nullptr), LogStream() << (dropped - mReportedDroppedCount) << " log messages dropped, log queue is full" << LogStream::End(), __FILE__, __LINE__);
+					mReportedDroppedCount = dropped;
+				}
+
+				for (VectorLogSource::iterator item = mSources.begin(); item != mSources.end(); ++item)
+					(*item)->flush();
+			}
+
+			mQueue->writtenEvent.set();
+
+			if (stop)
+				break;
+		}
 	}
 
 	void LogManager::close()
@@ -100,6 +353,14 @@ namespace MyGUI
 
 	void LogManager::addLogSource(LogSource* _source)
 	{
+		// writer thread may be iterating sources right now
+		if (mQueue != nullptr)
+		{
+			MutexLock lock(mQueue->sourcesMutex);
+			mSources.push_back(_source);
+			return;
+		}
+
 		mSources.push_back(_source);
 	}
 
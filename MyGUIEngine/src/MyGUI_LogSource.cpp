@@ -75,4 +75,11 @@ namespace MyGUI
 			(*listener)->log(_section, _level, _time, _message, _file, _line);
 	}
 
+	bool LogSource::isLevelEnabled(LogLevel _level) const
+	{
+		if (mListeners.empty())
+			return false;
+		return mFilter == nullptr || mFilter->isLevelEnabled(_level);
+	}
+
 } // namespace MyGUI
@@ -28,17 +28,183 @@
 namespace MyGUI
 {
 
-	MaskPickInfo::MaskPickInfo() :
-		width(0),
-		height(0)
+	// packed mask file: magic, version, width, height, then rows of 32 bit words
+	const uint32 MaskFileMagic = 0x4B4D474D; // "MGMK"
+	const uint32 MaskFileVersion = 1;
+	const uint32 MaskFileHeaderSize = 16;
+	// bigger masks are treated as broken files, it is 32 Mb of bits
+	const uint32 MaskMaxSize = 16384;
+
+	enum MaskBlockState
+	{
+		MaskBlockEmpty,
+		MaskBlockFull,
+		MaskBlockMixed
+	};
+
+	// block levels from finest to coarsest, each level block side is 1 << shift pixels
+	const size_t MaskLevelCount = 2;
+	const int MaskLevelShift[MaskLevelCount] = { 3, 6 };
+
+	struct MaskPickData
 	{
+		MaskPickData() :
+			refCount(0),
+			width(0),
+			height(0),
+			stride(0)
+		{
+		}
+
+		bool getPixel(int _x, int _y) const
+		{
+			return 0 != (bits[(size_t)(_y * stride + (_x >> 5))] & (1u << (_x & 31)));
+		}
+
+		void setPixel(int _x, int _y)
+		{
+			bits[(size_t)(_y * stride + (_x >> 5))] |= (1u << (_x & 31));
+		}
+
+		void resize(int _width, int _height)
+		{
+			width = _width;
+			height = _height;
+			stride = (width + 31) >> 5;
+			bits.assign((size_t)(stride * height), 0);
+		}
+
+		void buildLevels()
+		{
+			for (size_t level = 0; level < MaskLevelCount; ++level)
+			{
+				int shift = MaskLevelShift[level];
+				int blockSize = 1 << shift;
+				levelWidth[level] = (width + blockSize - 1) >> shift;
+				int levelHeight = (height + blockSize - 1) >> shift;
+				levels[level].resize((size_t)(levelWidth[level] * levelHeight));
+
+				for (int blockY = 0; blockY < levelHeight; ++blockY)
+				{
+					for (int blockX = 0; blockX < levelWidth[level]; ++blockX)
+					{
+						int left = blockX << shift;
+						int top = blockY << shift;
+						int right = std::min(left + blockSize, width);
+						int bottom = std::min(top + blockSize, height);
+
+						bool empty = true;
+						bool full = true;
+						for (int y = top; y < bottom && (empty || full); ++y)
+						{
+							for (int x = left; x < right; ++x)
+							{
+								if (getPixel(x, y))
+									empty = false;
+								else
+									full = false;
+							}
+						}
+
+						levels[level][(size_t)(blockY * levelWidth[level] + blockX)] = (uint8)(empty ? MaskBlockEmpty : (full ? MaskBlockFull : MaskBlockMixed));
+					}
+				}
+			}
+		}
+
+		size_t getDataSize() const
+		{
+			size_t result = bits.size() * sizeof(uint32);
+			for (size_t level = 0; level < MaskLevelCount; ++level)
+				result += levels[level].size();
+			return result;
+		}
+
+		std::string name;
+		size_t refCount;
+
+		int width;
+		int height;
+		// count of 32 bit words in one row
+		int stride;
+		vector<uint32>::type bits;
+
+		int levelWidth[MaskLevelCount];
+		vector<uint8>::type levels[MaskLevelCount];
+	};
+
+	typedef map<std::string, MaskPickData*>::type MapMaskPickData;
+	static MapMaskPickData maskPickCache;
+
+	static bool readUInt32(IDataStream* _stream, uint32& _value)
+	{
+		uint8 bytes[4];
+		if (_stream->read(bytes, 4) != 4)
+			return false;
+		_value = (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+		return true;
 	}
 
-	bool MaskPickInfo::load(const std::string& _file)
+	static void writeUInt32(std::ofstream& _stream, uint32 _value)
 	{
-		if (!DataManager::getInstance().isDataExist(_file))
+		char bytes[4] = { (char)(_value & 0xFF), (char)((_value >> 8) & 0xFF), (char)((_value >> 16) & 0xFF), (char)((_value >> 24) & 0xFF) };
+		_stream.write(bytes, 4);
+	}
+
+	static bool isPackedMaskSizeValid(IDataStream* _stream, uint32 _width, uint32 _height)
+	{
+		if (_width == 0 || _height == 0 || _width > MaskMaxSize || _height > MaskMaxSize)
+			return false;
+
+		size_t stride = (size_t)((_width + 31) >> 5);
+		return _stream->size() == MaskFileHeaderSize + stride * _height * sizeof(uint32);
+	}
+
+	static bool loadPackedMask(const std::string& _file, MaskPickData* _data, bool& _packed)
+	{
+		_packed = false;
+
+		IDataStream* stream = DataManager::getInstance().getData(_file);
+		if (stream == nullptr)
 			return false;
 
+		bool result = false;
+		uint32 magic = 0;
+		if (readUInt32(stream, magic) && magic == MaskFileMagic)
+		{
+			_packed = true;
+
+			uint32 version = 0;
+			uint32 width = 0;
+			uint32 height = 0;
+			if (readUInt32(stream, version) && version == MaskFileVersion &&
+				readUInt32(stream, width) && readUInt32(stream, height) &&
+				isPackedMaskSizeValid(stream, width, height))
+			{
+				_data->resize((int)width, (int)height);
+
+				result = true;
+				for (size_t index = 0; index < _data->bits.size(); ++index)
+				{
+					if (!readUInt32(stream, _data->bits[index]))
+					{
+						result = false;
+						break;
+					}
+				}
+			}
+		}
+
+		DataManager::getInstance().freeData(stream);
+
+		if (_packed && !result)
+			MYGUI_LOG(Error, "Packed mask '" << _file << "' is broken");
+
+		return result;
+	}
+
+	static bool loadImageMask(const std::string& _file, MaskPickData* _data)
+	{
 		RenderManager& render = RenderManager::getInstance();
 		ITexture* texture = render.createTexture(_file);
 		texture->loadFromFile(_file);
@@ -52,25 +218,26 @@ namespace MyGUI
 
 		size_t pixel_size = texture->getNumElemBytes();
 
-		width = texture->getWidth();
-		height = texture->getHeight();
-		size_t size = width * height;
-		data.resize(size);
+		_data->resize(texture->getWidth(), texture->getHeight());
 
 		size_t pos = 0;
-		for (size_t pos_pix = 0; pos_pix < size; pos_pix++)
+		for (int y = 0; y < _data->height; ++y)
 		{
-			bool white = true;
-			for (size_t in_pix = 0; in_pix < pixel_size; in_pix++)
+			for (int x = 0; x < _data->width; ++x)
 			{
-				if (0xFF != buffer[pos])
+				bool white = true;
+				for (size_t in_pix = 0; in_pix < pixel_size; in_pix++)
 				{
-					white = false;
+					if (0xFF != buffer[pos])
+					{
+						white = false;
+					}
+					pos++;
 				}
-				pos++;
-			}
 
-			data[pos_pix] = white;
+				if (white)
+					_data->setPixel(x, y);
+			}
 		}
 
 		texture->unlock();
@@ -79,19 +246,133 @@ namespace MyGUI
 		return true;
 	}
 
+	MaskPickInfo::MaskPickInfo() :
+		mData(nullptr)
+	{
+	}
+
+	MaskPickInfo::MaskPickInfo(const MaskPickInfo& _other) :
+		mData(nullptr)
+	{
+		setData(_other.mData);
+	}
+
+	MaskPickInfo::~MaskPickInfo()
+	{
+		setData(nullptr);
+	}
+
+	MaskPickInfo& MaskPickInfo::operator = (const MaskPickInfo& _other)
+	{
+		setData(_other.mData);
+		return *this;
+	}
+
+	void MaskPickInfo::setData(MaskPickData* _data)
+	{
+		if (mData == _data)
+			return;
+
+		if (_data != nullptr)
+			_data->refCount ++;
+
+		if (mData != nullptr)
+		{
+			mData->refCount --;
+			if (mData->refCount == 0)
+			{
+				MapMaskPickData::iterator item = maskPickCache.find(mData->name);
+				if (item != maskPickCache.end() && item->second == mData)
+					maskPickCache.erase(item);
+				delete mData;
+			}
+		}
+
+		mData = _data;
+	}
+
+	bool MaskPickInfo::load(const std::string& _file)
+	{
+		MapMaskPickData::iterator item = maskPickCache.find(_file);
+		if (item != maskPickCache.end())
+		{
+			setData(item->second);
+			return true;
+		}
+
+		if (!DataManager::getInstance().isDataExist(_file))
+			return false;
+
+		MaskPickData* data = new MaskPickData();
+
+		bool packed = false;
+		bool result = loadPackedMask(_file, data, packed);
+		if (!packed)
+			result = loadImageMask(_file, data);
+
+		if (!result)
+		{
+			delete data;
+			return false;
+		}
+
+		data->name = _file;
+		data->buildLevels();
+		maskPickCache[_file] = data;
+
+		setData(data);
+		return true;
+	}
+
+	bool MaskPickInfo::save(const std::string& _file) const
+	{
+		if (mData == nullptr)
+			return false;
+
+		std::ofstream stream(_file.c_str(), std::ios_base::out | std::ios_base::binary);
+		if (!stream.is_open())
+			return false;
+
+		writeUInt32(stream, MaskFileMagic);
+		writeUInt32(stream, MaskFileVersion);
+		writeUInt32(stream, (uint32)mData->width);
+		writeUInt32(stream, (uint32)mData->height);
+		for (size_t index = 0; index < mData->bits.size(); ++index)
+			writeUInt32(stream, mData->bits[index]);
+
+		return stream.good();
+	}
+
 	bool MaskPickInfo::pick(const IntPoint& _point, const IntCoord& _coord) const
 	{
-		if ((0 == _coord.width) || (0 == _coord.height)) return false;
+		if ((nullptr == mData) || (0 == _coord.width) || (0 == _coord.height)) return false;
 
-		int x = ((_point.left * width) - 1) / _coord.width;
-		int y = ((_point.top * height) - 1) / _coord.height;
+		int x = ((_point.left * mData->width) - 1) / _coord.width;
+		int y = ((_point.top * mData->height) - 1) / _coord.height;
 
-		return 0 != data[(size_t)(y * width + x)];
+		if (x < 0 || y < 0 || x >= mData->width || y >= mData->height)
+			return false;
+
+		// coarse blocks first, most of points are in fully empty or fully filled blocks
+		for (size_t level = MaskLevelCount; level > 0; --level)
+		{
+			int shift = MaskLevelShift[level - 1];
+			uint8 state = mData->levels[level - 1][(size_t)((y >> shift) * mData->levelWidth[level - 1] + (x >> shift))];
+			if (state != MaskBlockMixed)
+				return state == MaskBlockFull;
+		}
+
+		return mData->getPixel(x, y);
 	}
 
 	bool MaskPickInfo::empty() const
 	{
-		return data.empty();
+		return mData == nullptr || mData->bits.empty();
+	}
+
+	size_t MaskPickInfo::getDataSize() const
+	{
+		return mData == nullptr ? 0 : mData->getDataSize();
 	}
 
 } // namespace MyGUI
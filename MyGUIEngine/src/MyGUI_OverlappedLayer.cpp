@@ -94,6 +94,8 @@ namespace MyGUI
 		{
 			if ((*iter) == _item)
 			{
+				mDirtyRect = DirtyRegion::combine(mDirtyRect, static_cast<LayerNode*>(_item)->getNodeRect());
+
 				delete _item;
 				mChildItems.erase(iter);
 
@@ -129,6 +131,8 @@ namespace MyGUI
 				mChildItems.erase(iter);
 				mChildItems.push_back(_item);
 
+				mDirtyRect = DirtyRegion::combine(mDirtyRect, static_cast<LayerNode*>(_item)->getNodeRect());
+
 				mOutOfDate = true;
 
 				return;
@@ -197,6 +201,15 @@ namespace MyGUI
 		return mViewSize;
 	}
 
+	void OverlappedLayer::addDirtyRegion(DirtyRegion& _region)
+	{
+		for (VectorILayerNode::iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
+			(*iter)->addDirtyRegion(_region);
+
+		_region.addRect(mDirtyRect);
+		mDirtyRect.clear();
+	}
+
 	bool OverlappedLayer::isOutOfDate() const
 	{
 		for (VectorILayerNode::const_iterator iter = mChildItems.begin(); iter != mChildItems.end(); ++iter)
@@ -57,7 +57,6 @@ namespace MyGUI
 		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
 		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
 
-		Gui::getInstance().eventFrameStart += newDelegate(this, &PointerManager::notifyFrameStart);
 		InputManager::getInstance().eventChangeMouseFocus += newDelegate(this, &PointerManager::notifyChangeMouseFocus);
 		WidgetManager::getInstance().registerUnlinker(this);
 
@@ -84,7 +83,6 @@ namespace MyGUI
 		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
 
 		InputManager::getInstance().eventChangeMouseFocus -= newDelegate(this, &PointerManager::notifyChangeMouseFocus);
-		Gui::getInstance().eventFrameStart -= newDelegate(this, &PointerManager::notifyFrameStart);
 
 		std::string resourceCategory = ResourceManager::getInstance().getCategoryName();
 		FactoryManager::getInstance().unregisterFactory<ResourceManualPointer>(resourceCategory);
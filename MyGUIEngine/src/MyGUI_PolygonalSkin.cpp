@@ -32,7 +32,6 @@ namespace MyGUI
 	PolygonalSkin::PolygonalSkin() :
 		mGeometryOutdated(false),
 		mLineWidth(1.0f),
-		mLineLength(0.0f),
 		mVertexCount(0),
 		mEmptyView(false),
 		mCurrentColour(0xFFFFFFFF),
@@ -53,49 +52,78 @@ namespace MyGUI
 
 	void PolygonalSkin::setPoints(const vector<FloatPoint>::type& _points)
 	{
-		if (_points.size() < 2)
+		setPoints(_points.empty() ? nullptr : &_points[0], _points.size());
+	}
+
+	void PolygonalSkin::setPoints(const FloatPoint* _points, size_t _count)
+	{
+		setLines(_points, &_count, 1);
+	}
+
+	void PolygonalSkin::setLines(const FloatPoint* _points, const size_t* _sizes, size_t _linesCount)
+	{
+		mLinePoints.clear();
+		mLineSizes.clear();
+		mLineLengths.clear();
+
+		for (size_t index = 0; index < _linesCount; ++index)
 		{
-			mVertexCount = 0;
-			mResultVerticiesPos.clear();
-			mResultVerticiesUV.clear();
-			mLinePoints = _points;
-			return;
+			_addLine(_points, _sizes[index]);
+			_points += _sizes[index];
 		}
 
-		VectorFloatPoint finalPoints;
-		finalPoints.reserve(_points.size());
+		_updateVertexCount();
+		_updateView();
+	}
 
-		mLineLength = 0.0f;
+	void PolygonalSkin::_addLine(const FloatPoint* _points, size_t _count)
+	{
+		if (_count < 2)
+			return;
+
+		size_t start = mLinePoints.size();
+		float length = 0.0f;
 		FloatPoint point = _points[0];
-		finalPoints.push_back(point);
+		mLinePoints.push_back(point);
 		// ignore repeating points
-		for (vector<FloatPoint>::type::const_iterator iter = _points.begin() + 1; iter != _points.end(); ++iter)
+		for (size_t index = 1; index < _count; ++index)
 		{
-			if (point != *iter)
+			if (point != _points[index])
 			{
-				finalPoints.push_back(*iter);
-				mLineLength += len(iter->left - point.left, iter->top - point.top);
-				point = *iter;
+				mLinePoints.push_back(_points[index]);
+				length += len(_points[index].left - point.left, _points[index].top - point.top);
+				point = _points[index];
 			}
 		}
 
-		mLinePoints = finalPoints;
+		size_t size = mLinePoints.size() - start;
+		if (size < 2)
+		{
+			mLinePoints.resize(start);
+			return;
+		}
+
+		mLineSizes.push_back(size);
+		mLineLengths.push_back(length);
+	}
+
+	void PolygonalSkin::_updateVertexCount()
+	{
+		size_t segments = mLinePoints.size() - mLineSizes.size();
 
 #ifdef MYGUI_NO_POLYGONAL_SKIN_CROPPING
-		size_t count = (mLinePoints.size() - 1) * VertexQuad::VertexCount * 2;
+		size_t count = segments * VertexQuad::VertexCount * 2;
 #else
 		// it's too hard to calculate maximum possible verticies count and worst
 		// approximation gives 7 times more verticies than in not cropped geometry
 		// so we multiply count by 2, because this looks enough
-		size_t count = (mLinePoints.size() - 1) * VertexQuad::VertexCount * 2 * 2;
+		size_t count = segments * VertexQuad::VertexCount * 2 * 2;
 #endif
 		if (count > mVertexCount)
 		{
 			mVertexCount = count;
 			if (nullptr != mRenderItem) mRenderItem->reallockDrawItem(this, mVertexCount);
 		}
-
-		_updateView();
 	}
 
 	void PolygonalSkin::setWidth(float _width)
@@ -305,13 +333,17 @@ namespace MyGUI
 
 	void PolygonalSkin::_rebuildGeometry()
 	{
-		if (mLinePoints.size() < 2)
-			return;
 		if (!mRenderItem || !mRenderItem->getRenderTarget())
 			return;
 
 		mGeometryOutdated = false;
 
+		mResultVerticiesPos.clear();
+		mResultVerticiesUV.clear();
+
+		if (mLineSizes.empty())
+			return;
+
 		// using mCurrentCoord as rectangle where we draw polygons
 
 		// base texture coordinates
@@ -323,76 +355,150 @@ namespace MyGUI
 			FloatPoint(mCurrentTexture.left, mCurrentTexture.bottom)
 		};
 
+		// all lines are built in one pass into same buffers
+		const FloatPoint* points = &mLinePoints[0];
+		for (size_t index = 0; index < mLineSizes.size(); ++index)
+		{
+			_buildLineGeometry(points, mLineSizes[index], mLineLengths[index], baseVerticiesUV);
+			points += mLineSizes[index];
+		}
+
+#ifndef MYGUI_NO_POLYGONAL_SKIN_CROPPING
+		// crop triangles
+		IntCoord cropRectangle(
+			mCurrentCoord.left,
+			mCurrentCoord.top,
+			mCurrentCoord.width,
+			mCurrentCoord.height
+			);
+
+		// nothing to crop if all verticies are inside
+		if (!geometry_utility::isPolygonInsideRect(&mResultVerticiesPos[0], mResultVerticiesPos.size(), cropRectangle))
+		{
+			const size_t triangleSize = 3;
+			FloatPoint croppedTriangle[triangleSize + 4];
+			FloatPoint tempVerticies[triangleSize + 4];
+
+			mCroppedVerticiesPos.clear();
+			mCroppedVerticiesUV.clear();
+			for (size_t i = 0; i < mResultVerticiesPos.size(); i += triangleSize)
+			{
+				// usually only few triangles cross the rectangle, others are copied as is
+				if (geometry_utility::isPolygonInsideRect(&mResultVerticiesPos[i], triangleSize, cropRectangle))
+				{
+					mCroppedVerticiesPos.insert(mCroppedVerticiesPos.end(), mResultVerticiesPos.begin() + i, mResultVerticiesPos.begin() + i + triangleSize);
+					mCroppedVerticiesUV.insert(mCroppedVerticiesUV.end(), mResultVerticiesUV.begin() + i, mResultVerticiesUV.begin() + i + triangleSize);
+					continue;
+				}
+
+				size_t size = geometry_utility::cropPolygon(&mResultVerticiesPos[i], triangleSize, cropRectangle, croppedTriangle, tempVerticies);
+				if (size < triangleSize)
+					continue;
+
+				FloatPoint v0 = mResultVerticiesUV[i + 2] - mResultVerticiesUV[i];
+				FloatPoint v1 = mResultVerticiesUV[i + 1] - mResultVerticiesUV[i];
+
+				for (size_t j = 1; j < size - 1; ++j)
+				{
+					mCroppedVerticiesPos.push_back(croppedTriangle[0]);
+					mCroppedVerticiesPos.push_back(croppedTriangle[j]);
+					mCroppedVerticiesPos.push_back(croppedTriangle[j + 1]);
+
+					// calculate UV
+					FloatPoint point;
+					point = geometry_utility::getPositionInsideRect(croppedTriangle[0], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
+					mCroppedVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
+					point = geometry_utility::getPositionInsideRect(croppedTriangle[j], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
+					mCroppedVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
+					point = geometry_utility::getPositionInsideRect(croppedTriangle[j + 1], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
+					mCroppedVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
+				}
+			}
+			std::swap(mResultVerticiesPos, mCroppedVerticiesPos);
+			std::swap(mResultVerticiesUV, mCroppedVerticiesUV);
+		}
+#endif
+
+		// now calculate widget base offset and then resulting position in screen coordinates
+		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
+		float vertex_left_base = ((info.pixScaleX * (float)(mCroppedParent->getAbsoluteLeft()) + info.hOffset) * 2) - 1;
+		float vertex_top_base = -(((info.pixScaleY * (float)(mCroppedParent->getAbsoluteTop()) + info.vOffset) * 2) - 1);
+
+		for (size_t i = 0; i < mResultVerticiesPos.size(); ++i)
+		{
+			mResultVerticiesPos[i].left = vertex_left_base + mResultVerticiesPos[i].left * info.pixScaleX * 2;
+			mResultVerticiesPos[i].top = vertex_top_base + mResultVerticiesPos[i].top * info.pixScaleY * -2;
+		}
+	}
+
+	void PolygonalSkin::_buildLineGeometry(const FloatPoint* _points, size_t _count, float _length, const FloatPoint* _baseVerticiesUV)
+	{
 		// UV vectors
-		FloatPoint vectorU = baseVerticiesUV[1] - baseVerticiesUV[0];
-		FloatPoint vectorV = baseVerticiesUV[3] - baseVerticiesUV[0];
+		FloatPoint vectorU = _baseVerticiesUV[1] - _baseVerticiesUV[0];
+		FloatPoint vectorV = _baseVerticiesUV[3] - _baseVerticiesUV[0];
 
-		FloatPoint vertex1;
-		FloatPoint vertex2;
-		mResultVerticiesPos.clear();
-		mResultVerticiesUV.clear();
 		// add first two verticies
-		FloatPoint normal = _getPerpendicular(mLinePoints[0], mLinePoints[1]);
+		FloatPoint normal = _getPerpendicular(_points[0], _points[1]);
 
-		FloatPoint points[2] = {mLinePoints[0] + normal, mLinePoints[0] - normal};
-		FloatPoint pointsUV[2] = {baseVerticiesUV[0], baseVerticiesUV[3]};
+		FloatPoint points[2] = {_points[0] + normal, _points[0] - normal};
+		FloatPoint pointsUV[2] = {_baseVerticiesUV[0], _baseVerticiesUV[3]};
 		// add other verticies
 		float currentLength = 0.0f;
-		for (size_t i = 1; i < mLinePoints.size(); ++i)
+		for (size_t i = 1; i < _count; ++i)
 		{
-			currentLength += len(mLinePoints[i - 1].left - mLinePoints[i].left,  mLinePoints[i - 1].top - mLinePoints[i].top);
+			currentLength += len(_points[i - 1].left - _points[i].left,  _points[i - 1].top - _points[i].top);
 
 			// getting normal between previous and next point
-			if (i != mLinePoints.size() - 1)
-				normal = _getMiddleLine(mLinePoints[i - 1], mLinePoints[i + 1], mLinePoints[i]);
+			if (i != _count - 1)
+				normal = _getMiddleLine(_points[i - 1], _points[i + 1], _points[i]);
 			else
-				normal = _getPerpendicular(mLinePoints[i - 1], mLinePoints[i]);
+				normal = _getPerpendicular(_points[i - 1], _points[i]);
 
 			bool edge = false;
 			bool sharp = false;
 			if (normal == FloatPoint() /*|| len(normal.left, normal.top) > mLineWidth * 2*/)
 			{
 				edge = true;
-				normal = _getPerpendicular(mLinePoints[i - 1], mLinePoints[i]);
+				normal = _getPerpendicular(_points[i - 1], _points[i]);
 			}
 			else if (len(normal.left, normal.top) > mLineWidth * 1.5)
 			{
 				sharp = true;
-				normal = _getPerpendicular(mLinePoints[i - 1], mLinePoints[i]);
+				normal = _getPerpendicular(_points[i - 1], _points[i]);
 			}
 
 			// check orientation
-			FloatPoint lineDir = mLinePoints[i] - mLinePoints[i - 1];
+			FloatPoint lineDir = _points[i] - _points[i - 1];
 			if (lineDir.left * normal.top - lineDir.top * normal.left < 0)
 			{
 				normal.left = -normal.left;
 				normal.top = -normal.top;
 			}
 
-			FloatPoint UVoffset(currentLength / mLineLength * vectorU.left, currentLength / mLineLength * vectorV.top);
+			FloatPoint UVoffset(currentLength / _length * vectorU.left, currentLength / _length * vectorV.top);
 
 			mResultVerticiesPos.push_back(points[0]);
 			mResultVerticiesPos.push_back(points[1]);
-			mResultVerticiesPos.push_back(mLinePoints[i] + normal);
+			mResultVerticiesPos.push_back(_points[i] + normal);
 			mResultVerticiesUV.push_back(pointsUV[0]);
 			mResultVerticiesUV.push_back(pointsUV[1]);
-			mResultVerticiesUV.push_back(baseVerticiesUV[0] + UVoffset);
+			mResultVerticiesUV.push_back(_baseVerticiesUV[0] + UVoffset);
 
 			mResultVerticiesPos.push_back(points[1]);
-			mResultVerticiesPos.push_back(mLinePoints[i] - normal);
-			mResultVerticiesPos.push_back(mLinePoints[i] + normal);
+			mResultVerticiesPos.push_back(_points[i] - normal);
+			mResultVerticiesPos.push_back(_points[i] + normal);
 			mResultVerticiesUV.push_back(pointsUV[1]);
-			mResultVerticiesUV.push_back(baseVerticiesUV[3] + UVoffset);
-			mResultVerticiesUV.push_back(baseVerticiesUV[0] + UVoffset);
+			mResultVerticiesUV.push_back(_baseVerticiesUV[3] + UVoffset);
+			mResultVerticiesUV.push_back(_baseVerticiesUV[0] + UVoffset);
 
-			points[edge ? 1 : 0] = mLinePoints[i] + normal;
-			points[edge ? 0 : 1] = mLinePoints[i] - normal;
-			pointsUV[0] = baseVerticiesUV[0] + UVoffset;
-			pointsUV[1] = baseVerticiesUV[3] + UVoffset;
+			points[edge ? 1 : 0] = _points[i] + normal;
+			points[edge ? 0 : 1] = _points[i] - normal;
+			pointsUV[0] = _baseVerticiesUV[0] + UVoffset;
+			pointsUV[1] = _baseVerticiesUV[3] + UVoffset;
 
 			if (sharp)
 			{
-				normal =  _getMiddleLine(mLinePoints[i - 1], mLinePoints[i + 1], mLinePoints[i]);
+				normal =  _getMiddleLine(_points[i - 1], _points[i + 1], _points[i]);
 
 				float sharpness = len(normal.left, normal.top) / mLineWidth;
 
@@ -401,14 +507,14 @@ namespace MyGUI
 				normal.top *= 2 * mLineWidth / length / (sharpness - 0.5f);
 
 				// check orientation
-				lineDir = mLinePoints[i] - mLinePoints[i - 1];
+				lineDir = _points[i] - _points[i - 1];
 				if (lineDir.left * normal.top - lineDir.top * normal.left < 0)
 				{
 					normal.left = -normal.left;
 					normal.top = -normal.top;
 				}
-				FloatPoint lineDir1 = mLinePoints[i] - mLinePoints[i - 1];
-				FloatPoint lineDir2 = mLinePoints[i + 1] - mLinePoints[i];
+				FloatPoint lineDir1 = _points[i] - _points[i - 1];
+				FloatPoint lineDir2 = _points[i + 1] - _points[i];
 				if (lineDir1.left * lineDir2.top - lineDir1.top * lineDir2.left > 0)
 				{
 					normal.left = -normal.left;
@@ -416,91 +522,35 @@ namespace MyGUI
 				}
 
 				// check orientation
-				FloatPoint normal2 = _getPerpendicular(mLinePoints[i], mLinePoints[i + 1]);
-				lineDir = mLinePoints[i - 1] - mLinePoints[i];
+				FloatPoint normal2 = _getPerpendicular(_points[i], _points[i + 1]);
+				lineDir = _points[i - 1] - _points[i];
 				if ((lineDir.left * normal2.top - lineDir.top * normal2.left < 0))
 				{
 					normal2.left = -normal2.left;
 					normal2.top = -normal2.top;
 				}
 
-				FloatPoint UVcenter((baseVerticiesUV[0].left + baseVerticiesUV[3].left) / 2, (baseVerticiesUV[0].top + baseVerticiesUV[3].top) / 2);
+				FloatPoint UVcenter((_baseVerticiesUV[0].left + _baseVerticiesUV[3].left) / 2, (_baseVerticiesUV[0].top + _baseVerticiesUV[3].top) / 2);
 				mResultVerticiesPos.push_back(points[0]);
-				mResultVerticiesPos.push_back(mLinePoints[i] + normal);
-				mResultVerticiesPos.push_back(mLinePoints[i]);
+				mResultVerticiesPos.push_back(_points[i] + normal);
+				mResultVerticiesPos.push_back(_points[i]);
 				mResultVerticiesUV.push_back(pointsUV[0]);
-				mResultVerticiesUV.push_back(baseVerticiesUV[0] + UVoffset);
+				mResultVerticiesUV.push_back(_baseVerticiesUV[0] + UVoffset);
 				mResultVerticiesUV.push_back(UVcenter + UVoffset);
 
-				mResultVerticiesPos.push_back(mLinePoints[i] + normal);
-				mResultVerticiesPos.push_back(mLinePoints[i] + normal2);
-				mResultVerticiesPos.push_back(mLinePoints[i]);
-				mResultVerticiesUV.push_back(baseVerticiesUV[0] + UVoffset);
-				mResultVerticiesUV.push_back(baseVerticiesUV[0] + UVoffset);
+				mResultVerticiesPos.push_back(_points[i] + normal);
+				mResultVerticiesPos.push_back(_points[i] + normal2);
+				mResultVerticiesPos.push_back(_points[i]);
+				mResultVerticiesUV.push_back(_baseVerticiesUV[0] + UVoffset);
+				mResultVerticiesUV.push_back(_baseVerticiesUV[0] + UVoffset);
 				mResultVerticiesUV.push_back(UVcenter + UVoffset);
 
-				points[0] = mLinePoints[i] + normal2;
-				points[1] = mLinePoints[i] - normal2;
-				pointsUV[0] = baseVerticiesUV[0] + UVoffset;
-				pointsUV[1] = baseVerticiesUV[3] + UVoffset;
-			}
-		}
-
-
-#ifndef MYGUI_NO_POLYGONAL_SKIN_CROPPING
-		// crop triangles
-		IntCoord cropRectangle(
-			mCurrentCoord.left,
-			mCurrentCoord.top,
-			mCurrentCoord.width,
-			mCurrentCoord.height
-			);
-
-		VectorFloatPoint newResultVerticiesPos;
-		VectorFloatPoint newResultVerticiesUV;
-		newResultVerticiesPos.reserve(mResultVerticiesPos.size());
-		newResultVerticiesUV.reserve(mResultVerticiesPos.size());
-		for (size_t i = 0; i < mResultVerticiesPos.size(); i += 3)
-		{
-			VectorFloatPoint croppedTriangle =
-				geometry_utility::cropPolygon(&mResultVerticiesPos[i], 3, cropRectangle);
-			if (!croppedTriangle.empty())
-			{
-				FloatPoint v0 = mResultVerticiesUV[i + 2] - mResultVerticiesUV[i];
-				FloatPoint v1 = mResultVerticiesUV[i + 1] - mResultVerticiesUV[i];
-
-				for (size_t j = 1; j < croppedTriangle.size() - 1; ++j)
-				{
-					newResultVerticiesPos.push_back(croppedTriangle[0]);
-					newResultVerticiesPos.push_back(croppedTriangle[j]);
-					newResultVerticiesPos.push_back(croppedTriangle[j + 1]);
-
-					// calculate UV
-					FloatPoint point;
-					point = geometry_utility::getPositionInsideRect(croppedTriangle[0], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
-					newResultVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
-					point = geometry_utility::getPositionInsideRect(croppedTriangle[j], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
-					newResultVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
-					point = geometry_utility::getPositionInsideRect(croppedTriangle[j + 1], mResultVerticiesPos[i], mResultVerticiesPos[i + 1], mResultVerticiesPos[i + 2]);
-					newResultVerticiesUV.push_back(geometry_utility::getUVFromPositionInsideRect(point, v0, v1, mResultVerticiesUV[i]));
-				}
+				points[0] = _points[i] + normal2;
+				points[1] = _points[i] - normal2;
+				pointsUV[0] = _baseVerticiesUV[0] + UVoffset;
+				pointsUV[1] = _baseVerticiesUV[3] + UVoffset;
 			}
 		}
-		std::swap(mResultVerticiesPos, newResultVerticiesPos);
-		std::swap(mResultVerticiesUV, newResultVerticiesUV);
-#endif
-
-
-		// now calculate widget base offset and then resulting position in screen coordinates
-		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
-		float vertex_left_base = ((info.pixScaleX * (float)(mCroppedParent->getAbsoluteLeft()) + info.hOffset) * 2) - 1;
-		float vertex_top_base = -(((info.pixScaleY * (float)(mCroppedParent->getAbsoluteTop()) + info.vOffset) * 2) - 1);
-
-		for (size_t i = 0; i < mResultVerticiesPos.size(); ++i)
-		{
-			mResultVerticiesPos[i].left = vertex_left_base + mResultVerticiesPos[i].left * info.pixScaleX * 2;
-			mResultVerticiesPos[i].top = vertex_top_base + mResultVerticiesPos[i].top * info.pixScaleY * -2;
-		}
 	}
 
 	FloatPoint PolygonalSkin::_getPerpendicular(const FloatPoint& _point1, const FloatPoint& _point2)
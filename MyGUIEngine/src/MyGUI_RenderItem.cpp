@@ -28,6 +28,7 @@
 #include "MyGUI_DataManager.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_RotatingSkin.h"
+#include "MyGUI_DirtyRegion.h"
 
 namespace MyGUI
 {
@@ -67,6 +68,7 @@ namespace MyGUI
 		if (mOutOfDate || _update)
 		{
 			mCountVertex = 0;
+			mRenderRect.clear();
 			Vertex* buffer = mVertexBuffer->lock();
 			if (buffer != nullptr)
 			{
@@ -82,6 +84,9 @@ namespace MyGUI
 					MYGUI_DEBUG_ASSERT(mLastVertexCount <= (*iter).second, "It is too much vertexes");
 					buffer += mLastVertexCount;
 					mCountVertex += mLastVertexCount;
+
+					if (mLastVertexCount != 0)
+						mRenderRect = DirtyRegion::combine(mRenderRect, getDrawItemRect((*iter).first));
 				}
 
 				mVertexBuffer->unlock();
@@ -90,6 +95,11 @@ namespace MyGUI
 			mOutOfDate = false;
 		}
 
+		// in partial redraw unchanged part of the screen is kept from previous frame
+		const DirtyRegion* region = _target->getInfo().dirtyRegion;
+		if (region != nullptr && mRotatingSkin == nullptr && !region->intersect(mRenderRect))
+			return;
+
 		// хоть с 0 не выводиться батч, но все равно не будем дергать стейт и операцию
 		if (0 != mCountVertex)
 		{
@@ -268,4 +278,34 @@ namespace MyGUI
 		return mRenderTarget;
 	}
 
+	const IntRect& RenderItem::getRenderRect() const
+	{
+		return mRenderRect;
+	}
+
+	void RenderItem::addDirtyRegion(DirtyRegion& _region) const
+	{
+		if (!mOutOfDate)
+			return;
+
+		// rotated vertices can leave rectangle of widget
+		if (mRotatingSkin != nullptr)
+		{
+			_region.setFull();
+			return;
+		}
+
+		// what was drawn and what will be drawn
+		_region.addRect(mRenderRect);
+		for (VectorDrawItem::const_iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
+			_region.addRect(getDrawItemRect((*iter).first));
+	}
+
+	IntRect RenderItem::getDrawItemRect(ISubWidget* _item)
+	{
+		// sub widgets are cropped by their widget
+		ICroppedRectangle* parent = _item->getCroppedParent();
+		return parent != nullptr ? parent->getAbsoluteRect() : _item->getAbsoluteRect();
+	}
+
 } // namespace MyGUI
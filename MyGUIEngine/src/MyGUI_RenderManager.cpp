@@ -36,6 +36,11 @@ namespace MyGUI
 		return true;
 	}
 
+	bool RenderManager::isPartialRedrawSupported() const
+	{
+		return false;
+	}
+
 #if MYGUI_DEBUG_MODE == 1
 	bool RenderManager::checkTexture(ITexture* _texture)
 	{
@@ -66,4 +71,16 @@ namespace MyGUI
 			gui->frameEvent(_time);
 	}
 
+	bool RenderManager::onPrepareFrame(bool _update)
+	{
+		// glyphs ready after background rendering change text before layers are checked
+		FontManager::getInstance().prepareFont();
+
+		LayerManager* layers = LayerManager::getInstancePtr();
+		if (layers == nullptr)
+			return true;
+
+		return !layers->updateDirtyRegion(_update).empty();
+	}
+
 } // namespace MyGUI
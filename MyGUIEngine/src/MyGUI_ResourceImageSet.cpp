@@ -234,4 +234,20 @@ namespace MyGUI
 		mGroups.push_back(_group);
 	}
 
+	void ResourceImageSet::replaceTexture(const std::string& _oldTexture, const std::string& _texture, const IntPoint& _point)
+	{
+		for (VectorGroupImage::iterator group = mGroups.begin(); group != mGroups.end(); ++group)
+		{
+			if (group->texture != _oldTexture)
+				continue;
+
+			group->texture = _texture;
+			for (VectorIndexImage::iterator index = group->indexes.begin(); index != group->indexes.end(); ++index)
+			{
+				for (vector<IntPoint>::type::iterator frame = index->frames.begin(); frame != index->frames.end(); ++frame)
+					(*frame) += _point;
+			}
+		}
+	}
+
 } // namespace MyGUI
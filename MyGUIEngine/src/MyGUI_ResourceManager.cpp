@@ -26,17 +26,167 @@
 #include "MyGUI_DataManager.h"
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_DataStreamHolder.h"
+#include "MyGUI_DataMemoryStream.h"
+#include "MyGUI_Thread.h"
+#include "MyGUI_Timer.h"
 #include "MyGUI_ResourceImageSet.h"
 #include "MyGUI_Gui.h"
 
 namespace MyGUI
 {
 
+	namespace
+	{
+
+		// разбирает файлы списка на рабочих потоках, вызывающий поток забирает документы строго по порядку
+		class ParallelDocumentParser
+		{
+		public:
+			struct Task
+			{
+				Task() :
+					data(nullptr),
+					found(false),
+					result(false),
+					done(0)
+				{
+				}
+
+				std::string file;
+				IDataStream* data;
+				std::vector<unsigned char> buffer;
+				DataMemoryStream stream;
+				xml::Document document;
+				bool found;
+				bool result;
+				volatile long done;
+			};
+
+			ParallelDocumentParser() :
+				mNext(0)
+			{
+			}
+
+			~ParallelDocumentParser()
+			{
+				for (std::vector<Thread*>::iterator item = mThreads.begin(); item != mThreads.end(); ++item)
+					delete *item;
+				for (std::vector<Task*>::iterator item = mTasks.begin(); item != mTasks.end(); ++item)
+				{
+					if ((*item)->data != nullptr)
+						DataManager::getInstance().freeData((*item)->data);
+					delete *item;
+				}
+			}
+
+			// данные читаются только из вызывающего потока, потоки данных пользователя могут быть не потокобезопасными
+			void addTask(const std::string& _file)
+			{
+				Task* task = new Task();
+				task->file = _file;
+
+				mTasks.push_back(task);
+
+				IDataStream* data = DataManager::getInstance().getData(_file);
+				if (data == nullptr)
+					return;
+
+				task->found = true;
+
+				// поток уже в памяти, держим его открытым до конца загрузки и разбираем без копирования
+				const unsigned char* memory = data->data();
+				if (memory != nullptr)
+				{
+					task->data = data;
+					task->stream = DataMemoryStream(const_cast<unsigned char*>(memory), data->size());
+					return;
+				}
+
+				task->buffer.resize(data->size());
+				if (!task->buffer.empty())
+					task->buffer.resize(data->read(&task->buffer[0], task->buffer.size()));
+				if (!task->buffer.empty())
+					task->stream = DataMemoryStream(&task->buffer[0], task->buffer.size());
+
+				DataManager::getInstance().freeData(data);
+			}
+
+			size_t start(size_t _threads)
+			{
+				for (size_t index = 0; index < _threads; ++index)
+				{
+					Thread* thread = new Thread();
+					if (!thread->start(newDelegate(this, &ParallelDocumentParser::threadFunction)))
+					{
+						delete thread;
+						break;
+					}
+					mThreads.push_back(thread);
+				}
+				return mThreads.size();
+			}
+
+			size_t getCount() const
+			{
+				return mTasks.size();
+			}
+
+			// ждет разбора документа, пока ждем помогаем рабочим потокам
+			Task& getTask(size_t _index)
+			{
+				Task& task = *mTasks[_index];
+				while (atomic::load(task.done) == 0)
+				{
+					if (!parseNext())
+						mTaskDone.wait();
+				}
+				return task;
+			}
+
+			void join()
+			{
+				for (std::vector<Thread*>::iterator item = mThreads.begin(); item != mThreads.end(); ++item)
+					(*item)->join();
+			}
+
+		private:
+			void threadFunction()
+			{
+				while (parseNext())
+				{
+				}
+			}
+
+			bool parseNext()
+			{
+				long index = atomic::increment(mNext) - 1;
+				if (index >= (long)mTasks.size())
+					return false;
+
+				Task& task = *mTasks[index];
+				if (task.found)
+					task.result = task.document.open(&task.stream);
+
+				atomic::store(task.done, 1);
+				mTaskDone.set();
+				return true;
+			}
+
+		private:
+			std::vector<Task*> mTasks;
+			std::vector<Thread*> mThreads;
+			volatile long mNext;
+			ThreadEvent mTaskDone;
+		};
+
+	}
+
 	template <> ResourceManager* Singleton<ResourceManager>::msInstance = nullptr;
 	template <> const char* Singleton<ResourceManager>::mClassTypeName = "ResourceManager";
 
 	ResourceManager::ResourceManager() :
 		mIsInitialise(false),
+		mParallelLoading(true),
 		mCategoryName("Resource"),
 		mXmlListTagName("List")
 	{
@@ -128,6 +278,8 @@ namespace MyGUI
 		fTargetZoomScale = fTargetZoomScale > 2.0f ? 2.0f : fTargetZoomScale;
 		fTargetZoomScale = ceil(fTargetZoomScale);
 
+		VectorString files;
+
 		// берем детей и крутимся, основной цикл
 		xml::ElementEnumerator node = _node->getElementEnumerator();
 		while (node.next(mXmlListTagName))
@@ -142,9 +294,58 @@ namespace MyGUI
 					continue;
 			}
 
-			MYGUI_LOG(Info, "Load ini file '" << source << "'");
-			_loadImplement(source, false, "", getClassTypeName());
+			files.push_back(source);
 		}
+
+		if (files.empty())
+			return;
+
+		Timer timer;
+		size_t threads = 1;
+
+		if (mParallelLoading && files.size() > 1 && Thread::isSupported() && Thread::getHardwareConcurrency() > 1)
+		{
+			threads = _loadListParallel(files);
+		}
+		else
+		{
+			for (VectorString::const_iterator file = files.begin(); file != files.end(); ++file)
+			{
+				MYGUI_LOG(Info, "Load ini file '" << *file << "'");
+				_loadImplement(*file, false, "", getClassTypeName());
+			}
+		}
+
+		MYGUI_LOG(Info, "List '" << _file << "' loaded in " << timer.getMilliseconds() << " ms, files " << files.size() << ", threads " << threads);
+	}
+
+	size_t ResourceManager::_loadListParallel(const VectorString& _files)
+	{
+		ParallelDocumentParser parser;
+		for (VectorString::const_iterator file = _files.begin(); file != _files.end(); ++file)
+			parser.addTask(*file);
+
+		// вызывающий поток тоже разбирает файлы, поэтому дополнительных потоков на один меньше
+		size_t threads = (std::min)(Thread::getHardwareConcurrency(), _files.size()) - 1;
+		threads = parser.start(threads);
+
+		// менеджеры не потокобезопасны, поэтому ресурсы создаются здесь и в порядке списка
+		for (size_t index = 0; index < parser.getCount(); ++index)
+		{
+			ParallelDocumentParser::Task& task = parser.getTask(index);
+
+			MYGUI_LOG(Info, "Load ini file '" << task.file << "'");
+			if (!task.found)
+				MYGUI_LOG(Error, getClassTypeName() << " : '" << task.file << "', not found");
+			else if (!task.result)
+				MYGUI_LOG(Error, getClassTypeName() << " : '" << task.file << "', " << task.document.getLastError());
+			else
+				_loadDocument(task.document, task.file, false, "", getClassTypeName());
+		}
+
+		parser.join();
+
+		return threads + 1;
 	}
 
 	ResourceManager::LoadXmlDelegate& ResourceManager::registerLoadXmlDelegate(const std::string& _key)
@@ -176,7 +377,12 @@ namespace MyGUI
 			return false;
 		}
 
-		xml::ElementPtr root = doc.getRoot();
+		return _loadDocument(doc, _file, _match, _type, _instance);
+	}
+
+	bool ResourceManager::_loadDocument(xml::Document& _doc, const std::string& _file, bool _match, const std::string& _type, const std::string& _instance)
+	{
+		xml::ElementPtr root = _doc.getRoot();
 		if ( (nullptr == root) || (root->getName() != "MyGUI") )
 		{
 			MYGUI_LOG(Error, _instance << " : '" << _file << "', tag 'MyGUI' not found");
@@ -308,4 +514,14 @@ namespace MyGUI
 		return mCategoryName;
 	}
 
+	void ResourceManager::setParallelLoading(bool _value)
+	{
+		mParallelLoading = _value;
+	}
+
+	bool ResourceManager::getParallelLoading() const
+	{
+		return mParallelLoading;
+	}
+
 } // namespace MyGUI
@@ -24,11 +24,13 @@
 #include "MyGUI_SkinManager.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_FontManager.h"
 
 namespace MyGUI
 {
 
 	ResourceManualFont::ResourceManualFont() :
+		mSharedAtlas(false),
 		mDefaultHeight(0),
 		mSubstituteGlyphInfo(nullptr),
 		mTexture(nullptr)
@@ -37,6 +39,8 @@ namespace MyGUI
 
 	ResourceManualFont::~ResourceManualFont()
 	{
+		if (mSharedAtlas && FontManager::getInstancePtr() != nullptr)
+			FontManager::getInstance().getGlyphAtlas().release(this);
 	}
 
 	GlyphInfo* ResourceManualFont::getGlyphInfo(Char _id)
@@ -77,9 +81,11 @@ namespace MyGUI
 				const std::string& value = node->findAttribute("value");
 				if (key == "Source") mSource = value;
 				else if (key == "DefaultHeight") mDefaultHeight = utility::parseInt(value);
+				else if (key == "SharedAtlas") mSharedAtlas = utility::parseBool(value);
 			}
 		}
 
+		bool ownTexture = RenderManager::getInstance().getTexture(mSource) == nullptr;
 		loadTexture();
 
 		if (mTexture != nullptr)
@@ -139,7 +145,119 @@ namespace MyGUI
 					}
 				}
 			}
+
+			if (mSharedAtlas)
+				copyToGlyphAtlas(ownTexture);
+		}
+	}
+
+	void ResourceManualFont::copyToGlyphAtlas(bool _ownTexture)
+	{
+		RenderManager& render = RenderManager::getInstance();
+		GlyphAtlas& atlas = FontManager::getInstance().getGlyphAtlas();
+
+		// same format as generated fonts use, so glyphs of both kinds share pages
+		PixelFormat format = render.isFormatSupported(PixelFormat::L8A8, TextureUsage::Static | TextureUsage::Write) ? PixelFormat::L8A8 : PixelFormat::R8G8B8A8;
+		size_t destBytes = GlyphAtlas::getNumElemBytes(format);
+
+		int textureWidth = mTexture->getWidth();
+		int textureHeight = mTexture->getHeight();
+		size_t sourceBytes = GlyphAtlas::getNumElemBytes(mTexture->getFormat());
+		if (sourceBytes == 0)
+		{
+			MYGUI_LOG(Warning, "ResourceManualFont: Texture '" << mSource << "' of font '" << getResourceName() << "' has unsupported format, font doesn't use shared glyph atlas.");
+			mSharedAtlas = false;
+			return;
+		}
+
+		const uint8* source = static_cast<const uint8*>(mTexture->lock(TextureUsage::Read));
+		if (source == nullptr)
+		{
+			MYGUI_LOG(Warning, "ResourceManualFont: Texture '" << mSource << "' of font '" << getResourceName() << "' can't be read, font doesn't use shared glyph atlas.");
+			mSharedAtlas = false;
+			return;
 		}
+
+		ITexture* firstTexture = nullptr;
+		bool complete = true;
+		for (CharMap::iterator item = mCharMap.begin(); item != mCharMap.end(); ++item)
+		{
+			GlyphInfo& info = item->second;
+
+			// whole pixels around the glyph, uv keep fractional part of the coordinates
+			int left = std::max((int)floor(info.uvRect.left * textureWidth), 0);
+			int top = std::max((int)floor(info.uvRect.top * textureHeight), 0);
+			int right = std::min((int)ceil(info.uvRect.right * textureWidth), textureWidth);
+			int bottom = std::min((int)ceil(info.uvRect.bottom * textureHeight), textureHeight);
+			int width = std::max(right - left, 0);
+			int height = std::max(bottom - top, 0);
+
+			// one pixel of spacing so neighbours don't bleed into the glyph when filtered
+			GlyphAtlas::Region region;
+			if (!atlas.allocate(this, width + 1, height + 1, format, TextureUsage::Static | TextureUsage::Write, region))
+			{
+				MYGUI_LOG(Error, "ResourceManualFont: Glyph for character " << info.codePoint << " in font '" << getResourceName() << "' doesn't fit into the glyph atlas page.");
+				complete = false;
+				continue;
+			}
+
+			for (int y = 0; y < height; ++y)
+			{
+				const uint8* src = source + ((top + y) * textureWidth + left) * sourceBytes;
+				uint8* dest = region.memory + y * region.pitch;
+				for (int x = 0; x < width; ++x, src += sourceBytes, dest += destBytes)
+				{
+					uint8 luminance = src[0];
+					uint8 alpha = 0xFF;
+					if (sourceBytes == 2)
+						alpha = src[1];
+					else if (sourceBytes >= 3)
+						luminance = (uint8)((src[0] + src[1] * 2 + src[2]) >> 2);
+					if (sourceBytes == 4)
+						alpha = src[3];
+
+					if (destBytes == 2)
+					{
+						dest[0] = luminance;
+						dest[1] = alpha;
+					}
+					else if (sourceBytes >= 3)
+					{
+						dest[0] = src[0];
+						dest[1] = src[1];
+						dest[2] = src[2];
+						dest[3] = alpha;
+					}
+					else
+					{
+						dest[0] = dest[1] = dest[2] = luminance;
+						dest[3] = alpha;
+					}
+				}
+			}
+
+			float offsetX = (float)(region.coord.left - left);
+			float offsetY = (float)(region.coord.top - top);
+			info.uvRect.set(
+				(info.uvRect.left * textureWidth + offsetX) / region.textureSize.width,
+				(info.uvRect.top * textureHeight + offsetY) / region.textureSize.height,
+				(info.uvRect.right * textureWidth + offsetX) / region.textureSize.width,
+				(info.uvRect.bottom * textureHeight + offsetY) / region.textureSize.height);
+			info.texture = region.texture;
+
+			if (firstTexture == nullptr)
+				firstTexture = region.texture;
+		}
+
+		mTexture->unlock();
+
+		// glyphs that didn't fit still use the source texture
+		if (!complete || firstTexture == nullptr)
+			return;
+
+		if (_ownTexture)
+			render.destroyTexture(mTexture);
+		mTexture = firstTexture;
 	}
 
 	ITexture* ResourceManualFont::getTextureFont()
@@ -24,6 +24,8 @@
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_LanguageManager.h"
 #include "MyGUI_SubWidgetManager.h"
+#include "MyGUI_CommonStateInfo.h"
+#include "MyGUI_TextureUtility.h"
 
 namespace MyGUI
 {
@@ -217,6 +219,7 @@ namespace MyGUI
 	{
 		checkState(_bind.mStates);
 		mBasis.push_back(SubWidgetInfo(_bind.mType, _bind.mOffset, _bind.mAlign));
+		mBasis.back().factory = FactoryManager::getInstance().getFactoryHandle(SubWidgetManager::getInstance().getCategoryName(), _bind.mType);
 		checkBasis();
 		fillState(_bind.mStates, mBasis.size() - 1);
 	}
@@ -313,4 +316,58 @@ namespace MyGUI
 		return mSkinName;
 	}
 
+	namespace
+	{
+
+		FloatRect replaceTextureRect(const FloatRect& _rect, const IntCoord& _coord, const IntSize& _size)
+		{
+			return FloatRect(
+				(_rect.left * _coord.width + _coord.left) / _size.width,
+				(_rect.top * _coord.height + _coord.top) / _size.height,
+				(_rect.right * _coord.width + _coord.left) / _size.width,
+				(_rect.bottom * _coord.height + _coord.top) / _size.height);
+		}
+
+	} // namespace
+
+	bool ResourceSkin::replaceTexture(const std::string& _texture, const IntCoord& _coord)
+	{
+		const IntSize& size = texture_utility::getTextureSize(_texture, false);
+		if (size.width == 0 || size.height == 0)
+			return false;
+
+		// state types from plugins may keep texture coordinates in their own way
+		for (MapWidgetStateInfo::const_iterator state = mStates.begin(); state != mStates.end(); ++state)
+		{
+			for (VectorStateInfo::const_iterator info = state->second.begin(); info != state->second.end(); ++info)
+			{
+				if ((*info) != nullptr &&
+					!(*info)->isType<SubSkinStateInfo>() &&
+					!(*info)->isType<TileRectStateInfo>() &&
+					!(*info)->isType<EditTextStateInfo>())
+					return false;
+			}
+		}
+
+		for (MapWidgetStateInfo::iterator state = mStates.begin(); state != mStates.end(); ++state)
+		{
+			for (VectorStateInfo::iterator info = state->second.begin(); info != state->second.end(); ++info)
+			{
+				if ((*info) == nullptr)
+					continue;
+
+				SubSkinStateInfo* subSkin = (*info)->castType<SubSkinStateInfo>(false);
+				if (subSkin != nullptr)
+					subSkin->setRect(replaceTextureRect(subSkin->getRect(), _coord, size));
+
+				TileRectStateInfo* tileRect = (*info)->castType<TileRectStateInfo>(false);
+				if (tileRect != nullptr)
+					tileRect->setRect(replaceTextureRect(tileRect->getRect(), _coord, size));
+			}
+		}
+
+		mTexture = _texture;
+		return true;
+	}
+
 } // namespace MyGUI
@@ -28,6 +28,9 @@
 #include "MyGUI_FontManager.h"
 #include "MyGUI_FontDataStream.h"
 #include "MyGUI_Gui.h"
+#include "MyGUI_Thread.h"
+#include "MyGUI_Timer.h"
+#include "MyGUI_TextureUtility.h"
 
 #ifdef MYGUI_USE_FREETYPE
 
@@ -148,6 +151,43 @@ namespace MyGUI
 	{
 	}
 
+	void ResourceTrueTypeFont::setAsynchronous(bool _value)
+	{
+	}
+
+	bool ResourceTrueTypeFont::getAsynchronous() const
+	{
+		return false;
+	}
+
+	void ResourceTrueTypeFont::setDistanceField(bool _value)
+	{
+	}
+
+	bool ResourceTrueTypeFont::getDistanceField() const
+	{
+		return false;
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldSpread(int _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldBase(const std::string& _value)
+	{
+	}
+
+	bool ResourceTrueTypeFont::hasPendingGlyphs() const
+	{
+		return false;
+	}
+
+	const ResourceTrueTypeFont::AsyncStatistics& ResourceTrueTypeFont::getAsyncStatistics() const
+	{
+		static AsyncStatistics statistics;
+		return statistics;
+	}
+
 #else // MYGUI_USE_FREETYPE
 	namespace
 	{
@@ -172,6 +212,37 @@ namespace MyGUI
 		const uint8 charMaskBlack = (const uint8)'\x00';
 		const uint8 charMaskWhite = (const uint8)'\xFF';
 
+		// Render systems draw distance field textures with alpha = 4 * field - 1.5, flat glyphs are stored so that they keep
+		// their alpha after that.
+		uint8 toDistanceFieldAlpha(uint8 _alpha)
+		{
+			return (_alpha == charMaskBlack || _alpha == charMaskWhite) ? _alpha : (uint8)((_alpha + 384) / 4);
+		}
+
+		// Grows the glyph by the distance field spread at every side, the pen position after the glyph stays the same.
+		void padDistanceFieldGlyph(GlyphInfo& _info, int _spread)
+		{
+			float spread = (float)_spread;
+			_info.width += spread * 2;
+			_info.height += spread * 2;
+			_info.bearingX -= spread;
+			_info.bearingY -= spread;
+			_info.advance += spread;
+		}
+
+		GlyphInfo scaleGlyphInfo(const GlyphInfo& _info, float _scale)
+		{
+			return GlyphInfo(
+				_info.codePoint,
+				_info.texture,
+				_info.width * _scale,
+				_info.height * _scale,
+				_info.advance * _scale,
+				_info.bearingX * _scale,
+				_info.bearingY * _scale,
+				_info.uvRect);
+		}
+
 		template<bool LAMode>
 		struct PixelBase
 		{
@@ -275,6 +346,223 @@ namespace MyGUI
 
 	}
 
+	// Renders glyphs for prepareString on a background thread. The thread has its own FreeType library and face, so it never
+	// touches FreeType objects used by the main thread. Rendered bitmaps wait in mResults until prepareTexture commits them.
+	struct GlyphRenderQueue
+	{
+		struct Request
+		{
+			Char codePoint;
+			unsigned long time;
+		};
+
+		struct Result
+		{
+			GlyphInfo info;
+			vector<uint8>::type bitmap;
+			unsigned long time;
+			bool valid;
+		};
+
+		typedef deque<Request>::type DequeRequest;
+		typedef vector<Result>::type VectorResult;
+
+		GlyphRenderQueue() :
+			mLibrary(nullptr),
+			mFace(nullptr),
+			mLoadFlags(FT_LOAD_DEFAULT),
+			mFontAscent(0),
+			mOffsetHeight(0),
+			mDistanceFieldSpread(0),
+			mQuit(false)
+		{
+		}
+
+		~GlyphRenderQueue()
+		{
+			if (mThread.isRunning())
+			{
+				{
+					MutexLock lock(mMutex);
+					mQuit = true;
+				}
+				mWakeEvent.set();
+				mThread.join();
+			}
+
+			if (mFace != nullptr)
+				FT_Done_Face(mFace);
+			if (mLibrary != nullptr)
+				FT_Done_FreeType(mLibrary);
+		}
+
+		bool start(const uint8* _data, size_t _size, float _size_pt, uint _resolution)
+		{
+			if (!Thread::isSupported())
+				return false;
+
+			if (FT_Init_FreeType(&mLibrary) != 0)
+			{
+				mLibrary = nullptr;
+				return false;
+			}
+
+			if (FT_New_Memory_Face(mLibrary, _data, (FT_Long)_size, 0, &mFace) != 0)
+			{
+				mFace = nullptr;
+				return false;
+			}
+
+			if (mFace->face_flags & FT_FACE_FLAG_SCALABLE)
+			{
+				FT_F26Dot6 ftSize = (FT_F26Dot6)(_size_pt * (1 << 6));
+				if (FT_Set_Char_Size(mFace, ftSize, 0, _resolution, _resolution) != 0)
+					return false;
+			}
+
+			return mThread.start(newDelegate(this, &GlyphRenderQueue::threadFunction));
+		}
+
+		void push(Char _codePoint)
+		{
+			Request request;
+			request.codePoint = _codePoint;
+			request.time = mTimer.getMilliseconds();
+
+			MutexLock lock(mMutex);
+			mRequests.push_back(request);
+		}
+
+		void wake()
+		{
+			mWakeEvent.set();
+		}
+
+		void popResults(VectorResult& _results)
+		{
+			MutexLock lock(mMutex);
+			_results.swap(mResults);
+		}
+
+		unsigned long getTime()
+		{
+			return mTimer.getMilliseconds();
+		}
+
+		void threadFunction()
+		{
+			while (true)
+			{
+				mWakeEvent.wait();
+
+				while (true)
+				{
+					Request request;
+					{
+						MutexLock lock(mMutex);
+						if (mQuit)
+							return;
+						if (mRequests.empty())
+							break;
+						request = mRequests.front();
+						mRequests.pop_front();
+					}
+
+					Result result;
+					result.time = request.time;
+					render(request.codePoint, result);
+
+					MutexLock lock(mMutex);
+					mResults.push_back(result);
+				}
+			}
+		}
+
+		// Same metrics and pixels as createFaceGlyphInfo and renderGlyphs, the bitmap is padded to the glyph size.
+		void render(Char _codePoint, Result& _result)
+		{
+			_result.valid = FT_Load_Char(mFace, _codePoint, mLoadFlags | FT_LOAD_RENDER) == 0;
+			if (!_result.valid)
+				return;
+
+			FT_GlyphSlot glyph = mFace->glyph;
+			float bearingX = glyph->metrics.horiBearingX / 64.0f;
+
+			_result.info = GlyphInfo(
+				_codePoint,
+				nullptr,
+				std::max((float)glyph->bitmap.width, glyph->metrics.width / 64.0f),
+				std::max((float)glyph->bitmap.rows, glyph->metrics.height / 64.0f),
+				(glyph->advance.x / 64.0f) - bearingX,
+				bearingX,
+				floor(mFontAscent - (glyph->metrics.horiBearingY / 64.0f) - mOffsetHeight));
+
+			if (mDistanceFieldSpread != 0)
+				padDistanceFieldGlyph(_result.info, mDistanceFieldSpread);
+
+			if (glyph->bitmap.buffer == nullptr)
+				return;
+
+			FT_Bitmap ftBitmap;
+			FT_Bitmap_New(&ftBitmap);
+
+			const FT_Bitmap* source = nullptr;
+			switch (glyph->bitmap.pixel_mode)
+			{
+			case FT_PIXEL_MODE_GRAY:
+				source = &glyph->bitmap;
+				break;
+
+			case FT_PIXEL_MODE_MONO:
+				if (FT_Bitmap_Convert(mLibrary, &glyph->bitmap, &ftBitmap, 1) == 0)
+				{
+					for (uint8* p = ftBitmap.buffer, * endP = p + ftBitmap.width * ftBitmap.rows; p != endP; ++p)
+						*p ^= -*p ^ *p;
+					source = &ftBitmap;
+				}
+				break;
+			}
+
+			if (source != nullptr)
+			{
+				size_t width = (size_t)ceil(_result.info.width);
+				size_t height = (size_t)ceil(_result.info.height);
+				_result.bitmap.assign(width * height, 0);
+
+				if (mDistanceFieldSpread != 0)
+				{
+					texture_utility::generateDistanceField(source->buffer, (int)source->width, (int)source->rows, source->pitch,
+						&_result.bitmap[0], (int)width, (int)height, mDistanceFieldSpread);
+				}
+				else
+				{
+					size_t rows = std::min(height, (size_t)source->rows);
+					size_t columns = std::min(width, (size_t)source->width);
+					for (size_t row = 0; row < rows; ++row)
+						memcpy(&_result.bitmap[row * width], source->buffer + row * source->pitch, columns);
+				}
+			}
+
+			FT_Bitmap_Done(mLibrary, &ftBitmap);
+		}
+
+		FT_Library mLibrary;
+		FT_Face mFace;
+		FT_Int32 mLoadFlags;
+		int mFontAscent;
+		int mOffsetHeight;
+		int mDistanceFieldSpread;
+		vector<uint8>::type mFontData;
+
+		Thread mThread;
+		ThreadEvent mWakeEvent;
+		Mutex mMutex;
+		bool mQuit;
+		DequeRequest mRequests;
+		VectorResult mResults;
+		Timer mTimer;
+	};
+
 	const int ResourceTrueTypeFont::mDefaultGlyphSpacing = 1;
 	const float ResourceTrueTypeFont::mDefaultTabWidth = 8.0f;
 	const float ResourceTrueTypeFont::mSelectedWidth = 1.0f;
@@ -282,10 +570,8 @@ namespace MyGUI
 
 	ResourceTrueTypeFont::ResourceTrueTypeFont() :
         mFontDataImpl(nullptr),
-        mCurGlyphTexture(nullptr),
-        mPtNextX(0),
-        mPtNextY(0),
-        mTextureSize(256),
+        mFontFace(nullptr),
+        mTexture(nullptr),
         mFontAscent(0),
         mFontDescent(0),
         mFtLoadFlags(FT_LOAD_DEFAULT),
@@ -299,17 +585,26 @@ namespace MyGUI
 		mTabWidth(0.0f),
 		mOffsetHeight(0),
 		mSubstituteCodePoint(static_cast<Char>(FontCodeType::NotDefined)),
+		mAsynchronous(false),
+		mDistanceField(false),
+		mDistanceFieldSpread(4),
 		mDefaultHeight(0),
-		mSubstituteGlyphInfo(nullptr)
+		mSubstituteGlyphInfo(nullptr),
+		mRenderQueue(nullptr),
+		mBaseFont(nullptr),
+		mBaseScale(1.0f)
 	{
         mFontDataImpl = FontManager::getInstance().getFontImpl();
 	}
 
 	ResourceTrueTypeFont::~ResourceTrueTypeFont()
 	{
+		stopRenderQueue();
+
 		cleanupGlyphTextureAtlas();
 
-        FT_Done_Face(mFontFace);
+        if (mFontFace != nullptr)
+            FT_Done_Face(mFontFace);
 	}
 
 	void ResourceTrueTypeFont::deserialization(xml::ElementPtr _node, Version _version)
@@ -341,6 +636,14 @@ namespace MyGUI
 					setDistance(utility::parseInt(value) * Gui::getInstance().getZoomScale());
 				else if (key == "Hinting")
 					setHinting(value);
+				else if (key == "Asynchronous")
+					setAsynchronous(utility::parseBool(value));
+				else if (key == "DistanceField")
+					setDistanceField(utility::parseBool(value));
+				else if (key == "DistanceFieldSpread")
+					setDistanceFieldSpread(utility::parseInt(value) * Gui::getInstance().getZoomScale());
+				else if (key == "DistanceFieldBase")
+					setDistanceFieldBase(value);
 				else if (key == "SpaceWidth")
 				{
 					mSpaceWidth = utility::parseFloat(value) * Gui::getInstance().getZoomScale();
@@ -358,6 +661,9 @@ namespace MyGUI
 
 	GlyphInfo* ResourceTrueTypeFont::getGlyphInfo(Char _id)
 	{
+		if (mBaseFont != nullptr)
+			return getBaseGlyphInfo(_id);
+
         GlyphMap::iterator glyphIter = mGlyphMap.find(_id);
 
         if (glyphIter != mGlyphMap.end())
@@ -368,7 +674,10 @@ namespace MyGUI
 
 	ITexture* ResourceTrueTypeFont::getTextureFont()
 	{
-		return mGlyphTextureAtlas.front()->mTexture;
+		if (mBaseFont != nullptr)
+			return mBaseFont->getTextureFont();
+
+		return mTexture;
 	}
 
 	int ResourceTrueTypeFont::getDefaultHeight()
@@ -390,6 +699,13 @@ namespace MyGUI
 
 	void ResourceTrueTypeFont::initialise()
 	{
+		if (!mDistanceFieldBase.empty())
+		{
+			if (!initialiseBase())
+				MYGUI_LOG(Error, "ResourceTrueTypeFont: Distance field font '" << mDistanceFieldBase << "' for the font '" << getResourceName() << "' not found!");
+			return;
+		}
+
 		if (mGlyphSpacing == -1)
 			mGlyphSpacing = mDefaultGlyphSpacing;
 
@@ -429,6 +745,9 @@ namespace MyGUI
 
 		uint8* fontBuffer = nullptr;
 
+		// glyphs in flight were rendered with old face parameters
+		stopRenderQueue();
+
 		loadFace();
 
 		if (mFontFace == nullptr)
@@ -569,6 +888,42 @@ namespace MyGUI
         renderGlyphs<LAMode, Antialias>(mGlyphMap[FontCodeType::NotDefined], mFontDataImpl->mFTLib, mFontFace, mFtLoadFlags);
 	}
 
+	bool ResourceTrueTypeFont::initialiseBase()
+	{
+		IResource* resource = ResourceManager::getInstance().getByName(mDistanceFieldBase, false);
+		ResourceTrueTypeFont* base = resource != nullptr ? resource->castType<ResourceTrueTypeFont>(false) : nullptr;
+		if (base == nullptr || !base->mDistanceField || base->mBaseFont != nullptr || base->mSubstituteGlyphInfo == nullptr)
+			return false;
+
+		mBaseFont = base;
+		mBaseScale = (mSize > 0.0f && base->mSize > 0.0f) ? mSize / base->mSize : 1.0f;
+
+		mLAMode = base->mLAMode;
+		mFontAscent = (int)floor(base->mFontAscent * mBaseScale + 0.5f);
+		mFontDescent = (int)floor(base->mFontDescent * mBaseScale + 0.5f);
+		mDefaultHeight = mFontAscent + mFontDescent;
+
+		mGlyphMap.clear();
+		mSubstituteCodePoint = base->mSubstituteCodePoint;
+		mSubstituteGlyphInfo = &createGlyph(scaleGlyphInfo(*base->mSubstituteGlyphInfo, mBaseScale));
+
+		return true;
+	}
+
+	GlyphInfo* ResourceTrueTypeFont::getBaseGlyphInfo(Char _id)
+	{
+		GlyphMap::iterator glyphIter = mGlyphMap.find(_id);
+		if (glyphIter != mGlyphMap.end())
+			return &glyphIter->second;
+
+		// Glyphs that are missing in the base font can be rendered later, so the substitute is not remembered for them.
+		GlyphInfo* info = mBaseFont->getGlyphInfo(_id);
+		if (info == nullptr || info == mBaseFont->mSubstituteGlyphInfo)
+			return mSubstituteGlyphInfo;
+
+		return &createGlyph(scaleGlyphInfo(*info, mBaseScale));
+	}
+
 	void ResourceTrueTypeFont::loadFace()
 	{
         FontDataStream* pStream = FontManager::getInstance().getFontDataStream(mSource);
@@ -595,23 +950,11 @@ namespace MyGUI
 
     void ResourceTrueTypeFont::cleanupGlyphTextureAtlas()
     {
-        GlyphTexture* texture = nullptr;
-        for (GlyphTextureAltas::iterator itr = mGlyphTextureAtlas.begin(); itr != mGlyphTextureAtlas.end(); ++itr)
-        {
-            texture = *itr;
-
-            delete[] texture->mMemory;
-            texture->mMemory = nullptr;
-
-            RenderManager::getInstance().destroyTexture(texture->mTexture);
+        // pages shared with other fonts stay alive until their last font releases them
+        if (FontManager::getInstancePtr() != nullptr)
+            FontManager::getInstance().getGlyphAtlas().release(this);
 
-            delete texture;
-        }
-
-        mPtNextX = mPtNextY = 0;
-        mCurGlyphTexture = nullptr;
-
-        mGlyphTextureAtlas.clear();
+        mTexture = nullptr;
     }
 
     void ResourceTrueTypeFont::prepareString(const UString& text)
@@ -619,8 +962,17 @@ namespace MyGUI
         if (text.empty())
             return;
 
+        if (mBaseFont != nullptr)
+        {
+            mBaseFont->prepareString(text);
+            return;
+        }
+
         int init = (mLAMode ? 2 : 0) | (mAntialias ? 1 : 0);
 
+        bool asynchronous = mAsynchronous && (mRenderQueue != nullptr || startRenderQueue());
+        bool requested = false;
+
         size_t count = text.length();
         for (size_t i = 0; i < count; ++i)
         {
@@ -631,6 +983,18 @@ namespace MyGUI
 
             if (getGlyphInfo(codePoint) == mSubstituteGlyphInfo)
             {
+                if (asynchronous)
+                {
+                    // substitute glyph is shown until the glyph is committed in prepareTexture
+                    if (codePoint != mSubstituteCodePoint && mRequestedGlyphs.insert(codePoint).second)
+                    {
+                        mRenderQueue->push(codePoint);
+                        ++mAsyncStatistics.requested;
+                        requested = true;
+                    }
+                    continue;
+                }
+
                 GlyphInfo& glyphInfo = createFaceGlyph(codePoint, mFontAscent, mFontFace, mFtLoadFlags);
 
                 switch (init)
@@ -650,43 +1014,152 @@ namespace MyGUI
                 }
             }
         }
+
+        if (requested)
+        {
+            mRenderQueue->wake();
+            FontManager::getInstance().registerForPrepare(this);
+        }
     }
 
     void ResourceTrueTypeFont::prepareTexture()
     {
-        GlyphTexture* texture = nullptr;
-        for (GlyphTextureAltas::iterator itr = mGlyphTextureAtlas.begin(); itr != mGlyphTextureAtlas.end(); ++itr)
+        bool committed = false;
+        if (mRenderQueue != nullptr)
         {
-            texture = *itr;
+            int init = (mLAMode ? 2 : 0) | (mAntialias ? 1 : 0);
 
-            if (texture->mDirty)
+            switch (init)
             {
-                texture->mTexture->loadFromMemory(texture->mMemory);
-                texture->mDirty = false;
+            case 0:
+                committed = commitGlyphs<false, false>();
+                break;
+            case 1:
+                committed = commitGlyphs<false, true>();
+                break;
+            case 2:
+                committed = commitGlyphs<true, false>();
+                break;
+            case 3:
+                committed = commitGlyphs<true, true>();
+                break;
             }
+
+            // keep polling until all requested glyphs arrive
+            if (hasPendingGlyphs())
+                FontManager::getInstance().registerForPrepare(this);
+        }
+
+        // changed pages of the glyph atlas are uploaded by FontManager::prepareFont after all fonts
+
+        if (committed)
+            FontManager::getInstance().eventGlyphsReady(this);
+    }
+
+    bool ResourceTrueTypeFont::hasPendingGlyphs() const
+    {
+        if (mBaseFont != nullptr)
+            return mBaseFont->hasPendingGlyphs();
+
+        return mAsyncStatistics.requested != mAsyncStatistics.committed + mAsyncStatistics.failed;
+    }
+
+    const ResourceTrueTypeFont::AsyncStatistics& ResourceTrueTypeFont::getAsyncStatistics() const
+    {
+        return mAsyncStatistics;
+    }
+
+    bool ResourceTrueTypeFont::startRenderQueue()
+    {
+        if (mFontFace == nullptr || !Thread::isSupported())
+        {
+            mAsynchronous = false;
+            return false;
+        }
+
+        FontDataStream* stream = FontManager::getInstance().getFontDataStream(mSource);
+        IDataStream* data = stream != nullptr ? stream->mDataStream : nullptr;
+
+        GlyphRenderQueue* queue = new GlyphRenderQueue();
+        queue->mLoadFlags = mFtLoadFlags;
+        queue->mFontAscent = mFontAscent;
+        queue->mOffsetHeight = mOffsetHeight;
+        queue->mDistanceFieldSpread = mDistanceField ? mDistanceFieldSpread : 0;
+
+        // memory of mapped stream stays valid while mFontFace is open, other streams are copied for the thread
+        const uint8* memory = data != nullptr ? data->data() : nullptr;
+        size_t size = data != nullptr ? data->size() : 0;
+        if (memory == nullptr && size != 0)
+        {
+            queue->mFontData.resize(size);
+            data->seek(0);
+            size = data->read(&queue->mFontData[0], size);
+            memory = &queue->mFontData[0];
         }
+
+        if (memory == nullptr || !queue->start(memory, size, mSize, mResolution))
+        {
+            delete queue;
+            MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot start asynchronous rendering for font '" << getResourceName() << "', glyphs will be rendered synchronously.");
+            mAsynchronous = false;
+            return false;
+        }
+
+        mRenderQueue = queue;
+        return true;
     }
 
-    template<bool LAMode>
-    GlyphTexture* ResourceTrueTypeFont::createFontTexture()
+    void ResourceTrueTypeFont::stopRenderQueue()
     {
-        static int textureGUID = 0;
+        if (mRenderQueue == nullptr)
+            return;
 
-        GlyphTexture* glyphtexture = new GlyphTexture;
+        delete mRenderQueue;
+        mRenderQueue = nullptr;
 
-        glyphtexture->mDirty = true;
-        glyphtexture->mMemory = new uint8[mTextureSize * mTextureSize * Pixel<LAMode>::getNumBytes()];
-        memset(glyphtexture->mMemory, 0, mTextureSize * mTextureSize * Pixel<LAMode>::getNumBytes());
+        // glyphs in flight are lost, they will be requested again by next prepareString
+        mRequestedGlyphs.clear();
+        mAsyncStatistics.requested = mAsyncStatistics.committed + mAsyncStatistics.failed;
+    }
 
-        glyphtexture->mTexture = RenderManager::getInstance().createTexture(MyGUI::utility::toString(++textureGUID, "_TrueTypeFont"));
+    template<bool LAMode, bool Antialias>
+    bool ResourceTrueTypeFont::commitGlyphs()
+    {
+        GlyphRenderQueue::VectorResult results;
+        mRenderQueue->popResults(results);
+        if (results.empty())
+            return false;
 
-        glyphtexture->mTexture->createManual(mTextureSize, mTextureSize, TextureUsage::Static | TextureUsage::Write, Pixel<LAMode>::getFormat());
+        unsigned long time = mRenderQueue->getTime();
 
-        mGlyphTextureAtlas.push_back(glyphtexture);
+        for (GlyphRenderQueue::VectorResult::iterator result = results.begin(); result != results.end(); ++result)
+        {
+            unsigned long latency = time - result->time;
+            mAsyncStatistics.latencyTotal += latency;
+            mAsyncStatistics.latencyMax = std::max(mAsyncStatistics.latencyMax, latency);
 
-        mPtNextX = mPtNextY = 0;
+            if (!result->valid)
+            {
+                ++mAsyncStatistics.failed;
+                MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot load glyph for character " << result->info.codePoint << " in font '" << getResourceName() << "'.");
+                continue;
+            }
+
+            ++mAsyncStatistics.committed;
 
-        return glyphtexture;
+            if (mGlyphMap.find(result->info.codePoint) != mGlyphMap.end())
+                continue;
+
+            GlyphInfo& info = createGlyph(result->info);
+            if (result->bitmap.empty())
+                info.texture = mTexture;
+            else if (mDistanceField)
+                renderGlyph<LAMode, true, false>(info, charMaskWhite, charMaskWhite, charMaskWhite, &result->bitmap[0]);
+            else
+                renderGlyph<LAMode, true, Antialias>(info, charMaskWhite, charMaskWhite, charMaskWhite, &result->bitmap[0]);
+        }
+
+        return true;
     }
 
 	GlyphInfo ResourceTrueTypeFont::createFaceGlyphInfo(Char _codePoint, int _fontAscent, FT_GlyphSlot _glyph)
@@ -697,20 +1170,19 @@ namespace MyGUI
 		// float ascent = _glyph->metrics.horiBearingY / 64.0f;
 		// float descent = (_glyph->metrics.height / 64.0f) - ascent;
 
-        ITexture* texture = nullptr;
-        if (mCurGlyphTexture)
-        {
-            texture = mCurGlyphTexture->mTexture;
-        }
-
-		return GlyphInfo(
+		GlyphInfo info(
 			_codePoint,
-            texture,
+			mTexture,
 			std::max((float)_glyph->bitmap.width, _glyph->metrics.width / 64.0f),
 			std::max((float)_glyph->bitmap.rows, _glyph->metrics.height / 64.0f),
 			(_glyph->advance.x / 64.0f) - bearingX,
 			bearingX,
 			floor(_fontAscent - (_glyph->metrics.horiBearingY / 64.0f) - mOffsetHeight));
+
+		if (mDistanceField)
+			padDistanceFieldGlyph(info, mDistanceFieldSpread);
+
+		return info;
 	}
 
 	GlyphInfo& ResourceTrueTypeFont::createGlyph(const GlyphInfo& _glyphInfo)
@@ -742,12 +1214,17 @@ namespace MyGUI
 		FT_Bitmap ftBitmap;
 		FT_Bitmap_New(&ftBitmap);
 
+        map<const Char, const uint8>::type::const_iterator mask = charMask.find(_glyphInfo.codePoint);
+        uint8 alpha = mask != charMask.end() ? mask->second : charMaskWhite;
+        if (mDistanceField)
+            alpha = toDistanceFieldAlpha(alpha);
+
         switch (_glyphInfo.codePoint)
         {
         case FontCodeType::Selected:
         case FontCodeType::SelectedBack:
             {
-                renderGlyph<LAMode, false, false>(_glyphInfo, charMaskWhite, charMaskBlack, charMask.find(_glyphInfo.codePoint)->second);
+                renderGlyph<LAMode, false, false>(_glyphInfo, charMaskWhite, charMaskBlack, alpha);
 
                 // Manually adjust the glyph's width to zero. This prevents artifacts from appearing at the seams when
                 // rendering multi-character selections.
@@ -759,7 +1236,7 @@ namespace MyGUI
 
         case FontCodeType::Cursor:
         case FontCodeType::Tab:
-            renderGlyph<LAMode, false, false>(_glyphInfo, charMaskWhite, charMaskBlack, charMask.find(_glyphInfo.codePoint)->second);
+            renderGlyph<LAMode, false, false>(_glyphInfo, charMaskWhite, charMaskBlack, alpha);
             break;
 
         default:
@@ -768,11 +1245,13 @@ namespace MyGUI
                 if (_ftFace->glyph->bitmap.buffer != nullptr)
                 {
                     uint8* glyphBuffer = nullptr;
+                    const FT_Bitmap* glyphBitmap = nullptr;
 
                     switch (_ftFace->glyph->bitmap.pixel_mode)
                     {
                     case FT_PIXEL_MODE_GRAY:
-                        glyphBuffer = _ftFace->glyph->bitmap.buffer;
+                        glyphBitmap = &_ftFace->glyph->bitmap;
+                        glyphBuffer = glyphBitmap->buffer;
                         break;
 
                     case FT_PIXEL_MODE_MONO:
@@ -783,13 +1262,27 @@ namespace MyGUI
                             for (uint8* p = ftBitmap.buffer, * endP = p + ftBitmap.width * ftBitmap.rows; p != endP; ++p)
                                 *p ^= -*p ^ *p;
 
+                            glyphBitmap = &ftBitmap;
                             glyphBuffer = ftBitmap.buffer;
                         }
                         break;
                     }
 
-                    if (glyphBuffer != nullptr)
+                    if (glyphBuffer != nullptr && mDistanceField)
+                    {
+                        // The field covers the bitmap and the spread around it, as padded in createFaceGlyphInfo.
+                        int width = (int)ceil(_glyphInfo.width);
+                        int height = (int)ceil(_glyphInfo.height);
+                        vector<uint8>::type field(width * height);
+                        texture_utility::generateDistanceField(glyphBuffer, (int)glyphBitmap->width, (int)glyphBitmap->rows, glyphBitmap->pitch,
+                            &field[0], width, height, mDistanceFieldSpread);
+
+                        renderGlyph<LAMode, true, false>(_glyphInfo, charMaskWhite, charMaskWhite, charMaskWhite, &field[0]);
+                    }
+                    else if (glyphBuffer != nullptr)
+                    {
                         renderGlyph<LAMode, true, Antialias>(_glyphInfo, charMaskWhite, charMaskWhite, charMaskWhite, glyphBuffer);
+                    }
                 }
             }
             else
@@ -808,31 +1301,28 @@ namespace MyGUI
 		int width = (int)ceil(_info.width);
 		int height = (int)ceil(_info.height);
 
+		// Distance field pages are drawn differently, so they are never shared with coverage glyphs.
+		TextureUsage usage = TextureUsage::Static | TextureUsage::Write;
+		if (mDistanceField)
+			usage |= TextureUsage::DistanceField;
 
-        if (mCurGlyphTexture == nullptr || mPtNextY + (mDefaultHeight + mGlyphSpacing) > mTextureSize)
-        {
-            mCurGlyphTexture = createFontTexture<LAMode>();
-        }
-        else
-        {
-            if (mPtNextX + width > mTextureSize)
-            {
-                mPtNextY += (mDefaultHeight + mGlyphSpacing);
-                mPtNextX = 0;
+		// The spacing is allocated together with the glyph, so neighbours don't bleed into it when filtered.
+		GlyphAtlas::Region region;
+		if (!FontManager::getInstance().getGlyphAtlas().allocate(this, width + mGlyphSpacing, height + mGlyphSpacing, Pixel<LAMode>::getFormat(), usage, region))
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Glyph for character " << _info.codePoint << " in font '" << getResourceName() << "' doesn't fit into the glyph atlas page.");
+			return;
+		}
 
-                if (mPtNextY + (mDefaultHeight + mGlyphSpacing) > mTextureSize)
-                {
-                    mCurGlyphTexture = createFontTexture<LAMode>();
-                }
-            }
-        }
+		if (mTexture == nullptr)
+			mTexture = region.texture;
 
-        _info.texture = mCurGlyphTexture->mTexture;
+        _info.texture = region.texture;
 
-		uint8* dest = mCurGlyphTexture->mMemory + (mPtNextY * mTextureSize + mPtNextX) * Pixel<LAMode>::getNumBytes();
+		uint8* dest = region.memory;
 
 		// Calculate how much to advance the destination pointer after each row to get to the start of the next row.
-		ptrdiff_t destNextRow = (mTextureSize - width) * Pixel<LAMode>::getNumBytes();
+		ptrdiff_t destNextRow = region.pitch - width * Pixel<LAMode>::getNumBytes();
 
 		for (int j = height; j > 0; --j)
 		{
@@ -850,14 +1340,10 @@ namespace MyGUI
 		}
 
 		// Calculate and store the glyph's UV coordinates within the texture.
-		_info.uvRect.left = (float)mPtNextX / mTextureSize; // u1
-		_info.uvRect.top = (float)mPtNextY / mTextureSize; // v1
-		_info.uvRect.right = (float)(mPtNextX + _info.width) / mTextureSize; // u2
-		_info.uvRect.bottom = (float)(mPtNextY + _info.height) / mTextureSize; // v2
-
-        mPtNextX += (width + mGlyphSpacing);
-
-        mCurGlyphTexture->mDirty = true;
+		_info.uvRect.left = (float)region.coord.left / region.textureSize.width; // u1
+		_info.uvRect.top = (float)region.coord.top / region.textureSize.height; // v1
+		_info.uvRect.right = (float)(region.coord.left + _info.width) / region.textureSize.width; // u2
+		_info.uvRect.bottom = (float)(region.coord.top + _info.height) / region.textureSize.height; // v2
 
         FontManager::getInstance().registerForPrepare(this);
 	}
@@ -916,6 +1402,38 @@ namespace MyGUI
 		mGlyphSpacing = _value;
 	}
 
+	void ResourceTrueTypeFont::setAsynchronous(bool _value)
+	{
+		mAsynchronous = _value;
+		if (!mAsynchronous)
+			stopRenderQueue();
+	}
+
+	bool ResourceTrueTypeFont::getAsynchronous() const
+	{
+		return mAsynchronous;
+	}
+
+	void ResourceTrueTypeFont::setDistanceField(bool _value)
+	{
+		mDistanceField = _value;
+	}
+
+	bool ResourceTrueTypeFont::getDistanceField() const
+	{
+		return mDistanceField;
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldSpread(int _value)
+	{
+		mDistanceFieldSpread = std::max(_value, 1);
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldBase(const std::string& _value)
+	{
+		mDistanceFieldBase = _value;
+	}
+
 #endif // MYGUI_USE_FREETYPE
 
 } // namespace MyGUI
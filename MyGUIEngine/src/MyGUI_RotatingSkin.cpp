@@ -32,6 +32,8 @@ namespace MyGUI
 	RotatingSkin::RotatingSkin() :
 		mGeometryOutdated(false),
 		mAngle(0.0f),
+		mAngleSin(0.0f),
+		mAngleCos(1.0f),
 		mEmptyView(false),
 		mCurrentColour(0xFFFFFFFF),
 		mNode(nullptr),
@@ -46,7 +48,12 @@ namespace MyGUI
 
 	void RotatingSkin::setAngle(float _angle)
 	{
+		if (mAngle == _angle)
+			return;
+
 		mAngle = _angle;
+		mAngleSin = sin(_angle);
+		mAngleCos = cos(_angle);
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
@@ -270,11 +277,6 @@ namespace MyGUI
 			mNode->outOfDate(mRenderItem);
 	}
 
-	inline float len(float x, float y)
-	{
-		return sqrt(x * x + y * y);
-	}
-
 #ifndef MYGUI_RENDER_UE
 	void RotatingSkin::_rebuildGeometry()
 	{
@@ -282,29 +284,19 @@ namespace MyGUI
 			0 1
 			3 2
 		*/
-#ifndef M_PI
-		const float M_PI = 3.141593f;
-#endif
-
 		float width_base = (float)mCurrentCoord.width;
 		float height_base = (float)mCurrentCoord.height;
 		float center_left = width_base * mCenterPos.left;
 		float center_top = height_base * mCenterPos.top;
 
-		// calculate original unrotated angles of uncropped rectangle verticies: between axis and line from center of rotation to vertex)
-		float baseAngles[RECT_VERTICIES_COUNT];
-		baseAngles[0] = atan2(center_left, center_top) + M_PI / 2;
-		baseAngles[1] = atan2(- width_base + center_left, center_top) + M_PI / 2;
-		baseAngles[2] = atan2(- width_base + center_left, - height_base + center_top) + M_PI / 2;
-		baseAngles[3] = atan2(center_left, - height_base + center_top) + M_PI / 2;
-
-		// calculate original unrotated distances of uncropped rectangle verticies: between center of rotation and vertex)
-		float baseDistances[RECT_VERTICIES_COUNT];
-		baseDistances[0] = len(center_left, center_top);
-		baseDistances[1] = len(- width_base + center_left, center_top);
-		baseDistances[2] = len(- width_base + center_left, - height_base + center_top);
-		baseDistances[3] = len(center_left, - height_base + center_top);
-
+		// unrotated positions of uncropped rectangle verticies relative to center of rotation
+		FloatPoint baseOffsets[RECT_VERTICIES_COUNT] =
+		{
+			FloatPoint(- center_left, - center_top),
+			FloatPoint(width_base - center_left, - center_top),
+			FloatPoint(width_base - center_left, height_base - center_top),
+			FloatPoint(- center_left, height_base - center_top)
+		};
 
 		// calculate rotated positions of uncropped rectangle verticies (relative to parent)
 		FloatPoint baseVerticiesPos[RECT_VERTICIES_COUNT];
@@ -312,10 +304,11 @@ namespace MyGUI
 		int offsetX = /*mCurrentCoord.left +*/ (int)center_left;
 		int offsetY = /*mCurrentCoord.top +*/ (int)center_top;
 
+		// sin and cos are calculated once per angle in setAngle
 		for (int i = 0; i < RECT_VERTICIES_COUNT; ++i)
 		{
-			baseVerticiesPos[i].left = offsetX + cos(-mAngle + baseAngles[i]) * baseDistances[i];
-			baseVerticiesPos[i].top = offsetY - sin(-mAngle + baseAngles[i]) * baseDistances[i];
+			baseVerticiesPos[i].left = offsetX + baseOffsets[i].left * mAngleCos - baseOffsets[i].top * mAngleSin;
+			baseVerticiesPos[i].top = offsetY + baseOffsets[i].left * mAngleSin + baseOffsets[i].top * mAngleCos;
 		}
 
 		// base texture coordinates
@@ -333,38 +326,50 @@ namespace MyGUI
 
 		// now we are going to calculate verticies of resulting figure
 
-		// no parent - no cropping
+		// no parent or whole figure inside parent - no cropping
 		size_t size = RECT_VERTICIES_COUNT;
-		if (nullptr == mCroppedParent->getCroppedParent())
+		ICroppedRectangle* parent = mCroppedParent->getCroppedParent();
+		IntCoord cropRectangle;
+		if (nullptr != parent)
+		{
+			cropRectangle = IntCoord(
+				parent->_getMarginLeft() - mCroppedParent->getLeft(),
+				parent->_getMarginTop() - mCroppedParent->getTop(),
+				parent->_getViewWidth(),
+				parent->_getViewHeight());
+		}
+
+		if (nullptr == parent || geometry_utility::isPolygonInsideRect(baseVerticiesPos, RECT_VERTICIES_COUNT, cropRectangle))
 		{
 			for (int i = 0; i < RECT_VERTICIES_COUNT; ++i)
 			{
 				mResultVerticiesPos[i] = baseVerticiesPos[i];
 				mResultVerticiesUV[i] = baseVerticiesUV[i];
 			}
+			for (size_t i = RECT_VERTICIES_COUNT; i < GEOMETRY_VERTICIES_TOTAL_COUNT; ++i)
+			{
+				// all unused verticies is equal to last used
+				mResultVerticiesUV[i] = mResultVerticiesUV[size - 1];
+			}
 		}
 		else
 		{
-			ICroppedRectangle* parent = mCroppedParent->getCroppedParent();
-
-			VectorFloatPoint resultVerticiesPos = geometry_utility::cropPolygon(
+			FloatPoint tempVerticies[GEOMETRY_VERTICIES_TOTAL_COUNT];
+			size = geometry_utility::cropPolygon(
 				baseVerticiesPos,
 				RECT_VERTICIES_COUNT,
-				IntCoord(
-					parent->_getMarginLeft() - mCroppedParent->getLeft(),
-					parent->_getMarginTop() - mCroppedParent->getTop(),
-					parent->_getViewWidth(),
-					parent->_getViewHeight()
-					)
-				);
-
-			for (size_t i = 0; i < resultVerticiesPos.size(); ++i)
+				cropRectangle,
+				mResultVerticiesPos,
+				tempVerticies);
+
+			// fully cropped
+			if (size == 0)
 			{
-				mResultVerticiesPos[i] = resultVerticiesPos[i];
+				mResultVerticiesPos[0] = FloatPoint();
+				mResultVerticiesUV[0] = baseVerticiesUV[0];
+				size = 1;
 			}
 
-			size = resultVerticiesPos.size();
-
 			// calculate texture coordinates
 			FloatPoint v0 = baseVerticiesUV[3] - baseVerticiesUV[0];
 			FloatPoint v1 = baseVerticiesUV[1] - baseVerticiesUV[0];
@@ -86,6 +86,8 @@ namespace MyGUI
 			mChildItem->removeUsing();
 			if (0 == mChildItem->countUsing())
 			{
+				mDirtyRect = DirtyRegion::combine(mDirtyRect, mChildItem->getNodeRect());
+
 				delete mChildItem;
 				mChildItem = nullptr;
 			}
@@ -178,6 +180,15 @@ namespace MyGUI
 		return mViewSize;
 	}
 
+	void SharedLayer::addDirtyRegion(DirtyRegion& _region)
+	{
+		if (mChildItem != nullptr)
+			mChildItem->addDirtyRegion(_region);
+
+		_region.addRect(mDirtyRect);
+		mDirtyRect.clear();
+	}
+
 	bool SharedLayer::isOutOfDate() const
 	{
 		if (mChildItem->isOutOfDate())
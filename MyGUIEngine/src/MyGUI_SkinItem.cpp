@@ -103,12 +103,12 @@ namespace MyGUI
 
 		setRenderItemTexture(mTexture);
 
-		std::string categoryName = SubWidgetManager::getInstance().getCategoryName();
+		const std::string& categoryName = SubWidgetManager::getInstance().getCategoryName();
 		// загружаем кирпичики виджета
 		FactoryManager& factory = FactoryManager::getInstance();
 		for (VectorSubWidgetInfo::const_iterator iter = _info->getBasisInfo().begin(); iter != _info->getBasisInfo().end(); ++iter)
 		{
-			IObject* object = factory.createObject(categoryName, (*iter).type);
+			IObject* object = (*iter).factory != nullptr ? factory.createObject((*iter).factory) : factory.createObject(categoryName, (*iter).type);
 			if (object == nullptr)
 				continue;
 
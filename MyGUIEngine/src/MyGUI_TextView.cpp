@@ -108,11 +108,37 @@ namespace MyGUI
 
 	TextView::TextView() :
 		mLength(0),
-		mFontHeight(0)
+		mFontHeight(0),
+		mTagged(false)
 	{
 	}
 
+	bool TextView::isTagged(const UString& _text)
+	{
+		return _text.find('#') != UString::npos;
+	}
+
+	bool TextView::isTagged() const
+	{
+		return mTagged;
+	}
+
 	void TextView::update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		update(_text, isTagged(_text), _font, _height, _align, _format, _maxWidth);
+	}
+
+	void TextView::update(const UString& _text, bool _tagged, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		mTagged = _tagged;
+		if (_tagged)
+			updateText<true>(_text, _font, _height, _align, _format, _maxWidth);
+		else
+			updateText<false>(_text, _font, _height, _align, _format, _maxWidth);
+	}
+
+	template <bool Tagged>
+	void TextView::updateText(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
 	{
 		mFontHeight = _height;
 
@@ -178,8 +204,8 @@ namespace MyGUI
 
 				continue;
 			}
-			// тег
-			else if (character == L'#')
+			// тег, для текста без тегов ветка убирается при компиляции
+			else if (Tagged && character == L'#')
 			{
 				// берем следующий символ
 				++ index;
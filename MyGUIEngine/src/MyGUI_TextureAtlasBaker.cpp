@@ -0,0 +1,346 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TextureAtlasBaker.h"
+#include "MyGUI_ResourceManager.h"
+#include "MyGUI_ResourceSkin.h"
+#include "MyGUI_ResourceImageSet.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_DataManager.h"
+#include "MyGUI_DataStreamHolder.h"
+#include "MyGUI_TextureUtility.h"
+#include "MyGUI_XmlDocument.h"
+
+namespace MyGUI
+{
+
+	// border of copied texture edge around each texture, so filtering doesn't take neighbours
+	const int TextureBorder = 1;
+
+	TextureAtlasBaker::TextureAtlasBaker()
+	{
+		mAtlas.setPageSize(2048);
+	}
+
+	TextureAtlasBaker::~TextureAtlasBaker()
+	{
+	}
+
+	void TextureAtlasBaker::addSkin(ResourceSkin* _skin)
+	{
+		if (_skin != nullptr)
+			mSkins.push_back(_skin);
+	}
+
+	void TextureAtlasBaker::addImageSet(ResourceImageSet* _imageSet)
+	{
+		if (_imageSet != nullptr)
+			mImageSets.push_back(_imageSet);
+	}
+
+	void TextureAtlasBaker::addAllResources()
+	{
+		ResourceManager::EnumeratorPtr resource = ResourceManager::getInstance().getEnumerator();
+		while (resource.next())
+		{
+			IResource* item = resource.current().second;
+			addSkin(item->castType<ResourceSkin>(false));
+			addImageSet(item->castType<ResourceImageSet>(false));
+		}
+	}
+
+	bool TextureAtlasBaker::bake()
+	{
+		set<std::string>::type textures;
+		collectTextures(textures);
+
+		mStatistics.textures = textures.size();
+
+		set<std::string>::type pages;
+		for (set<std::string>::type::const_iterator texture = textures.begin(); texture != textures.end(); ++texture)
+		{
+			if (mPlacements.find(*texture) != mPlacements.end())
+				continue;
+
+			Placement placement;
+			if (copyTexture(*texture, placement))
+				mPlacements[*texture] = placement;
+		}
+
+		mAtlas.update();
+
+		for (MapPlacement::const_iterator placement = mPlacements.begin(); placement != mPlacements.end(); ++placement)
+			pages.insert(placement->second.page);
+
+		mStatistics.bakedTextures = mPlacements.size();
+		mStatistics.pages = pages.size();
+
+		replaceTextures();
+
+		MYGUI_LOG(Info, "TextureAtlasBaker: " << mStatistics.bakedTextures << " of " << mStatistics.textures << " textures baked on " << mStatistics.pages << " pages, "
+			<< mStatistics.skins << " skins and " << mStatistics.imageSets << " image sets moved, pages " << (int)(mAtlas.getStatistics().getOccupancy() * 100) << "% used");
+
+		return !mPlacements.empty();
+	}
+
+	bool TextureAtlasBaker::save(const std::string& _fileName)
+	{
+		if (mPlacements.empty())
+			return false;
+
+		// pages are saved as <name>_<index>.png next to layout file and referenced by file name only
+		std::string::size_type dot = _fileName.find_last_of('.');
+		std::string::size_type slash = _fileName.find_last_of("/\\");
+		std::string base = (dot != std::string::npos && (slash == std::string::npos || dot > slash)) ? _fileName.substr(0, dot) : _fileName;
+		std::string directory = slash != std::string::npos ? _fileName.substr(0, slash + 1) : "";
+
+		xml::Document doc;
+		doc.createDeclaration();
+		xml::ElementPtr root = doc.createRoot("MyGUI");
+		root->addAttribute("type", "TextureAtlas");
+
+		map<std::string, std::string>::type pageFiles;
+		for (MapPlacement::const_iterator placement = mPlacements.begin(); placement != mPlacements.end(); ++placement)
+		{
+			std::string& file = pageFiles[placement->second.page];
+			if (file.empty())
+			{
+				file = utility::toString(base, "_", pageFiles.size() - 1, ".png");
+
+				ITexture* texture = RenderManager::getInstance().getTexture(placement->second.page);
+				if (texture == nullptr)
+					return false;
+				texture->saveToFile(file);
+			}
+		}
+
+		for (map<std::string, std::string>::type::const_iterator page = pageFiles.begin(); page != pageFiles.end(); ++page)
+		{
+			xml::ElementPtr pageNode = root->createChild("Page");
+			pageNode->addAttribute("texture", page->second.substr(directory.size()));
+
+			for (MapPlacement::const_iterator placement = mPlacements.begin(); placement != mPlacements.end(); ++placement)
+			{
+				if (placement->second.page != page->first)
+					continue;
+
+				xml::ElementPtr textureNode = pageNode->createChild("Texture");
+				textureNode->addAttribute("name", placement->first);
+				textureNode->addAttribute("coord", placement->second.coord);
+			}
+		}
+
+		if (!doc.save(_fileName))
+		{
+			MYGUI_LOG(Error, "TextureAtlasBaker: " << doc.getLastError());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureAtlasBaker::load(const std::string& _fileName)
+	{
+		DataStreamHolder data = DataManager::getInstance().getData(_fileName);
+		if (data.getData() == nullptr)
+		{
+			MYGUI_LOG(Error, "TextureAtlasBaker: file '" << _fileName << "' not found");
+			return false;
+		}
+
+		xml::Document doc;
+		if (!doc.open(data.getData()))
+		{
+			MYGUI_LOG(Error, "TextureAtlasBaker: " << doc.getLastError());
+			return false;
+		}
+
+		xml::ElementPtr root = doc.getRoot();
+		if (root == nullptr || root->getName() != "MyGUI" || root->findAttribute("type") != "TextureAtlas")
+		{
+			MYGUI_LOG(Error, "TextureAtlasBaker: file '" << _fileName << "' is not texture atlas");
+			return false;
+		}
+
+		set<std::string>::type textures;
+		collectTextures(textures);
+		mStatistics.textures = textures.size();
+
+		xml::ElementEnumerator page = root->getElementEnumerator();
+		while (page.next("Page"))
+		{
+			Placement placement;
+			placement.page = page->findAttribute("texture");
+
+			// loads the page
+			if (texture_utility::getTextureSize(placement.page, false).empty())
+				continue;
+
+			mStatistics.pages ++;
+
+			xml::ElementEnumerator texture = page->getElementEnumerator();
+			while (texture.next("Texture"))
+			{
+				placement.coord = IntCoord::parse(texture->findAttribute("coord"));
+				mPlacements[texture->findAttribute("name")] = placement;
+			}
+		}
+
+		mStatistics.bakedTextures = mPlacements.size();
+
+		replaceTextures();
+
+		return !mPlacements.empty();
+	}
+
+	void TextureAtlasBaker::setPageSize(int _value)
+	{
+		mAtlas.setPageSize(_value);
+	}
+
+	int TextureAtlasBaker::getPageSize() const
+	{
+		return mAtlas.getPageSize();
+	}
+
+	const TextureAtlasBaker::Statistics& TextureAtlasBaker::getStatistics() const
+	{
+		return mStatistics;
+	}
+
+	void TextureAtlasBaker::collectTextures(set<std::string>::type& _textures) const
+	{
+		for (VectorSkin::const_iterator skin = mSkins.begin(); skin != mSkins.end(); ++skin)
+		{
+			if (!(*skin)->getTextureName().empty())
+				_textures.insert((*skin)->getTextureName());
+		}
+
+		for (VectorImageSet::const_iterator imageSet = mImageSets.begin(); imageSet != mImageSets.end(); ++imageSet)
+		{
+			EnumeratorGroupImage group = (*imageSet)->getEnumerator();
+			while (group.next())
+			{
+				if (!group.current().texture.empty())
+					_textures.insert(group.current().texture);
+			}
+		}
+	}
+
+	bool TextureAtlasBaker::copyTexture(const std::string& _texture, Placement& _placement)
+	{
+		// loads the texture if it isn't loaded yet
+		const IntSize& size = texture_utility::getTextureSize(_texture, false);
+		int width = size.width;
+		int height = size.height;
+		if (width == 0 || height == 0 || width + TextureBorder * 2 > mAtlas.getPageSize() || height + TextureBorder * 2 > mAtlas.getPageSize())
+			return false;
+
+		ITexture* texture = RenderManager::getInstance().getTexture(_texture);
+		size_t sourceBytes = texture != nullptr ? GlyphAtlas::getNumElemBytes(texture->getFormat()) : 0;
+		if (sourceBytes == 0)
+			return false;
+
+		const uint8* source = static_cast<const uint8*>(texture->lock(TextureUsage::Read));
+		if (source == nullptr)
+		{
+			MYGUI_LOG(Warning, "TextureAtlasBaker: texture '" << _texture << "' can't be read and stays separate");
+			return false;
+		}
+
+		GlyphAtlas::Region region;
+		if (!mAtlas.allocate(this, width + TextureBorder * 2, height + TextureBorder * 2, PixelFormat::R8G8B8A8, TextureUsage::Static | TextureUsage::Write, region))
+		{
+			texture->unlock();
+			return false;
+		}
+
+		for (int y = -TextureBorder; y < height + TextureBorder; ++y)
+		{
+			const uint8* sourceRow = source + std::min(std::max(y, 0), height - 1) * width * sourceBytes;
+			uint8* dest = region.memory + (y + TextureBorder) * region.pitch;
+
+			for (int x = -TextureBorder; x < width + TextureBorder; ++x, dest += 4)
+			{
+				const uint8* src = sourceRow + std::min(std::max(x, 0), width - 1) * sourceBytes;
+				if (sourceBytes >= 3)
+				{
+					dest[0] = src[0];
+					dest[1] = src[1];
+					dest[2] = src[2];
+					dest[3] = sourceBytes == 4 ? src[3] : 0xFF;
+				}
+				else
+				{
+					dest[0] = dest[1] = dest[2] = src[0];
+					dest[3] = sourceBytes == 2 ? src[1] : 0xFF;
+				}
+			}
+		}
+
+		texture->unlock();
+
+		_placement.page = region.texture->getName();
+		_placement.coord.set(region.coord.left + TextureBorder, region.coord.top + TextureBorder, width, height);
+		return true;
+	}
+
+	void TextureAtlasBaker::replaceTextures()
+	{
+		mStatistics.skins = 0;
+		mStatistics.imageSets = 0;
+
+		for (VectorSkin::const_iterator skin = mSkins.begin(); skin != mSkins.end(); ++skin)
+		{
+			MapPlacement::const_iterator placement = mPlacements.find((*skin)->getTextureName());
+			if (placement == mPlacements.end())
+				continue;
+
+			if ((*skin)->replaceTexture(placement->second.page, placement->second.coord))
+				mStatistics.skins ++;
+			else
+				MYGUI_LOG(Warning, "TextureAtlasBaker: skin '" << (*skin)->getResourceName() << "' has unknown states and keeps texture '" << (*skin)->getTextureName() << "'");
+		}
+
+		for (VectorImageSet::const_iterator imageSet = mImageSets.begin(); imageSet != mImageSets.end(); ++imageSet)
+		{
+			set<std::string>::type textures;
+			EnumeratorGroupImage group = (*imageSet)->getEnumerator();
+			while (group.next())
+				textures.insert(group.current().texture);
+
+			bool moved = false;
+			for (set<std::string>::type::const_iterator texture = textures.begin(); texture != textures.end(); ++texture)
+			{
+				MapPlacement::const_iterator placement = mPlacements.find(*texture);
+				if (placement == mPlacements.end())
+					continue;
+
+				(*imageSet)->replaceTexture(*texture, placement->second.page, placement->second.coord.point());
+				moved = true;
+			}
+
+			if (moved)
+				mStatistics.imageSets ++;
+		}
+	}
+
+} // namespace MyGUI
@@ -32,6 +32,128 @@ namespace MyGUI
 	namespace texture_utility
 	{
 
+		namespace
+		{
+
+			// offset to the nearest seed pixel, 8SSEDT
+			struct DistancePoint
+			{
+				int dx;
+				int dy;
+
+				int distSq() const
+				{
+					return dx * dx + dy * dy;
+				}
+			};
+
+			const int DistanceEmpty = 0x3FFF;
+
+			MYGUI_FORCEINLINE void compareDistance(DistancePoint* _grid, int _width, int _height, int _x, int _y, int _offsetX, int _offsetY)
+			{
+				int x = _x + _offsetX;
+				int y = _y + _offsetY;
+				if (x < 0 || y < 0 || x >= _width || y >= _height)
+					return;
+
+				DistancePoint& point = _grid[_y * _width + _x];
+				DistancePoint other = _grid[y * _width + x];
+				other.dx += _offsetX;
+				other.dy += _offsetY;
+
+				if (other.distSq() < point.distSq())
+					point = other;
+			}
+
+			void propagateDistance(DistancePoint* _grid, int _width, int _height)
+			{
+				for (int y = 0; y < _height; ++y)
+				{
+					for (int x = 0; x < _width; ++x)
+					{
+						compareDistance(_grid, _width, _height, x, y, -1, 0);
+						compareDistance(_grid, _width, _height, x, y, 0, -1);
+						compareDistance(_grid, _width, _height, x, y, -1, -1);
+						compareDistance(_grid, _width, _height, x, y, 1, -1);
+					}
+					for (int x = _width - 1; x >= 0; --x)
+						compareDistance(_grid, _width, _height, x, y, 1, 0);
+				}
+
+				for (int y = _height - 1; y >= 0; --y)
+				{
+					for (int x = _width - 1; x >= 0; --x)
+					{
+						compareDistance(_grid, _width, _height, x, y, 1, 0);
+						compareDistance(_grid, _width, _height, x, y, 0, 1);
+						compareDistance(_grid, _width, _height, x, y, -1, 1);
+						compareDistance(_grid, _width, _height, x, y, 1, 1);
+					}
+					for (int x = 0; x < _width; ++x)
+						compareDistance(_grid, _width, _height, x, y, -1, 0);
+				}
+			}
+
+		} // namespace
+
+		void generateDistanceField(
+			const uint8* _source,
+			int _sourceWidth,
+			int _sourceHeight,
+			int _sourcePitch,
+			uint8* _dest,
+			int _destWidth,
+			int _destHeight,
+			int _spread)
+		{
+			size_t count = (size_t)(_destWidth * _destHeight);
+			if (count == 0)
+				return;
+
+			// coverage in field space, everything outside of the source is empty
+			vector<uint8>::type coverage(count, 0);
+			int rows = std::min(_sourceHeight, _destHeight - _spread);
+			int columns = std::min(_sourceWidth, _destWidth - _spread);
+			for (int y = 0; y < rows; ++y)
+			{
+				for (int x = 0; x < columns; ++x)
+					coverage[(y + _spread) * _destWidth + x + _spread] = _source[y * _sourcePitch + x];
+			}
+
+			// distance to the nearest inside pixel and to the nearest outside pixel
+			DistancePoint empty = { DistanceEmpty, DistanceEmpty };
+			DistancePoint seed = { 0, 0 };
+			vector<DistancePoint>::type inside(count);
+			vector<DistancePoint>::type outside(count);
+			for (size_t index = 0; index < count; ++index)
+			{
+				bool in = coverage[index] >= 128;
+				inside[index] = in ? seed : empty;
+				outside[index] = in ? empty : seed;
+			}
+
+			propagateDistance(&inside[0], _destWidth, _destHeight);
+			propagateDistance(&outside[0], _destWidth, _destHeight);
+
+			float scale = 127.5f / (float)std::max(_spread, 1);
+			for (size_t index = 0; index < count; ++index)
+			{
+				uint8 value = coverage[index];
+
+				// pixel centres are half pixel away from the edge, partially covered pixels know it better
+				float distance;
+				if (value != 0 && value != 255)
+					distance = (float)value / 255.0f - 0.5f;
+				else if (value >= 128)
+					distance = sqrt((float)outside[index].distSq()) - 0.5f;
+				else
+					distance = 0.5f - sqrt((float)inside[index].distSq());
+
+				float field = 127.5f + distance * scale;
+				_dest[index] = (uint8)(field < 0.0f ? 0.0f : (field > 255.0f ? 255.0f : field + 0.5f));
+			}
+		}
+
 		const IntSize& getTextureSize(const std::string& _texture, bool _cache)
 		{
 			static std::string prevTexture;
@@ -0,0 +1,425 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_Thread.h"
+
+#ifdef MYGUI_USE_THREADS
+#	if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#		include <windows.h>
+#		include <process.h>
+#	else
+#		include <pthread.h>
+#		include <unistd.h>
+#	endif
+#endif
+
+namespace MyGUI
+{
+
+#ifdef MYGUI_USE_THREADS
+#	if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+
+	Mutex::Mutex() :
+		mHandle(nullptr)
+	{
+		CRITICAL_SECTION* section = new CRITICAL_SECTION();
+		::InitializeCriticalSection(section);
+		mHandle = section;
+	}
+
+	Mutex::~Mutex()
+	{
+		CRITICAL_SECTION* section = static_cast<CRITICAL_SECTION*>(mHandle);
+		::DeleteCriticalSection(section);
+		delete section;
+	}
+
+	void Mutex::lock()
+	{
+		::EnterCriticalSection(static_cast<CRITICAL_SECTION*>(mHandle));
+	}
+
+	void Mutex::unlock()
+	{
+		::LeaveCriticalSection(static_cast<CRITICAL_SECTION*>(mHandle));
+	}
+
+	ThreadEvent::ThreadEvent() :
+		mHandle(::CreateEvent(nullptr, FALSE, FALSE, nullptr))
+	{
+	}
+
+	ThreadEvent::~ThreadEvent()
+	{
+		::CloseHandle(mHandle);
+	}
+
+	void ThreadEvent::set()
+	{
+		::SetEvent(mHandle);
+	}
+
+	void ThreadEvent::wait()
+	{
+		::WaitForSingleObject(mHandle, INFINITE);
+	}
+
+	static unsigned __stdcall threadProc(void* _thread)
+	{
+		Thread::ThreadDelegate* delegate = static_cast<Thread::ThreadDelegate*>(_thread);
+		(*delegate)();
+		return 0;
+	}
+
+	bool Thread::start(ThreadDelegate::IDelegate* _delegate)
+	{
+		MYGUI_ASSERT(mHandle == nullptr, "Thread already started");
+		mDelegate = _delegate;
+
+		uintptr_t handle = ::_beginthreadex(nullptr, 0, threadProc, &mDelegate, 0, nullptr);
+		if (handle == 0)
+		{
+			mDelegate.clear();
+			return false;
+		}
+
+		mHandle = (void*)handle;
+		return true;
+	}
+
+	void Thread::join()
+	{
+		if (mHandle == nullptr)
+			return;
+
+		::WaitForSingleObject(mHandle, INFINITE);
+		::CloseHandle(mHandle);
+		mHandle = nullptr;
+		mDelegate.clear();
+	}
+
+	size_t Thread::getHardwareConcurrency()
+	{
+		SYSTEM_INFO info;
+		::GetSystemInfo(&info);
+		return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+	}
+
+	namespace atomic
+	{
+		long increment(volatile long& _value)
+		{
+			return ::InterlockedIncrement(&_value);
+		}
+
+		long decrement(volatile long& _value)
+		{
+			return ::InterlockedDecrement(&_value);
+		}
+
+		long compareExchange(volatile long& _value, long _exchange, long _comparand)
+		{
+			return ::InterlockedCompareExchange(&_value, _exchange, _comparand);
+		}
+
+		long load(volatile long& _value)
+		{
+			return ::InterlockedCompareExchange(&_value, 0, 0);
+		}
+
+		void store(volatile long& _value, long _new)
+		{
+			::InterlockedExchange(&_value, _new);
+		}
+	}
+
+#	else
+
+	struct ThreadEventData
+	{
+		pthread_mutex_t mutex;
+		pthread_cond_t condition;
+		bool signaled;
+	};
+
+	Mutex::Mutex() :
+		mHandle(nullptr)
+	{
+		pthread_mutex_t* mutex = new pthread_mutex_t();
+		pthread_mutex_init(mutex, nullptr);
+		mHandle = mutex;
+	}
+
+	Mutex::~Mutex()
+	{
+		pthread_mutex_t* mutex = static_cast<pthread_mutex_t*>(mHandle);
+		pthread_mutex_destroy(mutex);
+		delete mutex;
+	}
+
+	void Mutex::lock()
+	{
+		pthread_mutex_lock(static_cast<pthread_mutex_t*>(mHandle));
+	}
+
+	void Mutex::unlock()
+	{
+		pthread_mutex_unlock(static_cast<pthread_mutex_t*>(mHandle));
+	}
+
+	ThreadEvent::ThreadEvent() :
+		mHandle(nullptr)
+	{
+		ThreadEventData* data = new ThreadEventData();
+		pthread_mutex_init(&data->mutex, nullptr);
+		pthread_cond_init(&data->condition, nullptr);
+		data->signaled = false;
+		mHandle = data;
+	}
+
+	ThreadEvent::~ThreadEvent()
+	{
+		ThreadEventData* data = static_cast<ThreadEventData*>(mHandle);
+		pthread_cond_destroy(&data->condition);
+		pthread_mutex_destroy(&data->mutex);
+		delete data;
+	}
+
+	void ThreadEvent::set()
+	{
+		ThreadEventData* data = static_cast<ThreadEventData*>(mHandle);
+		pthread_mutex_lock(&data->mutex);
+		data->signaled = true;
+		pthread_cond_signal(&data->condition);
+		pthread_mutex_unlock(&data->mutex);
+	}
+
+	void ThreadEvent::wait()
+	{
+		ThreadEventData* data = static_cast<ThreadEventData*>(mHandle);
+		pthread_mutex_lock(&data->mutex);
+		while (!data->signaled)
+			pthread_cond_wait(&data->condition, &data->mutex);
+		data->signaled = false;
+		pthread_mutex_unlock(&data->mutex);
+	}
+
+	static void* threadProc(void* _thread)
+	{
+		Thread::ThreadDelegate* delegate = static_cast<Thread::ThreadDelegate*>(_thread);
+		(*delegate)();
+		return nullptr;
+	}
+
+	bool Thread::start(ThreadDelegate::IDelegate* _delegate)
+	{
+		MYGUI_ASSERT(mHandle == nullptr, "Thread already started");
+		mDelegate = _delegate;
+
+		pthread_t* thread = new pthread_t();
+		if (pthread_create(thread, nullptr, threadProc, &mDelegate) != 0)
+		{
+			delete thread;
+			mDelegate.clear();
+			return false;
+		}
+
+		mHandle = thread;
+		return true;
+	}
+
+	void Thread::join()
+	{
+		if (mHandle == nullptr)
+			return;
+
+		pthread_t* thread = static_cast<pthread_t*>(mHandle);
+		pthread_join(*thread, nullptr);
+		delete thread;
+		mHandle = nullptr;
+		mDelegate.clear();
+	}
+
+	size_t Thread::getHardwareConcurrency()
+	{
+		long count = sysconf(_SC_NPROCESSORS_ONLN);
+		return count > 0 ? (size_t)count : 1;
+	}
+
+	namespace atomic
+	{
+		long increment(volatile long& _value)
+		{
+			return __sync_add_and_fetch(&_value, 1);
+		}
+
+		long decrement(volatile long& _value)
+		{
+			return __sync_sub_and_fetch(&_value, 1);
+		}
+
+		long compareExchange(volatile long& _value, long _exchange, long _comparand)
+		{
+			return __sync_val_compare_and_swap(&_value, _comparand, _exchange);
+		}
+
+		long load(volatile long& _value)
+		{
+			__sync_synchronize();
+			long result = _value;
+			__sync_synchronize();
+			return result;
+		}
+
+		void store(volatile long& _value, long _new)
+		{
+			__sync_synchronize();
+			_value = _new;
+			__sync_synchronize();
+		}
+	}
+
+#	endif
+
+	Thread::Thread() :
+		mHandle(nullptr)
+	{
+	}
+
+	Thread::~Thread()
+	{
+		join();
+	}
+
+	bool Thread::isRunning() const
+	{
+		return mHandle != nullptr;
+	}
+
+	bool Thread::isSupported()
+	{
+		return true;
+	}
+
+#else
+
+	Mutex::Mutex() :
+		mHandle(nullptr)
+	{
+	}
+
+	Mutex::~Mutex()
+	{
+	}
+
+	void Mutex::lock()
+	{
+	}
+
+	void Mutex::unlock()
+	{
+	}
+
+	ThreadEvent::ThreadEvent() :
+		mHandle(nullptr)
+	{
+	}
+
+	ThreadEvent::~ThreadEvent()
+	{
+	}
+
+	void ThreadEvent::set()
+	{
+	}
+
+	void ThreadEvent::wait()
+	{
+	}
+
+	Thread::Thread() :
+		mHandle(nullptr)
+	{
+	}
+
+	Thread::~Thread()
+	{
+	}
+
+	bool Thread::start(ThreadDelegate::IDelegate* _delegate)
+	{
+		delete _delegate;
+		return false;
+	}
+
+	void Thread::join()
+	{
+	}
+
+	bool Thread::isRunning() const
+	{
+		return false;
+	}
+
+	bool Thread::isSupported()
+	{
+		return false;
+	}
+
+	size_t Thread::getHardwareConcurrency()
+	{
+		return 1;
+	}
+
+	namespace atomic
+	{
+		long increment(volatile long& _value)
+		{
+			return ++_value;
+		}
+
+		long decrement(volatile long& _value)
+		{
+			return --_value;
+		}
+
+		long compareExchange(volatile long& _value, long _exchange, long _comparand)
+		{
+			long result = _value;
+			if (result == _comparand)
+				_value = _exchange;
+			return result;
+		}
+
+		long load(volatile long& _value)
+		{
+			return _value;
+		}
+
+		void store(volatile long& _value, long _new)
+		{
+			_value = _new;
+		}
+	}
+
+#endif
+
+} // namespace MyGUI
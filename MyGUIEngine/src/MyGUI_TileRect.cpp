@@ -28,22 +28,91 @@
 #include "MyGUI_CommonStateInfo.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_TextureUtility.h"
+#include "MyGUI_VertexUtility.h"
 
 namespace MyGUI
 {
 
 	const size_t TILERECT_COUNT_VERTEX = 16 * VertexQuad::VertexCount;
 
+	namespace
+	{
+
+		// part of tile along one axis, in pixels and texture coordinates
+		struct TileSpan
+		{
+			float vertex0;
+			float vertex1;
+			float texture0;
+			float texture1;
+		};
+
+		// visible tiles along one axis, only the first and the last of them can be cropped
+		struct TileAxis
+		{
+			int count;
+			TileSpan first;
+			TileSpan last;
+			// start of the second tile, tiles between the first and the last are whole
+			float interior;
+			float step;
+			float texture0;
+			float texture1;
+		};
+
+		TileSpan cropTile(int _start, int _tile, int _viewStart, int _viewEnd, float _texture0, float _texture1)
+		{
+			int start = std::max(_start, _viewStart);
+			int end = std::min(_start + _tile, _viewEnd);
+			float scale = (_texture1 - _texture0) / (float)_tile;
+
+			TileSpan result;
+			result.vertex0 = (float)start;
+			result.vertex1 = (float)end;
+			result.texture0 = _texture0 + (float)(start - _start) * scale;
+			result.texture1 = _texture1 - (float)(_start + _tile - end) * scale;
+			return result;
+		}
+
+		TileAxis getTileAxis(int _start, int _size, int _tile, int _viewStart, int _viewEnd, float _texture0, float _texture1)
+		{
+			int begin = std::max(0, (_viewStart - _start) / _tile);
+			int end = std::min((_size + _tile - 1) / _tile, (_viewEnd - _start + _tile - 1) / _tile);
+
+			TileAxis result;
+			result.count = std::max(0, end - begin);
+			result.first = cropTile(_start + begin * _tile, _tile, _viewStart, _viewEnd, _texture0, _texture1);
+			result.last = cropTile(_start + (end - 1) * _tile, _tile, _viewStart, _viewEnd, _texture0, _texture1);
+			result.interior = (float)(_start + (begin + 1) * _tile);
+			result.step = (float)_tile;
+			result.texture0 = _texture0;
+			result.texture1 = _texture1;
+			return result;
+		}
+
+		TileSpan getTileSpan(const TileAxis& _axis, int _index)
+		{
+			if (_index == 0)
+				return _axis.first;
+			if (_index == _axis.count - 1)
+				return _axis.last;
+
+			TileSpan result;
+			result.vertex0 = _axis.interior + (float)(_index - 1) * _axis.step;
+			result.vertex1 = result.vertex0 + _axis.step;
+			result.texture0 = _axis.texture0;
+			result.texture1 = _axis.texture1;
+			return result;
+		}
+
+	} // namespace
+
 	TileRect::TileRect() :
 		mEmptyView(false),
 		mCurrentColour(0xFFFFFFFF),
 		mNode(nullptr),
 		mRenderItem(nullptr),
 		mCountVertex(TILERECT_COUNT_VERTEX),
-		mRealTileWidth(0),
-		mRealTileHeight(0),
-		mTextureHeightOne(0),
-		mTextureWidthOne(0),
 		mTileH(true),
 		mTileV(true)
 	{
@@ -211,145 +280,48 @@ namespace MyGUI
         return;
 #endif
 
-		VertexQuad* quad = reinterpret_cast<VertexQuad*>(mRenderItem->getCurrentVertexBuffer());
-
 		const RenderTargetInfo& info = mRenderItem->getRenderTarget()->getInfo();
 
-		// размер одного тайла
-		mRealTileWidth = info.pixScaleX * (float)(mTileSize.width) * 2;
-		mRealTileHeight = info.pixScaleY * (float)(mTileSize.height) * 2;
-
-		mTextureHeightOne = (mCurrentTexture.bottom - mCurrentTexture.top) / mRealTileHeight;
-		mTextureWidthOne = (mCurrentTexture.right - mCurrentTexture.left) / mRealTileWidth;
-
-		float vertex_z = mNode->getNodeDepth();
-
-		// абсолютный размер окна
-		float window_left = ((info.pixScaleX * (float)(mCoord.left + mCroppedParent->getAbsoluteLeft() - info.leftOffset) + info.hOffset) * 2) - 1;
-		float window_top = -(((info.pixScaleY * (float)(mCoord.top + mCroppedParent->getAbsoluteTop() - info.topOffset) + info.vOffset) * 2) - 1);
-
-		// размер вьюпорта
-		float real_left = ((info.pixScaleX * (float)(mCurrentCoord.left + mCroppedParent->getAbsoluteLeft() - info.leftOffset) + info.hOffset) * 2) - 1;
-		float real_right = real_left + (info.pixScaleX * (float)mCurrentCoord.width * 2);
-		float real_top = -(((info.pixScaleY * (float)(mCurrentCoord.top + mCroppedParent->getAbsoluteTop() - info.topOffset) + info.vOffset) * 2) - 1);
-		float real_bottom = real_top - (info.pixScaleY * (float)mCurrentCoord.height * 2);
-
-		size_t count = 0;
+		// тайлы считаются в пикселях относительно родителя, в координаты вьюпорта их переводит writer
+		vertex_utility::QuadTransform transform(
+			info,
+			(float)(mCroppedParent->getAbsoluteLeft() - info.leftOffset),
+			(float)(mCroppedParent->getAbsoluteTop() - info.topOffset));
+		vertex_utility::QuadWriter writer(mRenderItem->getCurrentVertexBuffer(), mNode->getNodeDepth(), transform);
 
-		float left = window_left;
-		float right = window_left;
-		float top = window_top;
-		float bottom = window_top;
+		TileAxis columns = getTileAxis(mCoord.left, mCoord.width, mTileSize.width, mCurrentCoord.left, mCurrentCoord.right(), mCurrentTexture.left, mCurrentTexture.right);
+		TileAxis rows = getTileAxis(mCoord.top, mCoord.height, mTileSize.height, mCurrentCoord.top, mCurrentCoord.bottom(), mCurrentTexture.top, mCurrentTexture.bottom);
 
-		for (int y = 0; y < mCoord.height; y += mTileSize.height)
+		for (int row = 0; row < rows.count; ++row)
 		{
-			top = bottom;
-			bottom -= mRealTileHeight;
-			right = window_left;
+			TileSpan span = getTileSpan(rows, row);
 
-			float vertex_top = top;
-			float vertex_bottom = bottom;
-			bool texture_crop_height  = false;
+			// обрезаются только крайние тайлы строки
+			writer.add(
+				FloatRect(columns.first.vertex0, span.vertex0, columns.first.vertex1, span.vertex1),
+				FloatRect(columns.first.texture0, span.texture0, columns.first.texture1, span.texture1),
+				mCurrentColour);
 
-			if (vertex_top > real_top)
-			{
-				// проверка на полный выход
-				if (vertex_bottom > real_top)
-				{
-					continue;
-				}
-				// обрезаем
-				vertex_top = real_top;
-				texture_crop_height = true;
-			}
-			if (vertex_bottom < real_bottom)
-			{
-				// вообще вниз ушли
-				if (vertex_top < real_bottom)
-				{
-					continue;
-				}
-				// обрезаем
-				vertex_bottom = real_bottom;
-				texture_crop_height = true;
-			}
+			if (columns.count < 2)
+				continue;
 
-			for (int x = 0; x < mCoord.width; x += mTileSize.width)
+			FloatRect texture(columns.texture0, span.texture0, columns.texture1, span.texture1);
+			float left = columns.interior;
+			for (int column = 2; column < columns.count; ++column)
 			{
-				left = right;
-				right += mRealTileWidth;
-
-				float vertex_left = left;
-				float vertex_right = right;
-				bool texture_crop_width = false;
-
-
-				if (vertex_left < real_left)
-				{
-					// проверка на полный выход
-					if (vertex_right < real_left)
-					{
-						continue;
-					}
-					// обрезаем
-					vertex_left = real_left;
-					texture_crop_width = true;
-				}
-
-				if (vertex_right > real_right)
-				{
-					// вообще строку до конца не нуна
-					if (vertex_left > real_right)
-					{
-						continue;
-					}
-					// обрезаем
-					vertex_right = real_right;
-					texture_crop_width = true;
-				}
-
-				// текущие текстурные координаты
-				float texture_left = mCurrentTexture.left;
-				float texture_right = mCurrentTexture.right;
-				float texture_top = mCurrentTexture.top;
-				float texture_bottom = mCurrentTexture.bottom;
-
-				// смещение текстуры по вертикили
-				if (texture_crop_height)
-				{
-					// прибавляем размер смещения в текстурных координатах
-					texture_top += (top - vertex_top) * mTextureHeightOne;
-					// отнимаем размер смещения в текстурных координатах
-					texture_bottom -= (vertex_bottom - bottom) * mTextureHeightOne;
-				}
-
-				// смещение текстуры по горизонтали
-				if (texture_crop_width)
-				{
-					// прибавляем размер смещения в текстурных координатах
-					texture_left += (vertex_left - left) * mTextureWidthOne;
-					// отнимаем размер смещения в текстурных координатах
-					texture_right -= (right - vertex_right) * mTextureWidthOne;
-				}
-
-				quad[count].set(
-					vertex_left,
-					vertex_top,
-					vertex_right,
-					vertex_bottom,
-					vertex_z,
-					texture_left,
-					texture_top,
-					texture_right,
-					texture_bottom,
-					mCurrentColour
-				);
-
-				count ++;
+				writer.add(FloatRect(left, span.vertex0, left + columns.step, span.vertex1), texture, mCurrentColour);
+				left += columns.step;
 			}
+
+			writer.add(
+				FloatRect(columns.last.vertex0, span.vertex0, columns.last.vertex1, span.vertex1),
+				FloatRect(columns.last.texture0, span.texture0, columns.last.texture1, span.texture1),
+				mCurrentColour);
 		}
 
-		mRenderItem->setLastVertexCount(VertexQuad::VertexCount * count);
+		writer.flush();
+
+		mRenderItem->setLastVertexCount(writer.getVertexCount());
 	}
 
 	void TileRect::createDrawItem(ITexture* _texture, ILayerNode* _node)
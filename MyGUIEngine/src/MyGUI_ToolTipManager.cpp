@@ -54,7 +54,6 @@ namespace MyGUI
 		mOldIndex = ITEM_NONE;
 		mNeedToolTip = false;
 
-		Gui::getInstance().eventFrameStart += newDelegate(this, &ToolTipManager::notifyEventFrameStart);
 		WidgetManager::getInstance().registerUnlinker(this);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
@@ -67,7 +66,6 @@ namespace MyGUI
 		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
 
 		WidgetManager::getInstance().unregisterUnlinker(this);
-		Gui::getInstance().eventFrameStart -= newDelegate(this, &ToolTipManager::notifyEventFrameStart);
 
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
 		mIsInitialise = false;
@@ -153,6 +151,17 @@ namespace MyGUI
 		}
 	}
 
+	float ToolTipManager::_getNextFrameDelay() const
+	{
+		if (InputManager::getInstance().getMouseFocusWidget() != mOldFocusWidget)
+			return 0.0f;
+
+		if (!mNeedToolTip || mToolTipVisible)
+			return -1.0f;
+
+		return std::max(mDelayVisible - mCurrentTime, 0.0f);
+	}
+
 	void ToolTipManager::_unlinkWidget(Widget* _widget)
 	{
 		if (mOldFocusWidget == _widget)
@@ -529,6 +529,8 @@ namespace MyGUI
 	{
 		_init();
 		mData = copy.mData;
+		if ( copy.m_bufferUTF8Valid )
+			_storeUTF8( copy.m_buffer.mStrBuffer->data(), copy.m_buffer.mStrBuffer->size() );
 	}
 	//--------------------------------------------------------------------------
 	UString::UString( size_type length, const code_point& ch )
@@ -631,12 +633,16 @@ namespace MyGUI
 	//--------------------------------------------------------------------------
 	void UString::resize( size_type num, const code_point& val /*= 0 */ )
 	{
+		_dataChanged();
 		mData.resize( num, val );
 	}
 	//--------------------------------------------------------------------------
 	void UString::swap( UString& from )
 	{
+		_dataChanged();
+		from._dataChanged();
 		mData.swap( from.mData );
+		std::swap( m_dataExposed, from.m_dataExposed );
 	}
 	//--------------------------------------------------------------------------
 	bool UString::empty() const
@@ -661,6 +667,7 @@ namespace MyGUI
 	//--------------------------------------------------------------------------
 	void UString::clear()
 	{
+		_dataReplaced();
 		mData.clear();
 	}
 	//--------------------------------------------------------------------------
@@ -684,6 +691,7 @@ namespace MyGUI
 #if MYGUI_IS_NATIVE_WCHAR_T
 	void UString::push_back( wchar_t val )
 	{
+		_dataChanged();
 		// we do this because the Unicode method still preserves UTF-16 code points
 		mData.push_back( static_cast<code_point>( val ) );
 	}
@@ -691,11 +699,13 @@ namespace MyGUI
 	//--------------------------------------------------------------------------
 	void UString::push_back( code_point val )
 	{
+		_dataChanged();
 		mData.push_back( val );
 	}
 
 	void UString::push_back( char val )
 	{
+		_dataChanged();
 		mData.push_back( static_cast<code_point>( val ) );
 	}
 
@@ -747,6 +757,7 @@ namespace MyGUI
 
 	UString::code_point& UString::at( size_type loc )
 	{
+		_dataExposed();
 		return mData.at( loc );
 	}
 
@@ -782,25 +793,27 @@ namespace MyGUI
 		size_t existingSize = _utf16_char_length( existingChar );
 		size_t newSize = _utf16_char_length( ch );
 
+		_dataChanged();
 		if ( newSize > existingSize ) {
-			at( loc ) = cp[0];
+			mData.at( loc ) = cp[0];
 			insert( loc + 1, 1, cp[1] );
 			return 1;
 		}
 		if ( newSize < existingSize ) {
 			erase( loc, 1 );
-			at( loc ) = cp[0];
+			mData.at( loc ) = cp[0];
 			return -1;
 		}
 
 		// newSize == existingSize
-		at( loc ) = cp[0];
-		if ( l == 2 ) at( loc + 1 ) = cp[1];
+		mData.at( loc ) = cp[0];
+		if ( l == 2 ) mData.at( loc + 1 ) = cp[1];
 		return 0;
 	}
 
 	UString::iterator UString::begin()
 	{
+		_dataExposed();
 		iterator i;
 		i.mIter = mData.begin();
 		i.mString = this;
@@ -817,6 +830,7 @@ namespace MyGUI
 
 	UString::iterator UString::end()
 	{
+		_dataExposed();
 		iterator i;
 		i.mIter = mData.end();
 		i.mString = this;
@@ -833,6 +847,7 @@ namespace MyGUI
 
 	UString::reverse_iterator UString::rbegin()
 	{
+		_dataExposed();
 		reverse_iterator i;
 		i.mIter = mData.end();
 		i.mString = this;
@@ -849,6 +864,7 @@ namespace MyGUI
 
 	UString::reverse_iterator UString::rend()
 	{
+		_dataExposed();
 		reverse_iterator i;
 		i.mIter = mData.begin();
 		i.mString = this;
@@ -865,42 +881,54 @@ namespace MyGUI
 
 	UString& UString::assign( iterator start, iterator end )
 	{
+		_dataReplaced();
 		mData.assign( start.mIter, end.mIter );
 		return *this;
 	}
 
 	UString& UString::assign( const UString& str )
 	{
+		if ( &str == this )
+			return *this;
+
+		_dataReplaced();
 		mData.assign( str.mData );
+		if ( str.m_bufferUTF8Valid )
+			_storeUTF8( str.m_buffer.mStrBuffer->data(), str.m_buffer.mStrBuffer->size() );
 		return *this;
 	}
 
 	UString& UString::assign( const code_point* str )
 	{
+		_dataReplaced();
 		mData.assign( str );
 		return *this;
 	}
 
 	UString& UString::assign( const code_point* str, size_type num )
 	{
+		_dataReplaced();
 		mData.assign( str, num );
 		return *this;
 	}
 
 	UString& UString::assign( const UString& str, size_type index, size_type len )
 	{
+		_dataReplaced();
 		mData.assign( str.mData, index, len );
 		return *this;
 	}
 
 	UString& UString::assign( size_type num, const code_point& ch )
 	{
+		_dataReplaced();
 		mData.assign( num, ch );
 		return *this;
 	}
 
 	UString& UString::assign( const std::wstring& wstr )
 	{
+		_dataReplaced();
 		mData.clear();
 		mData.reserve( wstr.length() ); // best guess bulk allocate
 #ifdef WCHAR_UTF16 // if we're already working in UTF-16, this is easy
@@ -942,6 +970,14 @@ namespace MyGUI
 
 	UString& UString::assign( const std::string& str )
 	{
+		_dataReplaced();
+		// plain ASCII maps one to one to UTF-16
+		if ( _isASCII( str.data(), str.size() ) ) {
+			mData.assign( str.begin(), str.end() );
+			_storeUTF8( str.data(), str.size() );
+			return *this;
+		}
+
 		size_type len = _verifyUTF8( str );
 		clear(); // empty our contents, if there are any
 		reserve( len ); // best guess bulk capacity growth
@@ -970,17 +1006,25 @@ namespace MyGUI
 			utf16len = _utf32_to_utf16( uc, utf16buff ); // UTF-32 -> UTF-16 conversion
 			append( utf16buff, utf16len ); // append the characters to the string
 		}
+		_storeUTF8( str.data(), str.size() ); // keep the source, asUTF8() won't convert it back
 		return *this;
 	}
 
 	UString& UString::assign( const char* c_str )
 	{
-		std::string tmp( c_str );
-		return assign( tmp );
+		return assign( c_str, strlen( c_str ) );
 	}
 
 	UString& UString::assign( const char* c_str, size_type num )
 	{
+		_dataReplaced();
+		// plain ASCII maps one to one to UTF-16, no temporary string needed
+		if ( _isASCII( c_str, num ) ) {
+			mData.assign( c_str, c_str + num );
+			_storeUTF8( c_str, num );
+			return *this;
+		}
+
 		std::string tmp;
 		tmp.assign( c_str, num );
 		return assign( tmp );
@@ -988,36 +1032,42 @@ namespace MyGUI
 
 	UString& UString::append( const UString& str )
 	{
+		_dataChanged();
 		mData.append( str.mData );
 		return *this;
 	}
 
 	UString& UString::append( const code_point* str )
 	{
+		_dataChanged();
 		mData.append( str );
 		return *this;
 	}
 
 	UString& UString::append( const UString& str, size_type index, size_type len )
 	{
+		_dataChanged();
 		mData.append( str.mData, index, len );
 		return *this;
 	}
 
 	UString& UString::append( const code_point* str, size_type num )
 	{
+		_dataChanged();
 		mData.append( str, num );
 		return *this;
 	}
 
 	UString& UString::append( size_type num, code_point ch )
 	{
+		_dataChanged();
 		mData.append( num, ch );
 		return *this;
 	}
 
 	UString& UString::append( iterator start, iterator end )
 	{
+		_dataChanged();
 		mData.append( start.mIter, end.mIter );
 		return *this;
 	}
@@ -1065,6 +1115,7 @@ namespace MyGUI
 
 	UString::iterator UString::insert( iterator i, const code_point& ch )
 	{
+		_dataExposed();
 		iterator ret;
 		ret.mIter = mData.insert( i.mIter, ch );
 		ret.mString = this;
@@ -1073,23 +1124,27 @@ namespace MyGUI
 
 	UString& UString::insert( size_type index, const UString& str )
 	{
+		_dataChanged();
 		mData.insert( index, str.mData );
 		return *this;
 	}
 
 	UString& UString::insert( size_type index1, const UString& str, size_type index2, size_type num )
 	{
+		_dataChanged();
 		mData.insert( index1, str.mData, index2, num );
 		return *this;
 	}
 
 	void UString::insert( iterator i, iterator start, iterator end )
 	{
+		_dataChanged();
 		mData.insert( i.mIter, start.mIter, end.mIter );
 	}
 
 	UString& UString::insert( size_type index, const code_point* str, size_type num )
 	{
+		_dataChanged();
 		mData.insert( index, str, num );
 		return *this;
 	}
@@ -1112,6 +1167,7 @@ namespace MyGUI
 
 	UString& UString::insert( size_type index, size_type num, code_point ch )
 	{
+		_dataChanged();
 		mData.insert( index, num, ch );
 		return *this;
 	}
@@ -1147,6 +1203,7 @@ namespace MyGUI
 
 	void UString::insert( iterator i, size_type num, const code_point& ch )
 	{
+		_dataChanged();
 		mData.insert( i.mIter, num, ch );
 	}
 #if MYGUI_IS_NATIVE_WCHAR_T
@@ -1178,6 +1235,7 @@ namespace MyGUI
 
 	UString::iterator UString::erase( iterator loc )
 	{
+		_dataExposed();
 		iterator ret;
 		ret.mIter = mData.erase( loc.mIter );
 		ret.mString = this;
@@ -1186,6 +1244,7 @@ namespace MyGUI
 
 	UString::iterator UString::erase( iterator start, iterator end )
 	{
+		_dataExposed();
 		iterator ret;
 		ret.mIter = mData.erase( start.mIter, end.mIter );
 		ret.mString = this;
@@ -1194,6 +1253,7 @@ namespace MyGUI
 
 	UString& UString::erase( size_type index /*= 0*/, size_type num /*= npos */ )
 	{
+		_dataChanged();
 		if ( num == npos )
 			mData.erase( index );
 		else
@@ -1203,18 +1263,21 @@ namespace MyGUI
 
 	UString& UString::replace( size_type index1, size_type num1, const UString& str )
 	{
+		_dataChanged();
 		mData.replace( index1, num1, str.mData, 0, npos );
 		return *this;
 	}
 
 	UString& UString::replace( size_type index1, size_type num1, const UString& str, size_type num2 )
 	{
+		_dataChanged();
 		mData.replace( index1, num1, str.mData, 0, num2 );
 		return *this;
 	}
 
 	UString& UString::replace( size_type index1, size_type num1, const UString& str, size_type index2, size_type num2 )
 	{
+		_dataChanged();
 		mData.replace( index1, num1, str.mData, index2, num2 );
 		return *this;
 	}
@@ -1230,6 +1293,7 @@ namespace MyGUI
 
 	UString& UString::replace( size_type index, size_type num1, size_type num2, code_point ch )
 	{
+		_dataChanged();
 		mData.replace( index, num1, num2, ch );
 		return *this;
 	}
@@ -1932,10 +1996,42 @@ namespace MyGUI
 		m_buffer.mVoidBuffer = 0;
 		m_bufferType = bt_none;
 		m_bufferSize = 0;
+		m_bufferUTF8Valid = false;
+		m_dataExposed = false;
+	}
+
+	void UString::_dataChanged()
+	{
+		m_bufferUTF8Valid = false;
+	}
+
+	void UString::_dataReplaced()
+	{
+		m_bufferUTF8Valid = false;
+		m_dataExposed = false;
+	}
+
+	void UString::_dataExposed()
+	{
+		m_bufferUTF8Valid = false;
+		m_dataExposed = true;
+	}
+
+	void UString::_storeUTF8( const char* c_str, size_type num ) const
+	{
+		// no _getBufferStr() here, c_str may point into the buffer itself
+		if ( m_bufferType != bt_string ) {
+			_cleanBuffer();
+			m_buffer.mStrBuffer = new std::string();
+			m_bufferType = bt_string;
+		}
+		m_buffer.mStrBuffer->assign( c_str, num );
+		m_bufferUTF8Valid = !m_dataExposed;
 	}
 
 	void UString::_cleanBuffer() const
 	{
+		m_bufferUTF8Valid = false;
 		if ( m_buffer.mVoidBuffer != 0 ) {
 			switch ( m_bufferType ) {
 				case bt_string:
@@ -1993,8 +2089,18 @@ namespace MyGUI
 
 	void UString::_load_buffer_UTF8() const
 	{
+		if ( m_bufferUTF8Valid )
+			return;
+
 		_getBufferStr();
 		std::string& buffer = ( *m_buffer.mStrBuffer );
+		m_bufferUTF8Valid = !m_dataExposed;
+
+		if ( _isASCII() ) {
+			buffer.assign( mData.begin(), mData.end() );
+			return;
+		}
+
 		buffer.reserve( length() );
 
 		unsigned char utf8buf[6];
@@ -2016,13 +2122,15 @@ namespace MyGUI
 	{
 		_getBufferWStr();
 		std::wstring& buffer = ( *m_buffer.mWStrBuffer );
-		buffer.reserve( length() ); // may over reserve, but should be close enough
 #ifdef WCHAR_UTF16 // wchar_t matches UTF-16
-		const_iterator i, ie = end();
-		for ( i = begin(); i != ie; ++i ) {
-			buffer.push_back(( wchar_t )( *i ) );
-		}
+		buffer.assign( mData.begin(), mData.end() );
 #else // wchar_t fits UTF-32
+		if ( !_hasSurrogates() ) {
+			buffer.assign( mData.begin(), mData.end() );
+			return;
+		}
+
+		buffer.reserve( length() ); // may over reserve, but should be close enough
 		unicode_char c;
 		const_iterator i, ie = end();
 		for ( i = begin(); i != ie; i.moveNext() ) {
@@ -2036,6 +2144,12 @@ namespace MyGUI
 	{
 		_getBufferUTF32Str();
 		utf32string& buffer = ( *m_buffer.mUTF32StrBuffer );
+
+		if ( !_hasSurrogates() ) {
+			buffer.assign( mData.begin(), mData.end() );
+			return;
+		}
+
 		buffer.reserve( length() ); // may over reserve, but should be close enough
 
 		unicode_char c;
@@ -2047,4 +2161,33 @@ namespace MyGUI
 		}
 	}
 
+	bool UString::_isASCII( const char* c_str, size_type num )
+	{
+		for ( size_type i = 0; i < num; ++i ) {
+			if ( static_cast<unsigned char>( c_str[i] ) & 0x80 )
+				return false;
+		}
+		return true;
+	}
+
+	bool UString::_isASCII() const
+	{
+		dstring::const_iterator i, ie = mData.end();
+		for ( i = mData.begin(); i != ie; ++i ) {
+			if ( *i & ~0x007F )
+				return false;
+		}
+		return true;
+	}
+
+	bool UString::_hasSurrogates() const
+	{
+		dstring::const_iterator i, ie = mData.end();
+		for ( i = mData.begin(); i != ie; ++i ) {
+			if ( !_utf16_independent_char( *i ) )
+				return true;
+		}
+		return false;
+	}
+
 } // namespace MyGUI
@@ -0,0 +1,152 @@
+/*!
+	@file
+	@date		10/2026
+*/
+/*
+	This file is part of MyGUI.
+
+	MyGUI is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Lesser General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	MyGUI is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public License
+	along with MyGUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_VertexUtility.h"
+
+#if defined(MYGUI_USE_SSE2) && !defined(MYGUI_RENDER_UE)
+#	include <emmintrin.h>
+#	define MYGUI_VERTEX_UTILITY_SSE
+#endif
+
+namespace MyGUI
+{
+
+	namespace vertex_utility
+	{
+
+		namespace
+		{
+
+			MYGUI_FORCEINLINE void setVertex(Vertex& _vertex, float _x, float _y, float _z, float _u, float _v, uint32 _colour)
+			{
+				_vertex.x = _x;
+				_vertex.y = _y;
+				_vertex.z = _z;
+				_vertex.colour = _colour;
+				_vertex.u = _u;
+				_vertex.v = _v;
+			}
+
+			void writeQuadsScalar(Vertex* _vertex, const QuadInfo* _quads, size_t _count, float _z, const QuadTransform& _transform)
+			{
+				for (size_t index = 0; index < _count; ++index)
+				{
+					const QuadInfo& quad = _quads[index];
+					float left = quad.vertex.left * _transform.scaleX + _transform.offsetX;
+					float top = quad.vertex.top * _transform.scaleY + _transform.offsetY;
+					float right = quad.vertex.right * _transform.scaleX + _transform.offsetX;
+					float bottom = quad.vertex.bottom * _transform.scaleY + _transform.offsetY;
+					const FloatRect& texture = quad.texture;
+
+					setVertex(_vertex[VertexQuad::CornerLT], left, top, _z, texture.left, texture.top, quad.colour);
+					setVertex(_vertex[VertexQuad::CornerRB], right, bottom, _z, texture.right, texture.bottom, quad.colour);
+#ifndef MYGUI_RENDER_UE
+					setVertex(_vertex[VertexQuad::CornerRT], right, top, _z, texture.right, texture.top, quad.colour);
+					setVertex(_vertex[VertexQuad::CornerLB], left, bottom, _z, texture.left, texture.bottom, quad.colour);
+					_vertex[VertexQuad::CornerRT2] = _vertex[VertexQuad::CornerRT];
+					_vertex[VertexQuad::CornerLB2] = _vertex[VertexQuad::CornerLB];
+#endif
+					_vertex += VertexQuad::VertexCount;
+				}
+			}
+
+#ifdef MYGUI_VERTEX_UTILITY_SSE
+			// verticies LT, RT, LB, LB2, RT2, RB are six floats each, two verticies are written with three stores
+			void writeQuadsSSE(Vertex* _vertex, const QuadInfo* _quads, size_t _count, float _z, const QuadTransform& _transform)
+			{
+				const __m128 scale = _mm_setr_ps(_transform.scaleX, _transform.scaleY, _transform.scaleX, _transform.scaleY);
+				const __m128 offset = _mm_setr_ps(_transform.offsetX, _transform.offsetY, _transform.offsetX, _transform.offsetY);
+				const __m128 depth = _mm_set1_ps(_z);
+
+				float* dest = &_vertex->x;
+				for (size_t index = 0; index < _count; ++index)
+				{
+					const QuadInfo& quad = _quads[index];
+
+					// left, top, right, bottom
+					__m128 position = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&quad.vertex.left), scale), offset);
+					__m128 texture = _mm_loadu_ps(&quad.texture.left);
+
+					// colour bits never pass through float registers, x87 could change NaN patterns
+					const __m128 colour = _mm_castsi128_ps(_mm_set1_epi32((int)quad.colour));
+					const __m128 zc = _mm_unpacklo_ps(depth, colour);
+
+					const __m128 positionRT = _mm_shuffle_ps(position, position, _MM_SHUFFLE(3, 3, 1, 2));
+					const __m128 positionLB = _mm_shuffle_ps(position, position, _MM_SHUFFLE(3, 3, 3, 0));
+					const __m128 positionRB = _mm_movehl_ps(position, position);
+					const __m128 textureRT = _mm_shuffle_ps(texture, texture, _MM_SHUFFLE(3, 3, 1, 2));
+					const __m128 textureLB = _mm_shuffle_ps(texture, texture, _MM_SHUFFLE(3, 3, 3, 0));
+					const __m128 textureRB = _mm_movehl_ps(texture, texture);
+
+					// LT, RT
+					_mm_storeu_ps(dest, _mm_movelh_ps(position, zc));
+					_mm_storeu_ps(dest + 4, _mm_movelh_ps(texture, positionRT));
+					_mm_storeu_ps(dest + 8, _mm_movelh_ps(zc, textureRT));
+
+					// LB, LB2
+					_mm_storeu_ps(dest + 12, _mm_movelh_ps(positionLB, zc));
+					_mm_storeu_ps(dest + 16, _mm_movelh_ps(textureLB, positionLB));
+					_mm_storeu_ps(dest + 20, _mm_movelh_ps(zc, textureLB));
+
+					// RT2, RB
+					_mm_storeu_ps(dest + 24, _mm_movelh_ps(positionRT, zc));
+					_mm_storeu_ps(dest + 28, _mm_movelh_ps(textureRT, positionRB));
+					_mm_storeu_ps(dest + 32, _mm_movelh_ps(zc, textureRB));
+
+					dest += 36;
+				}
+			}
+#endif
+
+		} // namespace
+
+		QuadTransform::QuadTransform(const RenderTargetInfo& _info, float _left, float _top)
+		{
+#ifdef MYGUI_RENDER_UE
+			scaleX = 1;
+			scaleY = 1;
+			offsetX = _left;
+			offsetY = _top;
+#else
+			scaleX = _info.pixScaleX * 2.0f;
+			scaleY = -_info.pixScaleY * 2.0f;
+			offsetX = (_info.pixScaleX * _left + _info.hOffset) * 2.0f - 1.0f;
+			offsetY = 1.0f - (_info.pixScaleY * _top + _info.vOffset) * 2.0f;
+#endif
+		}
+
+		void writeQuads(Vertex* _vertex, const QuadInfo* _quads, size_t _count, float _z, const QuadTransform& _transform)
+		{
+#ifdef MYGUI_VERTEX_UTILITY_SSE
+			// layout of verticies is known only for the standard vertex
+			if (sizeof(Vertex) == sizeof(float) * 6 && VertexQuad::CornerLT == 0 && VertexQuad::CornerRT == 1 && VertexQuad::CornerLB == 2 &&
+				VertexQuad::CornerLB2 == 3 && VertexQuad::CornerRT2 == 4 && VertexQuad::CornerRB == 5)
+			{
+				writeQuadsSSE(_vertex, _quads, _count, _z, _transform);
+				return;
+			}
+#endif
+			writeQuadsScalar(_vertex, _quads, _count, _z, _transform);
+		}
+
+	} // namespace vertex_utility
+
+} // namespace MyGUI
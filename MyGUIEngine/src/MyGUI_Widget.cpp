@@ -30,6 +30,8 @@
 #include "MyGUI_WidgetDefines.h"
 #include "MyGUI_LayerItem.h"
 #include "MyGUI_LayerManager.h"
+#include "MyGUI_LayerNode.h"
+#include "MyGUI_OverlappedLayer.h"
 #include "MyGUI_RenderItem.h"
 #include "MyGUI_ISubWidget.h"
 #include "MyGUI_ISubWidgetText.h"
@@ -57,6 +59,11 @@ namespace MyGUI
 		mContainer(nullptr),
 		mAlign(Align::Default),
 		mVisible(true),
+		mIsCulled(false),
+		mIsCulledPositionDirty(false),
+		mLayoutDirty(false),
+		mLayoutQueued(false),
+		mCacheToTexture(false),
 		mHandler(nullptr),
         mInheritsDrag(false),
 		mDragEffectWidget(nullptr),
@@ -145,6 +152,12 @@ namespace MyGUI
 
 	void Widget::_shutdown()
 	{
+		if (mLayoutQueued)
+		{
+			WidgetManager::getInstance()._removeLayoutWidget(this);
+			mLayoutQueued = false;
+		}
+
 		// витр метод для наследников
 		shutdownOverride();
 
@@ -187,6 +200,9 @@ namespace MyGUI
 		shutdownWidgetSkinBase();
 		const WidgetInfo* root = initialiseWidgetSkinBase(skinInfo, templateInfo);
 
+		// new subskins and skin children are visible, next _updateView decides again
+		_uncullView();
+
 		restoreLayerItem();
 
 		initialiseOverride();
@@ -353,17 +369,9 @@ namespace MyGUI
 			// проверка на полный выход за границу
 			if (_checkOutside())
 			{
-				// запоминаем текущее состояние
-				mIsMargin = margin;
-
-				// скрываем
-				_setSubSkinVisible(false);
-
-				// вся иерархия должна быть проверенна
-				for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
-					(*widget)->_updateView();
-				for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
-					(*widget)->_updateView();
+				// subtree was hidden when it left the view and stays hidden while outside
+				if (!mIsCulled)
+					_cullView();
 
 				return;
 			}
@@ -379,6 +387,8 @@ namespace MyGUI
 		// запоминаем текущее состояние
 		mIsMargin = margin;
 
+		_uncullView();
+
 		// если скин был скрыт, то покажем
 		_setSubSkinVisible(true);
 
@@ -391,6 +401,52 @@ namespace MyGUI
 		_updateSkinItemView();
 	}
 
+	void Widget::_cullView()
+	{
+		mIsCulled = true;
+
+		// children compare their margins with ours, so full update is needed when we are back
+		mIsMargin = true;
+
+		_setSubSkinVisible(false);
+
+		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
+		{
+			if (!(*widget)->mIsCulled)
+				(*widget)->_cullView();
+		}
+		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
+		{
+			if (!(*widget)->mIsCulled)
+				(*widget)->_cullView();
+		}
+	}
+
+	void Widget::_uncullView()
+	{
+		if (!mIsCulled)
+			return;
+		mIsCulled = false;
+
+		// positions of the subtree were not followed while it was hidden
+		if (mIsCulledPositionDirty)
+		{
+			mIsCulledPositionDirty = false;
+
+			for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
+				(*widget)->_updateAbsolutePoint();
+			for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
+				(*widget)->_updateAbsolutePoint();
+
+			_correctSkinItemView();
+		}
+	}
+
+	bool Widget::_isCulled() const
+	{
+		return mIsCulled;
+	}
+
 	bool Widget::_setWidgetState(const std::string& _state)
 	{
 		return _setSkinItemState(_state);
@@ -525,6 +581,13 @@ namespace MyGUI
 
 		mAbsolutePosition = mCroppedParent->getAbsolutePosition() + mCoord.point();
 
+		// hidden subtree is updated when it is back in the view
+		if (mIsCulled)
+		{
+			mIsCulledPositionDirty = true;
+			return;
+		}
+
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
 			(*widget)->_updateAbsolutePoint();
 		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
@@ -645,13 +708,35 @@ namespace MyGUI
 
 	void Widget::setPosition(const IntPoint& _point)
 	{
+		if (_deferLayout())
+		{
+			mAbsolutePosition += _point - mCoord.point();
+			mCoord = _point;
+			return;
+		}
+
+		// postponed resize has to align children, parent moves us here without knowing about it
+		if (mLayoutDirty && mLayoutOldCoord.size() != mCoord.size())
+		{
+			setCoord(IntCoord(_point, mCoord.size()));
+			return;
+		}
+		mLayoutDirty = false;
+
 		// обновляем абсолютные координаты
 		mAbsolutePosition += _point - mCoord.point();
 
-		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
-			(*widget)->_updateAbsolutePoint();
-		for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
-			(*widget)->_updateAbsolutePoint();
+		if (mIsCulled)
+		{
+			mIsCulledPositionDirty = true;
+		}
+		else
+		{
+			for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
+				(*widget)->_updateAbsolutePoint();
+			for (VectorWidgetPtr::iterator widget = mWidgetChildSkin.begin(); widget != mWidgetChildSkin.end(); ++widget)
+				(*widget)->_updateAbsolutePoint();
+		}
 
 		mCoord = _point;
 
@@ -662,8 +747,14 @@ namespace MyGUI
 
 	void Widget::setSize(const IntSize& _size)
 	{
+		if (_deferLayout())
+		{
+			mCoord = _size;
+			return;
+		}
+
 		// устанавливаем новую координату а старую пускаем в расчеты
-		IntSize old = mCoord.size();
+		IntSize old = _takeLayoutOldCoord().size();
 		mCoord = _size;
 
 		bool visible = true;
@@ -683,6 +774,9 @@ namespace MyGUI
 
 		_setSubSkinVisible(visible);
 
+		// children are checked by alignment below, subtree is culled again by next _updateView
+		_uncullView();
+
 		// передаем старую координату , до вызова, текущая координата отца должна быть новой
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
 			(*widget)->_setAlign(old, getSize());
@@ -699,6 +793,13 @@ namespace MyGUI
 
 	void Widget::setCoord(const IntCoord& _coord)
 	{
+		if (_deferLayout())
+		{
+			mAbsolutePosition += _coord.point() - mCoord.point();
+			mCoord = _coord;
+			return;
+		}
+
 		// обновляем абсолютные координаты
 		mAbsolutePosition += _coord.point() - mCoord.point();
 
@@ -708,7 +809,7 @@ namespace MyGUI
 			(*widget)->_updateAbsolutePoint();
 
 		// устанавливаем новую координату а старую пускаем в расчеты
-		IntCoord old = mCoord;
+		IntCoord old = _takeLayoutOldCoord();
 		mCoord = _coord;
 
 		bool visible = true;
@@ -728,6 +829,9 @@ namespace MyGUI
 
 		_setSubSkinVisible(visible);
 
+		// children are checked by alignment below, subtree is culled again by next _updateView
+		_uncullView();
+
 		// передаем старую координату , до вызова, текущая координата отца должна быть новой
 		for (VectorWidgetPtr::iterator widget = mWidgetChild.begin(); widget != mWidgetChild.end(); ++widget)
 			(*widget)->_setAlign(old.size(), getSize());
@@ -742,6 +846,58 @@ namespace MyGUI
 		eventChangeCoord(this);
 	}
 
+	bool Widget::_deferLayout()
+	{
+		WidgetManager& manager = WidgetManager::getInstance();
+		if (!manager._isLayoutDeferred())
+			return false;
+
+		if (!mLayoutDirty)
+		{
+			mLayoutDirty = true;
+			mLayoutOldCoord = mCoord;
+		}
+
+		if (!mLayoutQueued)
+		{
+			mLayoutQueued = true;
+			manager._addLayoutWidget(this);
+		}
+
+		return true;
+	}
+
+	IntCoord Widget::_takeLayoutOldCoord()
+	{
+		if (!mLayoutDirty)
+			return mCoord;
+
+		mLayoutDirty = false;
+		return mLayoutOldCoord;
+	}
+
+	void Widget::_updateLayout()
+	{
+		// removed from the queue while it was processed
+		if (!mLayoutQueued)
+			return;
+		mLayoutQueued = false;
+
+		// already aligned by parent
+		if (!mLayoutDirty)
+			return;
+
+		if (mLayoutOldCoord.size() == mCoord.size())
+			setPosition(mCoord.point());
+		else
+			setCoord(mCoord);
+	}
+
+	bool Widget::_isLayoutDirty() const
+	{
+		return mLayoutDirty;
+	}
+
 	void Widget::setAlign(Align _value)
 	{
 		mAlign = _value;
@@ -1202,6 +1358,10 @@ namespace MyGUI
 		else if (_key == "InheritsAlpha")
 			setInheritsAlpha(utility::parseValue<bool>(_value));
 
+		/// @wproperty{Widget, CacheToTexture, bool} Render widget with children to texture while nothing changes.
+		else if (_key == "CacheToTexture")
+			setCacheToTexture(utility::parseValue<bool>(_value));
+
 		/// @wproperty{Widget, InheritsPick, bool} Режим наследования доступности мышью.
 		else if (_key == "InheritsPick")
 			setInheritsPick(utility::parseValue<bool>(_value));
@@ -1315,6 +1475,40 @@ namespace MyGUI
 		return mInheritsAlpha;
 	}
 
+	void Widget::setCacheToTexture(bool _value)
+	{
+		if (mCacheToTexture == _value)
+			return;
+
+		if (_value && !isRootWidget())
+			MYGUI_LOG(Warning, "Widget '" << getName() << "' is not root widget, cache to texture is ignored");
+
+		mCacheToTexture = _value;
+		_updateCacheToTexture();
+	}
+
+	bool Widget::getCacheToTexture() const
+	{
+		return mCacheToTexture;
+	}
+
+	void Widget::attachItemToNode(ILayer* _layer, ILayerNode* _node)
+	{
+		LayerItem::attachItemToNode(_layer, _node);
+		_updateCacheToTexture();
+	}
+
+	void Widget::_updateCacheToTexture()
+	{
+		// node of shared layer is common for all root widgets
+		if (!isRootWidget() || getLayerNode() == nullptr || !getLayer()->isType<OverlappedLayer>())
+			return;
+
+		LayerNode* node = getLayerNode()->castType<LayerNode>(false);
+		if (node != nullptr)
+			node->setCacheToTexture(mCacheToTexture);
+	}
+
 	bool Widget::isRootWidget() const
 	{
 		return nullptr == mCroppedParent;
@@ -60,7 +60,9 @@ namespace MyGUI
 
 	WidgetManager::WidgetManager() :
 		mIsInitialise(false),
-		mCategoryName("Widget")
+		mCategoryName("Widget"),
+		mDeferredLayout(false),
+		mLayoutUpdating(false)
 	{
 	}
 
@@ -98,8 +100,6 @@ namespace MyGUI
 
 		BackwardCompatibility::registerWidgetTypes();
 
-		Gui::getInstance().eventFrameStart += newDelegate(this, &WidgetManager::notifyEventFrameStart);
-
 		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
 		mIsInitialise = true;
 	}
@@ -109,9 +109,11 @@ namespace MyGUI
 		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
 		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
 
-		Gui::getInstance().eventFrameStart -= newDelegate(this, &WidgetManager::notifyEventFrameStart);
 		_deleteDelayWidgets();
 
+		mLayoutWidgets.clear();
+		mDeferredLayout = false;
+
 		mVectorIUnlinkWidget.clear();
 
 		FactoryManager::getInstance().unregisterFactory(mCategoryName);
@@ -187,6 +189,11 @@ namespace MyGUI
 		_deleteDelayWidgets();
 	}
 
+	float WidgetManager::_getNextFrameDelay() const
+	{
+		return (mDestroyWidgets.empty() && mLayoutWidgets.empty()) ? -1.0f : 0.0f;
+	}
+
 	void WidgetManager::_deleteWidget(Widget* _widget)
 	{
 		_widget->_shutdown();
@@ -216,4 +223,77 @@ namespace MyGUI
 		return mCategoryName;
 	}
 
+	void WidgetManager::setDeferredLayout(bool _value)
+	{
+		if (mDeferredLayout == _value)
+			return;
+
+		mDeferredLayout = _value;
+		if (!mDeferredLayout)
+			_updateLayout();
+	}
+
+	bool WidgetManager::getDeferredLayout() const
+	{
+		return mDeferredLayout;
+	}
+
+	namespace
+	{
+
+		typedef std::pair<size_t, Widget*> PairDepthWidget;
+
+		struct LessDepth
+		{
+			bool operator()(const PairDepthWidget& _left, const PairDepthWidget& _right) const
+			{
+				return _left.first < _right.first;
+			}
+		};
+
+	} // namespace
+
+	void WidgetManager::_updateLayout()
+	{
+		if (mLayoutWidgets.empty())
+			return;
+
+		// parents align their children, so children changed too are already done when their turn comes
+		vector<PairDepthWidget>::type widgets;
+		widgets.reserve(mLayoutWidgets.size());
+		for (VectorWidgetPtr::iterator item = mLayoutWidgets.begin(); item != mLayoutWidgets.end(); ++item)
+		{
+			size_t depth = 0;
+			for (Widget* parent = (*item)->getParent(); parent != nullptr; parent = parent->getParent())
+				depth ++;
+			widgets.push_back(PairDepthWidget(depth, *item));
+		}
+		mLayoutWidgets.clear();
+
+		std::stable_sort(widgets.begin(), widgets.end(), LessDepth());
+
+		// changes made by eventChangeCoord handlers are applied immediately
+		mLayoutUpdating = true;
+		for (vector<PairDepthWidget>::type::iterator item = widgets.begin(); item != widgets.end(); ++item)
+			item->second->_updateLayout();
+		mLayoutUpdating = false;
+	}
+
+	bool WidgetManager::_isLayoutDeferred() const
+	{
+		return mDeferredLayout && !mLayoutUpdating;
+	}
+
+	void WidgetManager::_addLayoutWidget(Widget* _widget)
+	{
+		mLayoutWidgets.push_back(_widget);
+	}
+
+	void WidgetManager::_removeLayoutWidget(Widget* _widget)
+	{
+		VectorWidgetPtr::iterator item = std::find(mLayoutWidgets.begin(), mLayoutWidgets.end(), _widget);
+		if (item != mLayoutWidgets.end())
+			mLayoutWidgets.erase(item);
+	}
+
 } // namespace MyGUI
@@ -519,30 +519,36 @@ namespace MyGUI
 			// текущий узел для разбора
 			ElementPtr currentNode = 0;
 
-			while (!_stream->eof())
-			{
-				// берем новую строку
-				_stream->readline(read, '\n');
-				if (read.empty())
-					continue;
-				if (read[read.size() - 1] == '\r')
-					read.erase(read.size() - 1, 1);
-				if (read.empty())
-					continue;
-
-				mLine ++;
-				mCol = 0; // потом проверить на многострочных тэгах
-				if (read.empty())
-					continue;
-				// текущая строка для разбора и то что еще прочитали
-				line += read;
-
-				if (!parseLine(line, currentNode))
+			const unsigned char* data = _stream->data();
+			if (data != nullptr)
+			{
+				// поток целиком в памяти, режем строки без копирования через потоки
+				const char* current = (const char*)data;
+				const char* end = current + _stream->size();
+				while (current != end)
 				{
-					return false;
+					const char* next = (const char*)::memchr(current, '\n', end - current);
+					if (next == nullptr)
+						next = end;
+
+					read.assign(current, next);
+					current = next == end ? end : next + 1;
+
+					if (!parseReadLine(read, line, currentNode))
+						return false;
 				}
+			}
+			else
+			{
+				while (!_stream->eof())
+				{
+					// берем новую строку
+					_stream->readline(read, '\n');
 
-			} // while (!stream.eof())
+					if (!parseReadLine(read, line, currentNode))
+						return false;
+				}
+			}
 
 			if (currentNode)
 			{
@@ -553,6 +559,24 @@ namespace MyGUI
 			return true;
 		}
 
+		bool Document::parseReadLine(std::string& _read, std::string& _line, ElementPtr& _element)
+		{
+			if (_read.empty())
+				return true;
+			if (_read[_read.size() - 1] == '\r')
+				_read.erase(_read.size() - 1, 1);
+			if (_read.empty())
+				return true;
+
+			mLine ++;
+			mCol = 0; // потом проверить на многострочных тэгах
+
+			// текущая строка для разбора и то что еще прочитали
+			_line += _read;
+
+			return parseLine(_line, _element);
+		}
+
 		bool Document::save(std::ostream& _stream)
 		{
 			if (!mDeclaration)
@@ -86,6 +86,7 @@ namespace MyGUI
 
 	private:
 		void destroyAllResources();
+		void setDistanceFieldStages(bool _enable);
 
 	private:
 		IDirect3DDevice9* mpD3DDevice;
@@ -93,6 +94,7 @@ namespace MyGUI
 		VertexColourType mVertexFormat;
 		RenderTargetInfo mInfo;
 		bool mUpdate;
+		bool mDistanceField;
 
 		typedef std::map<std::string, ITexture*> MapTexture;
 		MapTexture mTextures;
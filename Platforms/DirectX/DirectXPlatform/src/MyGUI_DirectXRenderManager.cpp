@@ -18,7 +18,8 @@ namespace MyGUI
 	DirectXRenderManager::DirectXRenderManager() :
 		mIsInitialise(false),
 		mpD3DDevice(nullptr),
-		mUpdate(false)
+		mUpdate(false),
+		mDistanceField(false)
 	{
 	}
 
@@ -80,6 +81,10 @@ namespace MyGUI
 	void DirectXRenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
 		DirectXTexture* dxTex = static_cast<DirectXTexture*>(_texture);
+		bool distanceField = dxTex != nullptr && dxTex->getUsage().isValue(TextureUsage::DistanceField);
+		if (distanceField != mDistanceField)
+			setDistanceFieldStages(distanceField);
+
 		mpD3DDevice->SetTexture(0, dxTex->getDirectXTexture());
 		DirectXVertexBuffer* dxVB = static_cast<DirectXVertexBuffer*>(_buffer);
 		dxVB->setToStream(0);
@@ -140,6 +145,8 @@ namespace MyGUI
 
 		mpD3DDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);
 
+		setDistanceFieldStages(false);
+
 		mpD3DDevice->SetFVF(D3DFVF_XYZ | D3DFVF_DIFFUSE | D3DFVF_TEX1);
 
 		D3DXMATRIX m;
@@ -153,6 +160,45 @@ namespace MyGUI
 	{
 	}
 
+	void DirectXRenderManager::setDistanceFieldStages(bool _enable)
+	{
+		if (_enable)
+		{
+			// alpha = (4 * field - 1.5) * diffuse, done as 2 * (field + 0.125 - 0.5) doubled in the next stage
+			mpD3DDevice->SetRenderState(D3DRS_TEXTUREFACTOR, 0x20000000);
+
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_ADDSIGNED2X);
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_TFACTOR);
+
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_COLORARG1, D3DTA_CURRENT);
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_ALPHAOP, D3DTOP_ADD);
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_ALPHAARG1, D3DTA_CURRENT);
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_ALPHAARG2, D3DTA_CURRENT);
+
+			mpD3DDevice->SetTextureStageState(2, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+			mpD3DDevice->SetTextureStageState(2, D3DTSS_COLORARG1, D3DTA_CURRENT);
+			mpD3DDevice->SetTextureStageState(2, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+			mpD3DDevice->SetTextureStageState(2, D3DTSS_ALPHAARG1, D3DTA_CURRENT);
+			mpD3DDevice->SetTextureStageState(2, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+
+			mpD3DDevice->SetTextureStageState(3, D3DTSS_COLOROP, D3DTOP_DISABLE);
+			mpD3DDevice->SetTextureStageState(3, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
+		}
+		else
+		{
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+			mpD3DDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+			mpD3DDevice->SetTextureStageState(1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
+		}
+
+		mDistanceField = _enable;
+	}
+
 	ITexture* DirectXRenderManager::createTexture(const std::string& _name)
 	{
 		MapTexture::const_iterator item = mTextures.find(_name);
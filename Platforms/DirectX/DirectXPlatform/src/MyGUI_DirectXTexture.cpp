@@ -101,10 +101,23 @@ namespace MyGUI
 		mPixelFormat = PixelFormat::R8G8B8A8;
 		mNumElemBytes = 4;
 
-		std::string fullname = DirectXDataManager::getInstance().getDataPath(_filename);
+		// read through data manager, so images from packs are found too
+		IDataStream* data = DirectXDataManager::getInstance().getData(_filename);
+		if (data == nullptr)
+			MYGUI_PLATFORM_EXCEPT("Failed to load texture '" << _filename << "': file not found.");
+
+		std::vector<unsigned char> buffer;
+		const unsigned char* memory = data->data();
+		size_t size = data->size();
+		if (memory == nullptr && size != 0)
+		{
+			buffer.resize(size);
+			size = data->read(&buffer[0], size);
+			memory = &buffer[0];
+		}
 
 		D3DXIMAGE_INFO info;
-		D3DXGetImageInfoFromFile(fullname.c_str(), &info);
+		D3DXGetImageInfoFromFileInMemory(memory, (UINT)size, &info);
 
 		if (info.Format == D3DFMT_A8R8G8B8)
 		{
@@ -128,7 +141,9 @@ namespace MyGUI
 		}
 
 		mSize.set(info.Width, info.Height);
-		HRESULT result = D3DXCreateTextureFromFile(mpD3DDevice, fullname.c_str(), &mpTexture);
+		HRESULT result = D3DXCreateTextureFromFileInMemory(mpD3DDevice, memory, (UINT)size, &mpTexture);
+		DirectXDataManager::getInstance().freeData(data);
+
 		if (FAILED(result))
 		{
 			MYGUI_PLATFORM_EXCEPT("Failed to load texture '" << _filename <<
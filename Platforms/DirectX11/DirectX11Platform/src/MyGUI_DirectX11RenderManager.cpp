@@ -46,6 +46,15 @@ namespace MyGUI
 		"}\n"
 	};
 
+	// texture alpha is a signed distance field, see TextureUsage::DistanceField
+	static const char psDistanceFieldSource[] =
+	{
+		"void main( uniform Texture2D<float4> sampleTexture : register(t0), uniform SamplerState sampleSampler : register(s0), in float4 inPosition : SV_POSITION, in float4 inColor : TEXCOORD0, in float2 inTexcoord : TEXCOORD1, out float4 Out : SV_TARGET ) {\n"
+		"	float4 field = sampleTexture.SampleLevel(sampleSampler, inTexcoord, 0);\n"
+		"	Out = float4(field.rgb, saturate(field.a * 4.0f - 1.5f)) * inColor;\n"
+		"}\n"
+	};
+
 	static const D3D11_INPUT_ELEMENT_DESC vertexLayout[] =
 	{
 		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -62,6 +71,7 @@ namespace MyGUI
 		mVertexShader1(nullptr),
 		mPixelShader0(nullptr),
 		mPixelShader1(nullptr),
+		mPixelShader2(nullptr),
 		mSamplerState(nullptr),
 		mDepthStencilState(nullptr),
 		mBlendState(nullptr),
@@ -180,6 +190,18 @@ namespace MyGUI
 		if ( bytecode ) bytecode->Release();
 		if ( errors ) errors->Release();
 
+		// Build Distance Field Pixel Shader
+		bytecode = 0;
+		errors = 0;
+		hr = D3DCompile(psDistanceFieldSource, strlen(psDistanceFieldSource), "PixelShader2", 0, 0, "main", pixelProfile.c_str(), flags, 0, &bytecode, &errors);
+		MYGUI_PLATFORM_ASSERT(hr == S_OK, (errors ? (char*)errors->GetBufferPointer() : "Pixel Shader Compilation failed, unknown errors!"));
+
+		hr = mpD3DDevice->CreatePixelShader(bytecode->GetBufferPointer(), bytecode->GetBufferSize(), 0, &mPixelShader2);
+		MYGUI_PLATFORM_ASSERT(hr == S_OK, (errors ? (char*)errors->GetBufferPointer() : "Pixel Shader Create failed!"));
+
+		if ( bytecode ) bytecode->Release();
+		if ( errors ) errors->Release();
+
 		// Create Sampler State
 		D3D11_SAMPLER_DESC samplerDesc;
 		samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
@@ -266,6 +288,7 @@ namespace MyGUI
 		if ( mVertexShader1 ) mVertexShader1->Release();
 		if ( mPixelShader0 ) mPixelShader0->Release();
 		if ( mPixelShader1 ) mPixelShader1->Release();
+		if ( mPixelShader2 ) mPixelShader2->Release();
 		if ( mSamplerState ) mSamplerState->Release();
 		if ( mBlendState ) mBlendState->Release();
 		if ( mDepthStencilState ) mDepthStencilState->Release();
@@ -304,7 +327,8 @@ namespace MyGUI
 		else
 		{
 			DirectX11VertexBuffer* buffer = static_cast<DirectX11VertexBuffer*>(_buffer);
-			mpD3DContext->PSSetShader(mPixelShader1, 0, 0);
+			bool distanceField = texture->getUsage().isValue(TextureUsage::DistanceField);
+			mpD3DContext->PSSetShader(distanceField ? mPixelShader2 : mPixelShader1, 0, 0);
 			mpD3DContext->VSSetShader(mVertexShader1, 0, 0);
 
 			mpD3DContext->PSSetSamplers(0, 1, &mSamplerState);
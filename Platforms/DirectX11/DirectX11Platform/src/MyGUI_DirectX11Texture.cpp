@@ -74,11 +74,22 @@ namespace MyGUI
 	{
 		destroy();
 
-		std::string fullname = DirectX11DataManager::getInstance().getDataPath(_filename);
-
+		// read through data manager, so images from packs are found too
+		IDataStream* data = DirectX11DataManager::getInstance().getData(_filename);
+		MYGUI_PLATFORM_ASSERT(data != nullptr, "Texture '" << _filename << "' not found!");
+
+		std::vector<unsigned char> buffer;
+		const unsigned char* memory = data->data();
+		size_t size = data->size();
+		if (memory == nullptr && size != 0)
+		{
+			buffer.resize(size);
+			size = data->read(&buffer[0], size);
+			memory = &buffer[0];
+		}
 
 		D3DX11_IMAGE_INFO fileInfo;
-		D3DX11GetImageInfoFromFile( fullname.c_str(), NULL, &fileInfo, NULL );
+		D3DX11GetImageInfoFromMemory( memory, size, NULL, &fileInfo, NULL );
 
 		mWidth = fileInfo.Width;
 		mHeight = fileInfo.Height;
@@ -97,8 +108,9 @@ namespace MyGUI
 		loadInfo.MipFilter      = D3DX11_FILTER_NONE;
 		loadInfo.pSrcInfo       = &fileInfo;
 
-		HRESULT hr = D3DX11CreateTextureFromFileA( mManager->mpD3DDevice, fullname.c_str(), &loadInfo, NULL, (ID3D11Resource**)&mTexture, NULL );
-		MYGUI_PLATFORM_ASSERT(hr == S_OK, "CreateTextureFromFile failed!");
+		HRESULT hr = D3DX11CreateTextureFromMemory( mManager->mpD3DDevice, memory, size, &loadInfo, NULL, (ID3D11Resource**)&mTexture, NULL );
+		DirectX11DataManager::getInstance().freeData(data);
+		MYGUI_PLATFORM_ASSERT(hr == S_OK, "CreateTextureFromMemory failed!");
 
 		D3D11_TEXTURE2D_DESC desc;
 		mTexture->GetDesc(&desc);
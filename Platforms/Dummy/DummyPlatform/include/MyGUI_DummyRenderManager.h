@@ -59,6 +59,8 @@ namespace MyGUI
 
 		/** @see RenderManager::isFormatSupported */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
+		/** @see RenderManager::isPartialRedrawSupported */
+		virtual bool isPartialRedrawSupported() const;
 
 		/** @see IRenderTarget::begin */
 		virtual void begin();
@@ -67,6 +69,8 @@ namespace MyGUI
 
 		/** @see IRenderTarget::doRender */
 		virtual void doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count);
+		/** @see IRenderTarget::doRotatedRender */
+		virtual void doRotatedRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count, float _angle, float _centerX, float _centerY);
 
 		/** @see IRenderTarget::getInfo */
 		virtual const RenderTargetInfo& getInfo()
@@ -78,9 +82,23 @@ namespace MyGUI
 		void drawOneFrame();
 		void setViewSize(int _width, int _height);
 
+		/** Number of doRender calls in the last frame */
+		size_t getBatchCount() const;
+		/** Number of frames skipped because nothing changed, see RenderManager::onPrepareFrame */
+		size_t getSkippedFrameCount() const;
+
+	private:
+		void destroyAllResources();
+
 	private:
 		IntSize mViewSize;
 		RenderTargetInfo mInfo;
+		size_t mCountBatch;
+		size_t mCountSkippedFrame;
+		bool mUpdate;
+
+		typedef std::map<std::string, ITexture*> MapTexture;
+		MapTexture mTextures;
 	};
 
 } // namespace MyGUI
@@ -0,0 +1,58 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+#ifndef __MYGUI_DUMMY_TEXTURE_H__
+#define __MYGUI_DUMMY_TEXTURE_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_ITexture.h"
+#include "MyGUI_RenderFormat.h"
+
+namespace MyGUI
+{
+
+	// Texture in system memory. Files are not decoded, such texture has zero size.
+	class DummyTexture :
+		public ITexture
+	{
+	public:
+		DummyTexture(const std::string& _name);
+		virtual ~DummyTexture();
+
+		virtual const std::string& getName() const;
+
+		virtual void createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format);
+		virtual void loadFromFile(const std::string& _filename);
+		virtual void saveToFile(const std::string& _filename);
+		virtual void loadFromMemory(const void* _memory);
+		virtual void loadFromCodecMemory(const void* _memory, int _len, const std::string& _type);
+
+		virtual void destroy();
+
+		virtual void* lock(TextureUsage _access);
+		virtual void unlock();
+		virtual bool isLocked();
+
+		virtual int getWidth();
+		virtual int getHeight();
+
+		virtual PixelFormat getFormat();
+		virtual TextureUsage getUsage();
+		virtual size_t getNumElemBytes();
+
+	private:
+		std::string mName;
+		int mWidth;
+		int mHeight;
+		TextureUsage mUsage;
+		PixelFormat mFormat;
+		size_t mNumElemBytes;
+		bool mLock;
+		std::vector<unsigned char> mBuffer;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_DUMMY_TEXTURE_H__
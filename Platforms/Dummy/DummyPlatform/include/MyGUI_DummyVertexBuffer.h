@@ -0,0 +1,35 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+#ifndef __MYGUI_DUMMY_VERTEX_BUFFER_H__
+#define __MYGUI_DUMMY_VERTEX_BUFFER_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_IVertexBuffer.h"
+
+namespace MyGUI
+{
+
+	class DummyVertexBuffer :
+		public IVertexBuffer
+	{
+	public:
+		DummyVertexBuffer();
+		virtual ~DummyVertexBuffer();
+
+		virtual void setVertexCount(size_t _count);
+		virtual size_t getVertexCount();
+
+		virtual Vertex* lock();
+		virtual void unlock();
+
+	private:
+		size_t mVertexCount;
+		std::vector<Vertex> mBuffer;
+	};
+
+} // namespace MyGUI
+
+#endif // __MYGUI_DUMMY_VERTEX_BUFFER_H__
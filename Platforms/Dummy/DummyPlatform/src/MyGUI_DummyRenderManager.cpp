@@ -6,13 +6,18 @@
 
 #include "MyGUI_DummyRenderManager.h"
 #include "MyGUI_DummyDiagnostic.h"
+#include "MyGUI_DummyTexture.h"
+#include "MyGUI_DummyVertexBuffer.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_Timer.h"
 
 namespace MyGUI
 {
 
-	DummyRenderManager::DummyRenderManager()
+	DummyRenderManager::DummyRenderManager() :
+		mCountBatch(0),
+		mCountSkippedFrame(0),
+		mUpdate(false)
 	{
 	}
 
@@ -27,20 +32,29 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_LOG(Info, "* Shutdown: " << getClassTypeName());
 
+		destroyAllResources();
+
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully shutdown");
 	}
 
 	IVertexBuffer* DummyRenderManager::createVertexBuffer()
 	{
-		return nullptr;
+		return new DummyVertexBuffer();
 	}
 
 	void DummyRenderManager::destroyVertexBuffer(IVertexBuffer* _buffer)
 	{
+		delete _buffer;
 	}
 
 	void DummyRenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
+		++ mCountBatch;
+	}
+
+	void DummyRenderManager::doRotatedRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count, float _angle, float _centerX, float _centerY)
+	{
+		++ mCountBatch;
 	}
 
 	void DummyRenderManager::drawOneFrame()
@@ -53,18 +67,38 @@ namespace MyGUI
 		static unsigned long last_time = timer.getMilliseconds();
 		unsigned long now_time = timer.getMilliseconds();
 		unsigned long time = now_time - last_time;
+		float elapsed = (float)((double)(time) / (double)1000);
+
+		// nothing happens till next deadline, elapsed time is kept for the next frame event
+		float delay = gui->getNextFrameDelay();
+		if (!mUpdate && (delay < 0.0f || delay > elapsed))
+		{
+			mCountBatch = 0;
+			++ mCountSkippedFrame;
+			return;
+		}
 
-		onFrameEvent((float)((double)(time) / (double)1000));
+		onFrameEvent(elapsed);
 
 		last_time = now_time;
 
+		if (!onPrepareFrame(mUpdate))
+		{
+			mCountBatch = 0;
+			++ mCountSkippedFrame;
+			return;
+		}
+
 		begin();
-		onRenderToTarget(this, false);
+		onRenderToTarget(this, mUpdate);
 		end();
+
+		mUpdate = false;
 	}
 
 	void DummyRenderManager::begin()
 	{
+		mCountBatch = 0;
 	}
 
 	void DummyRenderManager::end()
@@ -73,16 +107,41 @@ namespace MyGUI
 
 	ITexture* DummyRenderManager::createTexture(const std::string& _name)
 	{
-		return nullptr;
+		MapTexture::const_iterator item = mTextures.find(_name);
+		MYGUI_PLATFORM_ASSERT(item == mTextures.end(), "Texture '" << _name << "' already exist");
+
+		DummyTexture* texture = new DummyTexture(_name);
+		mTextures[_name] = texture;
+		return texture;
 	}
 
 	void DummyRenderManager::destroyTexture(ITexture* _texture)
 	{
+		if (_texture == nullptr)
+			return;
+
+		MapTexture::iterator item = mTextures.find(_texture->getName());
+		MYGUI_PLATFORM_ASSERT(item != mTextures.end(), "Texture '" << _texture->getName() << "' not found");
+
+		mTextures.erase(item);
+		delete _texture;
 	}
 
 	ITexture* DummyRenderManager::getTexture(const std::string& _name)
 	{
-		return nullptr;
+		MapTexture::const_iterator item = mTextures.find(_name);
+		if (item == mTextures.end())
+			return nullptr;
+		return item->second;
+	}
+
+	void DummyRenderManager::destroyAllResources()
+	{
+		for (MapTexture::const_iterator item = mTextures.begin(); item != mTextures.end(); ++item)
+		{
+			delete item->second;
+		}
+		mTextures.clear();
 	}
 
 	bool DummyRenderManager::isFormatSupported(PixelFormat _format, TextureUsage _usage)
@@ -90,10 +149,26 @@ namespace MyGUI
 		return false;
 	}
 
+	bool DummyRenderManager::isPartialRedrawSupported() const
+	{
+		return true;
+	}
+
 	void DummyRenderManager::setViewSize(int _width, int _height)
 	{
 		mViewSize.set(_width, _height);
 		onResizeView(mViewSize);
+		mUpdate = true;
+	}
+
+	size_t DummyRenderManager::getBatchCount() const
+	{
+		return mCountBatch;
+	}
+
+	size_t DummyRenderManager::getSkippedFrameCount() const
+	{
+		return mCountSkippedFrame;
 	}
 
 } // namespace MyGUI
@@ -0,0 +1,131 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+#include "MyGUI_DummyTexture.h"
+#include "MyGUI_DummyRenderManager.h"
+#include "MyGUI_DummyDiagnostic.h"
+
+namespace MyGUI
+{
+
+	DummyTexture::DummyTexture(const std::string& _name) :
+		mName(_name),
+		mWidth(0),
+		mHeight(0),
+		mUsage(TextureUsage::Default),
+		mFormat(PixelFormat::Unknow),
+		mNumElemBytes(0),
+		mLock(false)
+	{
+	}
+
+	DummyTexture::~DummyTexture()
+	{
+		destroy();
+	}
+
+	const std::string& DummyTexture::getName() const
+	{
+		return mName;
+	}
+
+	void DummyTexture::createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format)
+	{
+		destroy();
+
+		if (_format == PixelFormat::L8)
+			mNumElemBytes = 1;
+		else if (_format == PixelFormat::L8A8)
+			mNumElemBytes = 2;
+		else if (_format == PixelFormat::R8G8B8)
+			mNumElemBytes = 3;
+		else if (_format == PixelFormat::R8G8B8A8)
+			mNumElemBytes = 4;
+		else
+			MYGUI_PLATFORM_EXCEPT("format not support");
+
+		mWidth = _width;
+		mHeight = _height;
+		mUsage = _usage;
+		mFormat = _format;
+		mBuffer.resize(mWidth * mHeight * mNumElemBytes, 0);
+	}
+
+	void DummyTexture::loadFromFile(const std::string& _filename)
+	{
+		destroy();
+	}
+
+	void DummyTexture::saveToFile(const std::string& _filename)
+	{
+	}
+
+	void DummyTexture::loadFromMemory(const void* _memory)
+	{
+		if (_memory != nullptr && !mBuffer.empty())
+			memcpy(&mBuffer[0], _memory, mBuffer.size());
+	}
+
+	void DummyTexture::loadFromCodecMemory(const void* _memory, int _len, const std::string& _type)
+	{
+		destroy();
+	}
+
+	void DummyTexture::destroy()
+	{
+		mWidth = 0;
+		mHeight = 0;
+		mUsage = TextureUsage::Default;
+		mFormat = PixelFormat::Unknow;
+		mNumElemBytes = 0;
+		mLock = false;
+		mBuffer.clear();
+	}
+
+	void* DummyTexture::lock(TextureUsage _access)
+	{
+		if (mBuffer.empty())
+			return nullptr;
+
+		mLock = true;
+		return &mBuffer[0];
+	}
+
+	void DummyTexture::unlock()
+	{
+		mLock = false;
+	}
+
+	bool DummyTexture::isLocked()
+	{
+		return mLock;
+	}
+
+	int DummyTexture::getWidth()
+	{
+		return mWidth;
+	}
+
+	int DummyTexture::getHeight()
+	{
+		return mHeight;
+	}
+
+	PixelFormat DummyTexture::getFormat()
+	{
+		return mFormat;
+	}
+
+	TextureUsage DummyTexture::getUsage()
+	{
+		return mUsage;
+	}
+
+	size_t DummyTexture::getNumElemBytes()
+	{
+		return mNumElemBytes;
+	}
+
+} // namespace MyGUI
@@ -0,0 +1,44 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+#include "MyGUI_DummyVertexBuffer.h"
+
+namespace MyGUI
+{
+
+	const size_t VERTEX_IN_QUAD = 6;
+	const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
+
+	DummyVertexBuffer::DummyVertexBuffer() :
+		mVertexCount(RENDER_ITEM_STEEP_REALLOCK)
+	{
+	}
+
+	DummyVertexBuffer::~DummyVertexBuffer()
+	{
+	}
+
+	void DummyVertexBuffer::setVertexCount(size_t _count)
+	{
+		mVertexCount = _count;
+	}
+
+	size_t DummyVertexBuffer::getVertexCount()
+	{
+		return mVertexCount;
+	}
+
+	Vertex* DummyVertexBuffer::lock()
+	{
+		if (mBuffer.size() < mVertexCount)
+			mBuffer.resize(mVertexCount);
+		return mBuffer.empty() ? nullptr : &mBuffer[0];
+	}
+
+	void DummyVertexBuffer::unlock()
+	{
+	}
+
+} // namespace MyGUI
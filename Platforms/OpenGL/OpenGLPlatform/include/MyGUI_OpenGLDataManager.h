@@ -9,15 +9,24 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_DataManager.h"
+#include "MyGUI_Thread.h"
+
+namespace common
+{
+	class FileSystemIndex;
+}
 
 namespace MyGUI
 {
 
+	class DataPack;
+
 	class OpenGLDataManager :
 		public DataManager
 	{
 	public:
 		OpenGLDataManager();
+		virtual ~OpenGLDataManager();
 
 		void initialise();
 		void shutdown();
@@ -43,20 +52,42 @@ namespace MyGUI
 		/** @see DataManager::getDataListNames(const std::string& _pattern) */
 		virtual const VectorString& getDataListNames(const std::string& _pattern);
 
-		/** @see DataManager::getDataPath(const std::string& _name) */
+		/** @see DataManager::getDataPath(const std::string& _name)
+			@note Entries of packs have no path, use getData for them.
+		*/
 		virtual const std::string& getDataPath(const std::string& _name);
 
+		/** Rescan resource locations on next request.
+			Locations are indexed once, call this method when files were added or removed after that.
+			Must not be called while other threads look up data. References returned by getDataPath and
+			getDataListNames before stay valid, but are not updated.
+		*/
+		void invalidateIndex();
+
 	/*internal:*/
 		void addResourceLocation(const std::string& _name, bool _recursive);
+		/** Add pack file. Entries of packs are found before files of resource locations, packs added later override earlier ones.
+			Pack entries are available only through getData, data opened by path (for example Win32 cursors) must stay in resource locations.
+		*/
+		bool addResourcePack(const std::string& _name);
 
 	private:
-		struct ArhivInfo
-		{
-			std::wstring name;
-			bool recursive;
-		};
-		typedef std::vector<ArhivInfo> VectorArhivInfo;
-		VectorArhivInfo mPaths;
+		// moves cached results aside instead of clearing them, callers may still hold references to them
+		void retireCache();
+		void retireDataListNames();
+
+	private:
+		// lookups from several threads are serialised, cached results are written once and live as long as the manager
+		Mutex mIndexMutex;
+		common::FileSystemIndex* mIndex;
+		MapString mPathCache;
+		typedef std::map<std::string, VectorString> MapDataListNames;
+		MapDataListNames mDataListNames;
+		std::list<MapString> mRetiredPathCaches;
+		std::list<MapDataListNames> mRetiredDataListNames;
+
+		typedef std::vector<DataPack*> VectorDataPack;
+		VectorDataPack mPacks;
 
 		bool mIsInitialise;
 	};
@@ -37,6 +37,8 @@ namespace MyGUI
 
 		/** @see OpenGLRenderManager::isFormatSupported */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
+		/** @see RenderManager::isPartialRedrawSupported */
+		virtual bool isPartialRedrawSupported() const;
 
 		/** @see OpenGLRenderManager::createVertexBuffer */
 		virtual IVertexBuffer* createVertexBuffer();
@@ -62,16 +64,28 @@ namespace MyGUI
 
 
 	/*internal:*/
+		/** Draw frame.\n
+			With LayerManager::setPartialRedraw application must not clear frame and must keep previous frame in buffer,
+			changed rectangles are cleared with current clear colour and drawn, unchanged frame is skipped.
+		*/
 		void drawOneFrame();
 		void setViewSize(int _width, int _height);
 		bool isPixelBufferObjectSupported() const;
+		/** Draw vertex buffer to current target, _region restricts output to its rectangles if not nullptr */
+		void drawBuffer(IVertexBuffer* _buffer, ITexture* _texture, size_t _count, const DirtyRegion* _region);
+
+		/** Number of frames skipped by partial redraw because nothing changed, nothing has to be presented for them */
+		size_t getSkippedFrameCount() const;
 
 	private:
 		void destroyAllResources();
+		void setDistanceFieldCombiner(bool _enable, unsigned int _textureId);
+		void clearRegion(const DirtyRegion& _region);
 
 	private:
 		IntSize mViewSize;
 		bool mUpdate;
+		size_t mCountSkippedFrame;
 		VertexColourType mVertexFormat;
 		RenderTargetInfo mInfo;
 
@@ -7,17 +7,31 @@
 #include "MyGUI_OpenGLDataManager.h"
 #include "MyGUI_OpenGLDiagnostic.h"
 #include "MyGUI_DataFileStream.h"
-#include "FileSystemInfo/FileSystemInfo.h"
+#include "MyGUI_DataMappedStream.h"
+#include "MyGUI_DataPack.h"
+#include "FileSystemInfo/FileSystemIndex.h"
 #include <fstream>
+#include <set>
 
 namespace MyGUI
 {
 
 	OpenGLDataManager::OpenGLDataManager() :
+		mIndex(new common::FileSystemIndex()),
 		mIsInitialise(false)
 	{
 	}
 
+	OpenGLDataManager::~OpenGLDataManager()
+	{
+		for (VectorDataPack::iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+			delete *item;
+		mPacks.clear();
+
+		delete mIndex;
+		mIndex = nullptr;
+	}
+
 	void OpenGLDataManager::initialise()
 	{
 		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
@@ -38,10 +52,27 @@ namespace MyGUI
 
 	IDataStream* OpenGLDataManager::getData(const std::string& _name)
 	{
+		{
+			MutexLock lock(mIndexMutex);
+
+			for (VectorDataPack::reverse_iterator item = mPacks.rbegin(); item != mPacks.rend(); ++item)
+			{
+				IDataStream* data = (*item)->getData(_name);
+				if (data != nullptr)
+					return data;
+			}
+		}
+
 		std::string filepath = getDataPath(_name);
 		if (filepath.empty())
 			return nullptr;
 
+		DataMappedStream* mapped = new DataMappedStream();
+		if (mapped->open(filepath))
+			return mapped;
+		delete mapped;
+
+		// mapping failed (empty file or no address space), read through file stream
 		std::ifstream* stream = new std::ifstream();
 		stream->open(filepath.c_str(), std::ios_base::binary);
 
@@ -63,54 +94,74 @@ namespace MyGUI
 
 	bool OpenGLDataManager::isDataExist(const std::string& _name)
 	{
-		const VectorString& files = getDataListNames(_name);
-		return !files.empty();
+		MutexLock lock(mIndexMutex);
+
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+		{
+			if ((*item)->isDataExist(_name))
+				return true;
+		}
+
+		common::VectorWString wresult;
+		mIndex->find(wresult, MyGUI::UString(_name).asWStr(), false);
+		return !wresult.empty();
 	}
 
 	const VectorString& OpenGLDataManager::getDataListNames(const std::string& _pattern)
 	{
-		static VectorString result;
+		MutexLock lock(mIndexMutex);
+
+		MapDataListNames::const_iterator cached = mDataListNames.find(_pattern);
+		if (cached != mDataListNames.end())
+			return cached->second;
+
 		common::VectorWString wresult;
-		result.clear();
+		mIndex->find(wresult, MyGUI::UString(_pattern).asWStr(), false);
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
+		VectorString& result = mDataListNames[_pattern];
+		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_pattern).asWStr(), false);
+			result.push_back(MyGUI::UString(*item).asUTF8());
 		}
 
-		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+			(*item)->getDataListNames(_pattern, result);
+
+		// the same name can be both a file and an entry of one or several packs
+		std::set<std::string> unique;
+		VectorString::iterator last = result.begin();
+		for (VectorString::iterator item = result.begin(); item != result.end(); ++item)
 		{
-			result.push_back(MyGUI::UString(*item).asUTF8());
+			if (unique.insert(*item).second)
+				*last++ = *item;
 		}
+		result.erase(last, result.end());
 
 		return result;
 	}
 
 	const std::string& OpenGLDataManager::getDataPath(const std::string& _name)
 	{
-		static std::string path;
-		VectorString result;
-		common::VectorWString wresult;
+		MutexLock lock(mIndexMutex);
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_name).asWStr(), true);
-		}
+		MapString::const_iterator cached = mPathCache.find(_name);
+		if (cached != mPathCache.end())
+			return cached->second;
 
-		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
-		{
-			result.push_back(MyGUI::UString(*item).asUTF8());
-		}
+		common::VectorWString wresult;
+		mIndex->find(wresult, MyGUI::UString(_name).asWStr(), true);
 
-		if (!result.empty())
+		// empty path also cached, so missing files are not searched again until index is invalidated
+		std::string& path = mPathCache[_name];
+		if (!wresult.empty())
 		{
-			path = result[0];
-			if (result.size() > 1)
+			path = MyGUI::UString(wresult[0]).asUTF8();
+			if (wresult.size() > 1)
 			{
 				MYGUI_PLATFORM_LOG(Warning, "There are several files with name '" << _name << "'. '" << path << "' was used.");
 				MYGUI_PLATFORM_LOG(Warning, "Other candidater are:");
-				for (size_t index = 1; index < result.size(); index ++)
-					MYGUI_PLATFORM_LOG(Warning, " - '" << result[index] << "'");
+				for (size_t index = 1; index < wresult.size(); index ++)
+					MYGUI_PLATFORM_LOG(Warning, " - '" << MyGUI::UString(wresult[index]).asUTF8() << "'");
 			}
 		}
 
@@ -119,10 +170,49 @@ namespace MyGUI
 
 	void OpenGLDataManager::addResourceLocation(const std::string& _name, bool _recursive)
 	{
-		ArhivInfo info;
-		info.name = MyGUI::UString(_name).asWStr();
-		info.recursive = _recursive;
-		mPaths.push_back(info);
+		MutexLock lock(mIndexMutex);
+
+		mIndex->addLocation(MyGUI::UString(_name).asWStr(), _recursive);
+		retireCache();
+		retireDataListNames();
+	}
+
+	bool OpenGLDataManager::addResourcePack(const std::string& _name)
+	{
+		DataPack* pack = new DataPack();
+		if (!pack->load(_name))
+		{
+			MYGUI_PLATFORM_LOG(Error, "Can't load pack '" << _name << "'");
+			delete pack;
+			return false;
+		}
+
+		MutexLock lock(mIndexMutex);
+
+		mPacks.push_back(pack);
+		retireDataListNames();
+		return true;
+	}
+
+	void OpenGLDataManager::invalidateIndex()
+	{
+		MutexLock lock(mIndexMutex);
+
+		mIndex->invalidate();
+		retireCache();
+		retireDataListNames();
+	}
+
+	void OpenGLDataManager::retireCache()
+	{
+		mRetiredPathCaches.push_back(MapString());
+		mRetiredPathCaches.back().swap(mPathCache);
+	}
+
+	void OpenGLDataManager::retireDataListNames()
+	{
+		mRetiredDataListNames.push_back(MapDataListNames());
+		mRetiredDataListNames.back().swap(mDataListNames);
 	}
 
 } // namespace MyGUI
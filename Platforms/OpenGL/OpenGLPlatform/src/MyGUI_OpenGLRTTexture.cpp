@@ -95,7 +95,8 @@ namespace MyGUI
 
 	void OpenGLRTTexture::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
-		OpenGLRenderManager::getInstance().doRender(_buffer, _texture, _count);
+		// changed rectangles of screen don't apply to texture
+		OpenGLRenderManager::getInstance().drawBuffer(_buffer, _texture, _count, nullptr);
 	}
 
 } // namespace MyGUI
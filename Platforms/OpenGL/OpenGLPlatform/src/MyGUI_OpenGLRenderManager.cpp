@@ -11,6 +11,8 @@
 #include "MyGUI_VertexData.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_Timer.h"
+#include "MyGUI_LayerManager.h"
+#include "MyGUI_DirtyRegion.h"
 
 #include "GL/glew.h"
 
@@ -29,6 +31,7 @@ namespace MyGUI
 
 	OpenGLRenderManager::OpenGLRenderManager() :
 		mUpdate(false),
+		mCountSkippedFrame(0),
 		mImageLoader(nullptr),
 		mPboIsSupported(false),
 		mIsInitialise(false)
@@ -75,21 +78,31 @@ namespace MyGUI
 	}
 
 	void OpenGLRenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
+	{
+		drawBuffer(_buffer, _texture, _count, mInfo.dirtyRegion);
+	}
+
+	void OpenGLRenderManager::drawBuffer(IVertexBuffer* _buffer, ITexture* _texture, size_t _count, const DirtyRegion* _region)
 	{
 		OpenGLVertexBuffer* buffer = static_cast<OpenGLVertexBuffer*>(_buffer);
 		unsigned int buffer_id = buffer->getBufferID();
 		MYGUI_PLATFORM_ASSERT(buffer_id, "Vertex buffer is not created");
 
 		unsigned int texture_id = 0;
+		bool distanceField = false;
 		if (_texture)
 		{
 			OpenGLTexture* texture = static_cast<OpenGLTexture*>(_texture);
 			texture_id = texture->getTextureID();
+			distanceField = texture->getUsage().isValue(TextureUsage::DistanceField);
 			//MYGUI_PLATFORM_ASSERT(texture_id, "Texture is not created");
 		}
 
 		glBindTexture(GL_TEXTURE_2D, texture_id);
 
+		if (distanceField)
+			setDistanceFieldCombiner(true, texture_id);
+
 		glBindBufferARB(GL_ARRAY_BUFFER_ARB, buffer_id);
 
 		// enable vertex arrays
@@ -105,7 +118,25 @@ namespace MyGUI
 		offset += (4);
 		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), (void*)offset);
 
-		glDrawArrays(GL_TRIANGLES, 0, _count);
+		if (_region == nullptr)
+		{
+			glDrawArrays(GL_TRIANGLES, 0, _count);
+		}
+		else
+		{
+			// partial redraw, pixels outside of changed rectangles keep previous frame
+			glEnable(GL_SCISSOR_TEST);
+			const DirtyRegion::VectorIntRect& rects = _region->getRects();
+			for (DirtyRegion::VectorIntRect::const_iterator rect = rects.begin(); rect != rects.end(); ++rect)
+			{
+				glScissor(rect->left, mViewSize.height - rect->bottom, rect->width(), rect->height());
+				glDrawArrays(GL_TRIANGLES, 0, _count);
+			}
+			glDisable(GL_SCISSOR_TEST);
+		}
+
+		if (distanceField)
+			setDistanceFieldCombiner(false, 0);
 
 		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 		glDisableClientState(GL_COLOR_ARRAY);
@@ -149,6 +180,46 @@ namespace MyGUI
 		glEnable(GL_TEXTURE_2D);
 	}
 
+	void OpenGLRenderManager::setDistanceFieldCombiner(bool _enable, unsigned int _textureId)
+	{
+		if (_enable)
+		{
+			// alpha = 4 * (field + 0.125 - 0.5) on the first unit, multiplied by the vertex colour on the second one
+			static const GLfloat constant[4] = { 0.0f, 0.0f, 0.0f, 0.125f };
+
+			glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_TEXTURE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_PRIMARY_COLOR);
+			glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_ADD_SIGNED);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_TEXTURE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_CONSTANT);
+			glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, constant);
+			glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 4.0f);
+
+			glActiveTexture(GL_TEXTURE1);
+			glBindTexture(GL_TEXTURE_2D, _textureId);
+			glEnable(GL_TEXTURE_2D);
+			glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_PREVIOUS);
+			glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_PREVIOUS);
+			glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_PRIMARY_COLOR);
+			glActiveTexture(GL_TEXTURE0);
+		}
+		else
+		{
+			glActiveTexture(GL_TEXTURE1);
+			glDisable(GL_TEXTURE_2D);
+			glBindTexture(GL_TEXTURE_2D, 0);
+			glActiveTexture(GL_TEXTURE0);
+
+			glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 1.0f);
+			glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+		}
+	}
+
 	void OpenGLRenderManager::end()
 	{
 		glPopMatrix();
@@ -181,6 +252,11 @@ namespace MyGUI
 		return true;
 	}
 
+	bool OpenGLRenderManager::isPartialRedrawSupported() const
+	{
+		return true;
+	}
+
 	void OpenGLRenderManager::drawOneFrame()
 	{
 		Gui* gui = Gui::getInstancePtr();
@@ -196,13 +272,42 @@ namespace MyGUI
 
 		last_time = now_time;
 
+		// without partial redraw application clears whole frame, so it is drawn even if nothing changed
+		bool changed = onPrepareFrame(mUpdate);
+		LayerManager* layers = LayerManager::getInstancePtr();
+		bool partial = layers != nullptr && layers->getPartialRedraw();
+		if (partial && !changed)
+		{
+			++ mCountSkippedFrame;
+			return;
+		}
+
 		begin();
+		if (partial)
+			clearRegion(layers->getDirtyRegion());
 		onRenderToTarget(this, mUpdate);
 		end();
 
 		mUpdate = false;
 	}
 
+	void OpenGLRenderManager::clearRegion(const DirtyRegion& _region)
+	{
+		glEnable(GL_SCISSOR_TEST);
+		const DirtyRegion::VectorIntRect& rects = _region.getRects();
+		for (DirtyRegion::VectorIntRect::const_iterator rect = rects.begin(); rect != rects.end(); ++rect)
+		{
+			glScissor(rect->left, mViewSize.height - rect->bottom, rect->width(), rect->height());
+			glClear(GL_COLOR_BUFFER_BIT);
+		}
+		glDisable(GL_SCISSOR_TEST);
+	}
+
+	size_t OpenGLRenderManager::getSkippedFrameCount() const
+	{
+		return mCountSkippedFrame;
+	}
+
 	void OpenGLRenderManager::setViewSize(int _width, int _height)
 	{
 		if (_height == 0)
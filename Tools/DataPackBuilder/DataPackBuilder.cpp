@@ -0,0 +1,115 @@
+/*!
+	@file
+	@date		10/2026
+*/
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_DataPack.h"
+#include "MyGUI_LogManager.h"
+#include "FileSystemInfo/FileSystemInfo.h"
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+
+	void printUsage()
+	{
+		std::cout << "Usage: DataPackBuilder [options] output.pack folder [folder ...]" << std::endl;
+		std::cout << "  -c            compress entries with LZ4" << std::endl;
+		std::cout << "  -p            keep paths relative to folder in entry names" << std::endl;
+		std::cout << "                (by default entries are named by file name, like in recursive resource locations)" << std::endl;
+		std::cout << "  -a alignment  alignment of entries data, power of two (16 by default)" << std::endl;
+	}
+
+	std::string getEntryName(const std::wstring& _folder, const std::wstring& _file, bool _keepPaths)
+	{
+		std::wstring name = _file.substr(_folder.size());
+		if (!_keepPaths)
+		{
+			size_t pos = name.find_last_of(L"/\\");
+			if (pos != std::wstring::npos)
+				name = name.substr(pos + 1);
+		}
+		else
+		{
+			while (!name.empty() && (name[0] == '/' || name[0] == '\\'))
+				name.erase(0, 1);
+			for (std::wstring::iterator symbol = name.begin(); symbol != name.end(); ++symbol)
+			{
+				if (*symbol == '\\')
+					*symbol = '/';
+			}
+		}
+		return MyGUI::UString(name).asUTF8();
+	}
+
+}
+
+int main(int argc, char* argv[])
+{
+	bool compress = false;
+	bool keepPaths = false;
+	size_t alignment = 16;
+	MyGUI::VectorString arguments;
+
+	for (int index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument == "-c")
+			compress = true;
+		else if (argument == "-p")
+			keepPaths = true;
+		else if (argument == "-a" && index + 1 < argc)
+			alignment = (size_t)atoi(argv[++index]);
+		else
+			arguments.push_back(argument);
+	}
+
+	if (arguments.size() < 2)
+	{
+		printUsage();
+		return 1;
+	}
+
+	MyGUI::LogManager* logManager = new MyGUI::LogManager();
+	logManager->createDefaultSource("DataPackBuilder.log");
+
+	MyGUI::VectorString names;
+	MyGUI::VectorString files;
+	MyGUI::MapString sources;
+
+	for (size_t index = 1; index < arguments.size(); ++index)
+	{
+		std::wstring folder = MyGUI::UString(arguments[index]).asWStr();
+		common::VectorWString result;
+		common::scanFolder(result, folder, true, L"*", true);
+
+		for (common::VectorWString::const_iterator file = result.begin(); file != result.end(); ++file)
+		{
+			std::string name = getEntryName(folder, *file, keepPaths);
+			std::string path = MyGUI::UString(*file).asUTF8();
+
+			MyGUI::MapString::const_iterator source = sources.find(name);
+			if (source != sources.end())
+			{
+				MYGUI_LOGGING("DataPackBuilder", Warning, "There are several files with name '" << name << "'. '" << source->second << "' was used, '" << path << "' skipped.");
+				continue;
+			}
+
+			sources[name] = path;
+			names.push_back(name);
+			files.push_back(path);
+		}
+	}
+
+	bool result = MyGUI::DataPack::build(arguments[0], names, files, compress ? MyGUI::DataPack::CompressionLZ4 : MyGUI::DataPack::CompressionNone, alignment);
+	if (result)
+		MYGUI_LOGGING("DataPackBuilder", Info, "Pack '" << arguments[0] << "' created, " << names.size() << " entries");
+	else
+		MYGUI_LOGGING("DataPackBuilder", Error, "Can't create pack '" << arguments[0] << "'");
+
+	delete logManager;
+
+	return result ? 0 : 1;
+}
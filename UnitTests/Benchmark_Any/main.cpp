@@ -0,0 +1,67 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_Any.h"
+
+namespace
+{
+
+	typedef std::vector<MyGUI::Any> VectorAny;
+
+	const size_t ItemCount = 100000;
+	const size_t RepeatCount = 20;
+
+	// item data of list widgets, filled once and then copied and read on every lookup
+	template <typename ValueType>
+	void runValue(const std::string& _name, const ValueType& _value)
+	{
+		{
+			unittest::BenchmarkTimer timer(_name + ", fill", ItemCount * RepeatCount);
+			for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			{
+				VectorAny items;
+				items.reserve(ItemCount);
+				for (size_t index = 0; index < ItemCount; ++index)
+					items.push_back(MyGUI::Any(_value));
+				unittest::consume(items.size());
+			}
+		}
+
+		VectorAny items(ItemCount, MyGUI::Any(_value));
+		{
+			unittest::BenchmarkTimer timer(_name + ", copy", ItemCount * RepeatCount);
+			for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			{
+				VectorAny copy(items);
+				unittest::consume(copy.size());
+			}
+		}
+
+		{
+			unittest::BenchmarkTimer timer(_name + ", castType", ItemCount * RepeatCount);
+			size_t found = 0;
+			for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			{
+				for (size_t index = 0; index < ItemCount; ++index)
+				{
+					if (items[index].castType<ValueType>(false) != nullptr)
+						++found;
+				}
+			}
+			unittest::consume(found);
+		}
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << ItemCount << " items, time per item" << std::endl;
+	runValue<size_t>("size_t", 42);
+	int value = 0;
+	runValue<int*>("pointer", &value);
+	runValue<std::string>("std::string", "item data");
+	return 0;
+}
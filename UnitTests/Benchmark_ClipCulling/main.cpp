@@ -0,0 +1,59 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+
+namespace
+{
+
+	const int ItemHeight = 20;
+	const int ViewHeight = 400;
+	const size_t StepCount = 500;
+
+	// view clips long list of items, each item has nested children like list rows with icon and text
+	void runScroll(size_t _itemCount)
+	{
+		unittest::HeadlessGui gui;
+		gui.loadBoxSkin("Row", "MainSkin");
+
+		MyGUI::Widget* view = gui.getGui()->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(10, 10, 300, ViewHeight), MyGUI::Align::Default, "Main");
+		MyGUI::Widget* client = view->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(0, 0, 300, (int)_itemCount * ItemHeight), MyGUI::Align::Default);
+		for (size_t index = 0; index < _itemCount; ++index)
+		{
+			MyGUI::Widget* item = client->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(0, (int)index * ItemHeight, 300, ItemHeight), MyGUI::Align::Default);
+			MyGUI::Widget* icon = item->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(2, 2, 16, 16), MyGUI::Align::Default);
+			icon->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(4, 4, 8, 8), MyGUI::Align::Default);
+			item->createWidget<MyGUI::Widget>("Row", MyGUI::IntCoord(20, 2, 270, 16), MyGUI::Align::Default);
+		}
+		gui.getRenderManager()->drawOneFrame();
+
+		// scroll near the top, so only visible items and their neighbours change
+		{
+			unittest::BenchmarkTimer timer(MyGUI::utility::toString(_itemCount, " items, scroll only"), StepCount);
+			for (size_t step = 0; step < StepCount; ++step)
+				client->setPosition(0, -(int)(step % 100) * 3);
+		}
+		gui.getRenderManager()->drawOneFrame();
+
+		// frame includes render item walk over all skins, it is not affected by culling
+		{
+			unittest::BenchmarkTimer timer(MyGUI::utility::toString(_itemCount, " items, scroll and frame"), StepCount);
+			for (size_t step = 0; step < StepCount; ++step)
+			{
+				client->setPosition(0, -(int)(step % 100) * 3);
+				gui.getRenderManager()->drawOneFrame();
+			}
+		}
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << "scrolling clipped list, time per scroll step" << std::endl;
+	runScroll(1000);
+	runScroll(10000);
+	return 0;
+}
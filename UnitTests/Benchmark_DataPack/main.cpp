@@ -0,0 +1,127 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_DataPack.h"
+#include "MyGUI_LogManager.h"
+#include "FileSystemInfo/FileSystemIndex.h"
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+namespace
+{
+
+	const size_t RepeatCount = 5;
+
+	size_t readStream(MyGUI::IDataStream* _stream, std::vector<char>& _buffer)
+	{
+		if (_stream == nullptr)
+			return 0;
+		_buffer.resize(_stream->size() + 1);
+		return _stream->read(&_buffer[0], _stream->size());
+	}
+
+	size_t readLooseFiles(const MyGUI::VectorString& _files)
+	{
+		size_t result = 0;
+		std::vector<char> buffer;
+		for (MyGUI::VectorString::const_iterator file = _files.begin(); file != _files.end(); ++file)
+		{
+			std::ifstream stream(file->c_str(), std::ios_base::binary);
+			stream.seekg(0, std::ios_base::end);
+			size_t size = (size_t)stream.tellg();
+			stream.seekg(0, std::ios_base::beg);
+			buffer.resize(size + 1);
+			stream.read(&buffer[0], size);
+			result += (size_t)stream.gcount();
+		}
+		return result;
+	}
+
+	// open pack as application does at startup and read every entry
+	size_t readPack(const std::string& _pack, const MyGUI::VectorString& _names)
+	{
+		MyGUI::DataPack pack;
+		if (!pack.load(_pack))
+			return 0;
+
+		size_t result = 0;
+		std::vector<char> buffer;
+		for (MyGUI::VectorString::const_iterator name = _names.begin(); name != _names.end(); ++name)
+		{
+			MyGUI::IDataStream* stream = pack.getData(*name);
+			result += readStream(stream, buffer);
+			delete stream;
+		}
+		return result;
+	}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	MyGUI::LogManager logManager;
+
+	// folder with resources, for example Media/MyGUI_Media
+	std::string folder = argc > 1 ? argv[1] : ".";
+
+	common::FileSystemIndex index;
+	index.addLocation(MyGUI::UString(folder).asWStr(), true);
+	common::VectorWString paths;
+	index.find(paths, L"*", true);
+
+	// entries are named by file name like recursive resource locations, first file wins
+	MyGUI::VectorString names;
+	MyGUI::VectorString files;
+	std::set<std::string> uniqueNames;
+	for (common::VectorWString::const_iterator path = paths.begin(); path != paths.end(); ++path)
+	{
+		std::string file = MyGUI::UString(*path).asUTF8();
+		std::string name = file.substr(file.find_last_of("/\\") + 1);
+		if (uniqueNames.insert(name).second)
+		{
+			names.push_back(name);
+			files.push_back(file);
+		}
+	}
+	std::cout << names.size() << " files from '" << folder << "', every case reads all of them" << std::endl;
+	if (names.empty())
+		return 0;
+
+	const std::string rawPack = "Benchmark_DataPack_raw.pack";
+	const std::string compressedPack = "Benchmark_DataPack_lz4.pack";
+	{
+		unittest::BenchmarkTimer timer("build raw pack", 1);
+		MyGUI::DataPack::build(rawPack, names, files, MyGUI::DataPack::CompressionNone);
+	}
+	{
+		unittest::BenchmarkTimer timer("build lz4 pack", 1);
+		MyGUI::DataPack::build(compressedPack, names, files, MyGUI::DataPack::CompressionLZ4);
+	}
+
+	size_t bytes = 0;
+	{
+		unittest::BenchmarkTimer timer("loose files", RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			bytes = readLooseFiles(files);
+	}
+	std::cout << "  read " << bytes << " bytes" << std::endl;
+	{
+		unittest::BenchmarkTimer timer("raw pack", RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			bytes = readPack(rawPack, names);
+	}
+	std::cout << "  read " << bytes << " bytes" << std::endl;
+	{
+		unittest::BenchmarkTimer timer("lz4 pack", RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+			bytes = readPack(compressedPack, names);
+	}
+	std::cout << "  read " << bytes << " bytes" << std::endl;
+
+	std::remove(rawPack.c_str());
+	std::remove(compressedPack.c_str());
+	return 0;
+}
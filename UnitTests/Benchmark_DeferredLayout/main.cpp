@@ -0,0 +1,55 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+
+namespace
+{
+
+	const size_t ChildCount = 300;
+	const size_t ResizePerFrame = 100;
+	const size_t FrameCount = 50;
+
+	// resize storm, window is resized many times per frame like during mouse drag with several setters in a row
+	void runResize(bool _deferred)
+	{
+		unittest::HeadlessGui gui;
+		gui.loadBoxSkin("Frame", "MainSkin");
+
+		MyGUI::Widget* window = gui.getGui()->createWidget<MyGUI::Widget>("Frame", MyGUI::IntCoord(10, 10, 600, 600), MyGUI::Align::Default, "Main");
+		for (size_t index = 0; index < ChildCount; ++index)
+		{
+			// half of children are stretched, others follow right bottom corner
+			int offset = (int)(index % 100) * 2;
+			MyGUI::Align align = index % 2 == 0 ? MyGUI::Align::Stretch : MyGUI::Align::Right | MyGUI::Align::Bottom;
+			MyGUI::Widget* child = window->createWidget<MyGUI::Widget>("Frame", MyGUI::IntCoord(offset, offset, 300, 300), align);
+			child->createWidget<MyGUI::Widget>("Frame", MyGUI::IntCoord(4, 4, 292, 292), MyGUI::Align::Stretch);
+		}
+
+		MyGUI::WidgetManager::getInstance().setDeferredLayout(_deferred);
+		gui.getRenderManager()->drawOneFrame();
+
+		unittest::BenchmarkTimer timer(_deferred ? "deferred layout" : "immediate layout", FrameCount);
+		for (size_t frame = 0; frame < FrameCount; ++frame)
+		{
+			for (size_t index = 0; index < ResizePerFrame; ++index)
+			{
+				int delta = (int)((frame * ResizePerFrame + index) % 200);
+				window->setSize(500 + delta, 500 + delta);
+			}
+			gui.getRenderManager()->drawOneFrame();
+		}
+		unittest::consume((size_t)window->getChildAt(0)->getWidth());
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << ChildCount << " children, " << ResizePerFrame << " setSize calls per frame, time per frame" << std::endl;
+	runResize(false);
+	runResize(true);
+	return 0;
+}
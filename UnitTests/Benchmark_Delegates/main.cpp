@@ -0,0 +1,86 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_Delegate.h"
+#include "MyGUI_StringUtility.h"
+
+namespace
+{
+
+	typedef MyGUI::delegates::CMultiDelegate1<size_t> EventHandle_Size;
+
+	class Listener
+	{
+	public:
+		Listener() :
+			mSum(0)
+		{
+		}
+
+		void notifyEvent(size_t _value)
+		{
+			mSum += _value;
+		}
+
+		size_t mSum;
+	};
+
+	typedef std::vector<Listener> VectorListener;
+
+	void runSubscribers(size_t _subscriberCount, size_t _repeatCount)
+	{
+		VectorListener listeners(_subscriberCount);
+		EventHandle_Size event;
+		std::string name = MyGUI::utility::toString(_subscriberCount, " subscribers");
+
+		{
+			unittest::BenchmarkTimer timer(name + ", subscribe and unsubscribe", _repeatCount * _subscriberCount);
+			for (size_t repeat = 0; repeat < _repeatCount; ++repeat)
+			{
+				for (size_t index = 0; index < _subscriberCount; ++index)
+					event += MyGUI::newDelegate(&listeners[index], &Listener::notifyEvent);
+				for (size_t index = 0; index < _subscriberCount; ++index)
+					event -= MyGUI::newDelegate(&listeners[index], &Listener::notifyEvent);
+				// call on empty event, like a real event fired between subscriptions
+				event(repeat);
+			}
+		}
+
+		{
+			unittest::BenchmarkTimer timer(name + ", subscribe and remove", _repeatCount * _subscriberCount);
+			for (size_t repeat = 0; repeat < _repeatCount; ++repeat)
+			{
+				for (size_t index = 0; index < _subscriberCount; ++index)
+					event += MyGUI::newDelegate(&listeners[index], &Listener::notifyEvent);
+				for (size_t index = 0; index < _subscriberCount; ++index)
+					event.remove(&listeners[index], &Listener::notifyEvent);
+				event(repeat);
+			}
+		}
+
+		for (size_t index = 0; index < _subscriberCount; ++index)
+			event += MyGUI::newDelegate(&listeners[index], &Listener::notifyEvent);
+
+		{
+			size_t callCount = _repeatCount * 100;
+			unittest::BenchmarkTimer timer(name + ", dispatch", callCount);
+			for (size_t call = 0; call < callCount; ++call)
+				event(call);
+		}
+
+		for (size_t index = 0; index < _subscriberCount; ++index)
+			unittest::consume(listeners[index].mSum);
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << "multi delegate, time per subscription or per dispatch" << std::endl;
+	runSubscribers(1, 100000);
+	runSubscribers(10, 10000);
+	runSubscribers(100, 1000);
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_FactoryManager.h"
+#include "MyGUI_LogManager.h"
+
+namespace
+{
+
+	class BenchmarkObject :
+		public MyGUI::IObject
+	{
+		MYGUI_RTTI_DERIVED( BenchmarkObject )
+	};
+
+	const std::string Category = "Benchmark";
+	const size_t TypeCount = 40;
+	const size_t CreateCount = 1000000;
+
+	std::string getTypeName(size_t _index)
+	{
+		return MyGUI::utility::toString("Type", _index);
+	}
+
+} // namespace
+
+int main()
+{
+	MyGUI::LogManager logManager;
+	MyGUI::FactoryManager factoryManager;
+	factoryManager.initialise();
+
+	MyGUI::VectorString types;
+	std::vector<MyGUI::FactoryHandle> handles;
+	for (size_t index = 0; index < TypeCount; ++index)
+	{
+		types.push_back(getTypeName(index));
+		factoryManager.registerFactory<BenchmarkObject>(Category, types.back());
+		handles.push_back(factoryManager.getFactoryHandle(Category, types.back()));
+	}
+
+	std::cout << TypeCount << " registered types, time per created object" << std::endl;
+	{
+		unittest::BenchmarkTimer timer("createObject by name", CreateCount);
+		for (size_t index = 0; index < CreateCount; ++index)
+		{
+			MyGUI::IObject* object = factoryManager.createObject(Category, types[index % TypeCount]);
+			unittest::consume(object != nullptr);
+			delete object;
+		}
+	}
+	{
+		unittest::BenchmarkTimer timer("createObject by handle", CreateCount);
+		for (size_t index = 0; index < CreateCount; ++index)
+		{
+			MyGUI::IObject* object = factoryManager.createObject(handles[index % TypeCount]);
+			unittest::consume(object != nullptr);
+			delete object;
+		}
+	}
+
+	// every name is different, lookups must not add items for them
+	MyGUI::VectorString unknownTypes;
+	for (size_t index = 0; index < CreateCount / 10; ++index)
+		unknownTypes.push_back(getTypeName(TypeCount + index));
+	{
+		unittest::BenchmarkTimer timer("createObject with unknown name", unknownTypes.size());
+		for (size_t index = 0; index < unknownTypes.size(); ++index)
+			unittest::consume(factoryManager.createObject(Category, unknownTypes[index]) != nullptr);
+	}
+	{
+		unittest::BenchmarkTimer timer("createObject by name after unknown names", CreateCount);
+		for (size_t index = 0; index < CreateCount; ++index)
+		{
+			MyGUI::IObject* object = factoryManager.createObject(Category, types[index % TypeCount]);
+			unittest::consume(object != nullptr);
+			delete object;
+		}
+	}
+
+	factoryManager.shutdown();
+	return 0;
+}
@@ -0,0 +1,178 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_XmlDocument.h"
+#include "FileSystemInfo/FileSystemIndex.h"
+#include <set>
+
+namespace
+{
+
+	const size_t RepeatCount = 10;
+	const size_t MaskRepeatCount = 1000;
+	// scanning is slow, only first names are looked up that way
+	const size_t ScanCount = 50;
+
+	// data managers without index scanned every location for each lookup,
+	// on POSIX getSystemFileList ignores mask so scan returns every file
+	void findByScan(common::VectorWString& _result, const std::wstring& _folder, const std::wstring& _pattern)
+	{
+		common::scanFolder(_result, _folder, true, _pattern, true);
+	}
+
+	void collectFileNames(MyGUI::xml::ElementPtr _node, MyGUI::VectorString& _result)
+	{
+		std::string value;
+		if (_node->findAttribute("file", value) || _node->findAttribute("texture", value))
+			_result.push_back(value);
+		else if (_node->getName() == "Property" && _node->findAttribute("key") == "Source")
+			_result.push_back(_node->findAttribute("value"));
+
+		MyGUI::xml::ElementEnumerator child = _node->getElementEnumerator();
+		while (child.next())
+			collectFileNames(child.current(), _result);
+	}
+
+	// lists, resource files and textures loaded by _name, in load order
+	void collectResourceList(common::FileSystemIndex& _index, const std::string& _name, MyGUI::VectorString& _result, std::set<std::string>& _visited)
+	{
+		if (!_visited.insert(_name).second)
+			return;
+		_result.push_back(_name);
+
+		common::VectorWString paths;
+		_index.find(paths, MyGUI::UString(_name).asWStr(), true);
+		MyGUI::xml::Document document;
+		if (paths.empty() || _name.find(".xml") == std::string::npos || !document.open(paths.front()))
+			return;
+
+		MyGUI::VectorString names;
+		collectFileNames(document.getRoot(), names);
+		for (MyGUI::VectorString::const_iterator name = names.begin(); name != names.end(); ++name)
+			collectResourceList(_index, *name, _result, _visited);
+	}
+
+	size_t resolveNames(common::FileSystemIndex& _index, const MyGUI::VectorString& _names)
+	{
+		size_t found = 0;
+		for (MyGUI::VectorString::const_iterator name = _names.begin(); name != _names.end(); ++name)
+		{
+			common::VectorWString result;
+			_index.find(result, MyGUI::UString(*name).asWStr(), true);
+			found += result.empty() ? 0 : 1;
+		}
+		return found;
+	}
+
+	// resolves names of MyGUI_Core.xml the way data managers do on startup,
+	// cold lookups include building the index, warm ones only search it
+	void runCoreList(const std::wstring& _location)
+	{
+		MyGUI::VectorString names;
+		{
+			common::FileSystemIndex index;
+			index.addLocation(_location, true);
+			std::set<std::string> visited;
+			collectResourceList(index, "MyGUI_Core.xml", names, visited);
+		}
+		std::cout << names.size() << " names in core resource list" << std::endl;
+
+		common::FileSystemIndex index;
+		index.addLocation(_location, true);
+		size_t found = 0;
+		{
+			unittest::BenchmarkTimer timer("core list cold, through index", names.size());
+			found = resolveNames(index, names);
+		}
+		std::cout << "  found " << found << std::endl;
+		{
+			unittest::BenchmarkTimer timer("core list warm, through index", names.size() * MaskRepeatCount);
+			for (size_t repeat = 0; repeat < MaskRepeatCount; ++repeat)
+				unittest::consume(resolveNames(index, names));
+		}
+
+		{
+			unittest::BenchmarkTimer timer("core list by scanning folder", names.size());
+			for (MyGUI::VectorString::const_iterator name = names.begin(); name != names.end(); ++name)
+			{
+				common::VectorWString result;
+				findByScan(result, _location, MyGUI::UString(*name).asWStr());
+				unittest::consume(result.size());
+			}
+		}
+	}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	// folder to index, Media folder of MyGUI sources by default
+	std::string folder = argc > 1 ? argv[1] : unittest::getMediaFolder();
+	std::wstring location = MyGUI::UString(folder).asWStr();
+
+	common::FileSystemIndex index;
+	index.addLocation(location, true);
+
+	common::VectorWString names;
+	{
+		unittest::BenchmarkTimer timer("index build", 1);
+		index.find(names, L"*", false);
+	}
+	std::cout << names.size() << " files in '" << folder << "', each is looked up " << RepeatCount << " times" << std::endl;
+	if (names.empty())
+		return 0;
+
+	size_t lookups = names.size() * RepeatCount;
+	size_t found = 0;
+	{
+		unittest::BenchmarkTimer timer("lookup through index", lookups);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+		{
+			for (common::VectorWString::const_iterator name = names.begin(); name != names.end(); ++name)
+			{
+				common::VectorWString result;
+				index.find(result, *name, true);
+				found += result.size();
+			}
+		}
+	}
+	std::cout << "  found " << found << std::endl;
+
+	size_t scanCount = std::min(names.size(), ScanCount);
+	found = 0;
+	{
+		unittest::BenchmarkTimer timer("lookup by scanning folder", scanCount);
+		for (size_t index = 0; index < scanCount; ++index)
+		{
+			common::VectorWString result;
+			findByScan(result, location, names[index]);
+			found += result.size();
+		}
+	}
+	std::cout << "  found " << found << std::endl;
+
+	{
+		unittest::BenchmarkTimer timer("mask *.xml through index", MaskRepeatCount);
+		for (size_t repeat = 0; repeat < MaskRepeatCount; ++repeat)
+		{
+			common::VectorWString result;
+			index.find(result, L"*.xml", true);
+			unittest::consume(result.size());
+		}
+	}
+	{
+		unittest::BenchmarkTimer timer("mask *.xml by scanning folder", RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+		{
+			common::VectorWString result;
+			findByScan(result, location, L"*.xml");
+			unittest::consume(result.size());
+		}
+	}
+
+	runCoreList(location);
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include <cmath>
+
+namespace
+{
+
+	const int ViewWidth = 1024;
+	const int ViewHeight = 768;
+	const int CellSize = 32;
+
+	// 1000 Hz mouse replayed at 60 fps for 10 seconds
+	const size_t MouseRate = 1000;
+	const size_t FrameRate = 60;
+	const size_t TraceLength = 10000;
+	// button is pressed for 100 ms every 500 ms, so part of the trace is a drag
+	const size_t PressPeriod = 500;
+	const size_t PressLength = 100;
+
+	struct MouseSample
+	{
+		int left;
+		int top;
+	};
+
+	typedef std::vector<MouseSample> VectorMouseSample;
+
+	VectorMouseSample createTrace()
+	{
+		VectorMouseSample result(TraceLength);
+		for (size_t index = 0; index < TraceLength; ++index)
+		{
+			double time = (double)index / (double)MouseRate;
+			result[index].left = (int)((ViewWidth - 1) * (0.5 + 0.5 * std::sin(time * 1.3)));
+			result[index].top = (int)((ViewHeight - 1) * (0.5 + 0.5 * std::sin(time * 1.7 + 0.5)));
+		}
+		return result;
+	}
+
+	class EventCounter
+	{
+	public:
+		EventCounter() :
+			mCount(0)
+		{
+		}
+
+		void notifyMouseMove(MyGUI::Widget* _sender, int _left, int _top)
+		{
+			++ mCount;
+		}
+
+		void notifyMouseDrag(MyGUI::Widget* _sender, int _left, int _top, MyGUI::MouseButton _id)
+		{
+			++ mCount;
+		}
+
+		void notifyMouseSetFocus(MyGUI::Widget* _sender, MyGUI::Widget* _old)
+		{
+			++ mCount;
+		}
+
+		size_t mCount;
+	};
+
+	void runTrace(const VectorMouseSample& _trace, bool _coalescing)
+	{
+		unittest::HeadlessGui gui(ViewWidth, ViewHeight);
+		gui.loadBoxSkin();
+
+		// grid of cells with an inner widget, every widget listens to mouse
+		EventCounter counter;
+		for (int top = 0; top < ViewHeight; top += CellSize)
+		{
+			for (int left = 0; left < ViewWidth; left += CellSize)
+			{
+				MyGUI::Widget* cell = gui.getGui()->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(left, top, CellSize, CellSize), MyGUI::Align::Default, "Main");
+				MyGUI::Widget* inner = cell->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(4, 4, CellSize - 8, CellSize - 8), MyGUI::Align::Stretch);
+				MyGUI::Widget* widgets[] = { cell, inner };
+				for (size_t index = 0; index < 2; ++index)
+				{
+					widgets[index]->eventMouseMove += MyGUI::newDelegate(&counter, &EventCounter::notifyMouseMove);
+					widgets[index]->eventMouseDrag += MyGUI::newDelegate(&counter, &EventCounter::notifyMouseDrag);
+					widgets[index]->eventMouseSetFocus += MyGUI::newDelegate(&counter, &EventCounter::notifyMouseSetFocus);
+				}
+			}
+		}
+
+		MyGUI::InputManager& input = MyGUI::InputManager::getInstance();
+		input.setMouseMoveCoalescing(_coalescing);
+		gui.getRenderManager()->drawOneFrame();
+		input.resetStatistics();
+
+		size_t frameCount = 0;
+		{
+			unittest::BenchmarkTimer timer(_coalescing ? "coalescing on, per frame" : "coalescing off, per frame", TraceLength * FrameRate / MouseRate);
+			size_t nextFrame = 0;
+			for (size_t index = 0; index < TraceLength; ++index)
+			{
+				const MouseSample& sample = _trace[index];
+				size_t phase = index % PressPeriod;
+				if (phase == 0)
+					input.injectMousePress(sample.left, sample.top, MyGUI::MouseButton::Left);
+				else if (phase == PressLength)
+					input.injectMouseRelease(sample.left, sample.top, MyGUI::MouseButton::Left);
+				else
+					input.injectMouseMove(sample.left, sample.top, 0);
+
+				if (index * FrameRate >= nextFrame * MouseRate)
+				{
+					gui.getRenderManager()->drawOneFrame();
+					++ nextFrame;
+					++ frameCount;
+				}
+			}
+		}
+
+		const MyGUI::InputManager::Statistics& statistics = input.getStatistics();
+		std::cout << "  " << frameCount << " frames, " << statistics.eventsReceived << " events received, " << statistics.eventsProcessed << " processed, "
+			<< statistics.picks << " picks, " << counter.mCount << " widget events" << std::endl;
+		unittest::consume(counter.mCount);
+	}
+
+} // namespace
+
+int main()
+{
+	VectorMouseSample trace = createTrace();
+	std::cout << "mouse trace " << MouseRate << " Hz replayed at " << FrameRate << " fps over " << (ViewWidth / CellSize) * (ViewHeight / CellSize) << " cells" << std::endl;
+	runTrace(trace, false);
+	runTrace(trace, true);
+	return 0;
+}
@@ -0,0 +1,79 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include "MyGUI_Thread.h"
+#include "FileSystemInfo/FileSystemIndex.h"
+#include <fstream>
+
+namespace
+{
+
+	const size_t RepeatCount = 5;
+
+	typedef std::map<std::string, std::string> MapFiles;
+
+	// files are named by file name like recursive resource locations, first file wins
+	void readFolder(const std::string& _folder, MapFiles& _files)
+	{
+		common::FileSystemIndex index;
+		index.addLocation(MyGUI::UString(_folder).asWStr(), true);
+		common::VectorWString paths;
+		index.find(paths, L"*", true);
+
+		for (common::VectorWString::const_iterator path = paths.begin(); path != paths.end(); ++path)
+		{
+			std::string file = MyGUI::UString(*path).asUTF8();
+			std::string name = file.substr(file.find_last_of("/\\") + 1);
+			if (_files.find(name) != _files.end())
+				continue;
+
+			std::ifstream stream(file.c_str(), std::ios_base::binary);
+			std::string& data = _files[name];
+			data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		}
+	}
+
+	// files are served from memory, so only parsing and creation of resources is timed
+	unsigned long loadCore(const MapFiles& _files, bool _parallel)
+	{
+		unittest::HeadlessGui gui;
+		// core list names several files that are not part of Media
+		MyGUI::LogManager::getInstance().setLoggingLevel(MyGUI::LogLevel::Critical);
+		for (MapFiles::const_iterator file = _files.begin(); file != _files.end(); ++file)
+			gui.getDataManager()->addData(file->first, file->second);
+
+		MyGUI::ResourceManager::getInstance().setParallelLoading(_parallel);
+
+		MyGUI::Timer timer;
+		timer.reset();
+		MyGUI::ResourceManager::getInstance().load("MyGUI_Core.xml");
+		return timer.getMilliseconds();
+	}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	// folder with resources, Media folder of MyGUI sources by default
+	std::string folder = argc > 1 ? argv[1] : unittest::getMediaFolder();
+
+	MapFiles files;
+	readFolder(folder, files);
+	// fonts of MyGUI_Fonts.xml that are not shipped with Media, loading of a missing font crashes
+	if (files.find("simhei.ttf") == files.end() && files.find("DejaVuSans.ttf") != files.end())
+		files["simhei.ttf"] = files["DejaVuSans.ttf"];
+	std::cout << files.size() << " files from '" << folder << "', " << MyGUI::Thread::getHardwareConcurrency() << " hardware threads" << std::endl;
+	std::cout << "MyGUI_Core.xml load time, " << RepeatCount << " runs" << std::endl;
+
+	for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+	{
+		unsigned long sequential = loadCore(files, false);
+		unsigned long parallel = loadCore(files, true);
+		std::cout << "  sequential " << sequential << " ms, parallel " << parallel << " ms" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include <cmath>
+
+namespace
+{
+
+	const size_t LineCount = 16;
+	const size_t PointCount = 1000;
+	const size_t FrameCount = 200;
+	const int GraphWidth = 1000;
+	const int GraphHeight = 40;
+
+	// scrolling graph, _amplitude above half of graph height makes line cropped by widget
+	void fillPoints(std::vector<MyGUI::FloatPoint>& _points, size_t _frame, float _amplitude)
+	{
+		_points.resize(LineCount * PointCount);
+		for (size_t line = 0; line < LineCount; ++line)
+		{
+			for (size_t index = 0; index < PointCount; ++index)
+			{
+				float x = (float)index * GraphWidth / PointCount;
+				float y = GraphHeight * 0.5f + _amplitude * std::sin((float)(index + _frame + line * 7) * 0.05f);
+				_points[line * PointCount + index].set(x, y);
+			}
+		}
+	}
+
+	MyGUI::PolygonalSkin* createGraph(int _top, int _height)
+	{
+		MyGUI::Widget* widget = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PolygonalSkin", MyGUI::IntCoord(10, _top, GraphWidth, _height), MyGUI::Align::Default, "Main");
+		MyGUI::PolygonalSkin* skin = widget->getSubWidgetMain()->castType<MyGUI::PolygonalSkin>();
+		skin->setWidth(2.0f);
+		return skin;
+	}
+
+	void runSeparateLines(const std::string& _name, float _amplitude)
+	{
+		unittest::HeadlessGui gui;
+		gui.loadBoxSkin("PolygonalSkin", "PolygonalSkin");
+
+		std::vector<MyGUI::PolygonalSkin*> graphs;
+		for (size_t line = 0; line < LineCount; ++line)
+			graphs.push_back(createGraph((int)line * GraphHeight, GraphHeight));
+
+		std::vector<MyGUI::FloatPoint> points;
+		size_t batches = 0;
+		{
+			unittest::BenchmarkTimer timer(_name, FrameCount);
+			for (size_t frame = 0; frame < FrameCount; ++frame)
+			{
+				fillPoints(points, frame, _amplitude);
+				for (size_t line = 0; line < LineCount; ++line)
+					graphs[line]->setPoints(&points[line * PointCount], PointCount);
+				gui.getRenderManager()->drawOneFrame();
+				batches = gui.getRenderManager()->getBatchCount();
+			}
+		}
+		std::cout << "  batches per frame: " << batches << std::endl;
+	}
+
+	void runBatchedLines(const std::string& _name, float _amplitude)
+	{
+		unittest::HeadlessGui gui;
+		gui.loadBoxSkin("PolygonalSkin", "PolygonalSkin");
+
+		// all lines in one widget, each line is shifted down inside it
+		MyGUI::PolygonalSkin* graph = createGraph(0, (int)LineCount * GraphHeight);
+		std::vector<size_t> sizes(LineCount, PointCount);
+
+		std::vector<MyGUI::FloatPoint> points;
+		size_t batches = 0;
+		{
+			unittest::BenchmarkTimer timer(_name, FrameCount);
+			for (size_t frame = 0; frame < FrameCount; ++frame)
+			{
+				fillPoints(points, frame, _amplitude);
+				for (size_t index = 0; index < points.size(); ++index)
+					points[index].top += (float)(index / PointCount) * GraphHeight;
+				graph->setLines(&points[0], &sizes[0], LineCount);
+				gui.getRenderManager()->drawOneFrame();
+				batches = gui.getRenderManager()->getBatchCount();
+			}
+		}
+		std::cout << "  batches per frame: " << batches << std::endl;
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << LineCount << " lines of " << PointCount << " points changed every frame, time per frame" << std::endl;
+	runSeparateLines("widget per line", GraphHeight * 0.4f);
+	runSeparateLines("widget per line, cropped", GraphHeight * 0.8f);
+	runBatchedLines("one widget with setLines", GraphHeight * 0.4f);
+	return 0;
+}
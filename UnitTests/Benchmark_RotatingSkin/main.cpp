@@ -0,0 +1,77 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+
+namespace
+{
+
+	const char* ResourcesXml =
+		"<MyGUI type=\"Resource\" version=\"1.1\">"
+		"<Resource type=\"ResourceSkin\" name=\"PanelEmpty\" size=\"16 16\"/>"
+		"</MyGUI>";
+
+	const int IconCount = 5000;
+	const int IconSize = 32;
+	const size_t FrameCount = 200;
+
+	typedef std::vector<MyGUI::RotatingSkin*> VectorRotatingSkin;
+
+	// _clipSize smaller than icon puts every icon into its own clipping parent
+	void createIcons(VectorRotatingSkin& _icons, int _clipSize)
+	{
+		MyGUI::Gui& gui = MyGUI::Gui::getInstance();
+		const int columns = 100;
+		for (int index = 0; index < IconCount; ++index)
+		{
+			MyGUI::IntCoord coord((index % columns) * 10, (index / columns) * 14, IconSize, IconSize);
+			MyGUI::ImageBox* image = nullptr;
+			if (_clipSize < IconSize)
+			{
+				MyGUI::Widget* parent = gui.createWidget<MyGUI::Widget>("PanelEmpty", MyGUI::IntCoord(coord.left, coord.top, _clipSize, _clipSize), MyGUI::Align::Default, "Main");
+				image = parent->createWidget<MyGUI::ImageBox>("RotatingSkin", MyGUI::IntCoord(0, 0, IconSize, IconSize), MyGUI::Align::Default);
+			}
+			else
+			{
+				image = gui.createWidget<MyGUI::ImageBox>("RotatingSkin", coord, MyGUI::Align::Default, "Main");
+			}
+			_icons.push_back(image->getSubWidgetMain()->castType<MyGUI::RotatingSkin>());
+		}
+	}
+
+	// every icon gets new angle and rebuilds its geometry each frame
+	void rotateIcons(unittest::HeadlessGui& _gui, const VectorRotatingSkin& _icons, const std::string& _name)
+	{
+		unittest::BenchmarkTimer timer(_name, FrameCount);
+		for (size_t frame = 0; frame < FrameCount; ++frame)
+		{
+			for (size_t index = 0; index < _icons.size(); ++index)
+				_icons[index]->setAngle((float)(frame + index) * 0.01f);
+			_gui.getRenderManager()->drawOneFrame();
+		}
+	}
+
+	void runBenchmark(int _clipSize, const std::string& _name)
+	{
+		unittest::HeadlessGui gui;
+		gui.loadResources(ResourcesXml);
+		gui.loadBoxSkin("RotatingSkin", "RotatingSkin");
+
+		VectorRotatingSkin icons;
+		createIcons(icons, _clipSize);
+		gui.getRenderManager()->drawOneFrame();
+
+		rotateIcons(gui, icons, _name);
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << IconCount << " rotating icons, time per frame" << std::endl;
+	runBenchmark(IconSize, "top level");
+	runBenchmark(IconSize / 2, "cropped by parent");
+	return 0;
+}
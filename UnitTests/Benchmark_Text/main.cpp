@@ -0,0 +1,78 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+
+namespace
+{
+
+	const size_t TextCount = 10000;
+	const size_t FrameCount = 20;
+
+	// manual font with 8x16 glyphs for printable ascii
+	std::string getResourcesXml()
+	{
+		std::string xml =
+			"<MyGUI type=\"Resource\" version=\"1.1\">"
+			"<Resource type=\"ResourceManualFont\" name=\"Font\">"
+			"<Property key=\"Source\" value=\"Font.png\"/>"
+			"<Property key=\"DefaultHeight\" value=\"16\"/>"
+			"<Codes>"
+			"<Code index=\"cursor\" coord=\"0 0 2 16\"/>"
+			"<Code index=\"selected\" coord=\"0 0 8 16\"/>"
+			"<Code index=\"selected_back\" coord=\"0 0 8 16\"/>"
+			"<Code index=\"substitute\" coord=\"0 0 8 16\"/>";
+		for (int code = 32; code < 127; ++code)
+		{
+			int index = code - 32;
+			xml += MyGUI::utility::toString("<Code index=\"", code, "\" coord=\"", (index % 32) * 8, " ", (index / 32) * 16, " 8 16\"/>");
+		}
+		xml +=
+			"</Codes>"
+			"</Resource>"
+			"<Resource type=\"ResourceSkin\" name=\"TextBox\" size=\"16 16\">"
+			"<BasisSkin type=\"EditText\" offset=\"0 0 16 16\" align=\"Stretch\"/>"
+			"</Resource>"
+			"</MyGUI>";
+		return xml;
+	}
+
+	void runCaptions(const std::string& _name, const std::string& _prefix, const std::string& _separator)
+	{
+		unittest::HeadlessGui gui;
+		MyGUI::RenderManager::getInstance().createTexture("Font.png")->createManual(256, 64, MyGUI::TextureUsage::Static | MyGUI::TextureUsage::Write, MyGUI::PixelFormat::R8G8B8A8);
+		gui.loadResources(getResourcesXml());
+
+		std::vector<MyGUI::TextBox*> texts;
+		for (size_t index = 0; index < TextCount; ++index)
+		{
+			// 4 x 48 slots fill the screen, labels overlap so all of them stay visible
+			MyGUI::IntCoord coord((int)(index % 4) * 250, (int)(index / 4 % 48) * 16, 250, 16);
+			MyGUI::TextBox* text = gui.getGui()->createWidget<MyGUI::TextBox>("TextBox", coord, MyGUI::Align::Default, "Main");
+			text->setFontName("Font");
+			texts.push_back(text);
+		}
+
+		unittest::BenchmarkTimer timer(_name, FrameCount);
+		for (size_t frame = 0; frame < FrameCount; ++frame)
+		{
+			for (size_t index = 0; index < texts.size(); ++index)
+			{
+				std::string value = MyGUI::utility::toString(frame * 1000 + index);
+				texts[index]->setCaption(_prefix + "Score: " + value + _separator + "Time: " + value);
+			}
+			gui.getRenderManager()->drawOneFrame();
+		}
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << TextCount << " captions changed every frame, time per frame" << std::endl;
+	runCaptions("plain captions", "", "  ");
+	runCaptions("coloured captions", "#FFFF00", "  #00FF00");
+	return 0;
+}
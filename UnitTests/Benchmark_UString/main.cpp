@@ -0,0 +1,77 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_UString.h"
+
+namespace
+{
+
+	const size_t IterationCount = 1000000;
+
+	void runConversions(const std::string& _name, const std::string& _utf8)
+	{
+		MyGUI::UString text;
+		{
+			unittest::BenchmarkTimer timer(_name + ", assign(std::string)", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				text.assign(_utf8);
+				unittest::consume(text.size());
+			}
+		}
+		{
+			unittest::BenchmarkTimer timer(_name + ", assign(const char*)", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				text.assign(_utf8.c_str());
+				unittest::consume(text.size());
+			}
+		}
+		{
+			// caption set from UTF-8 and read back, as setCaption()/getCaption() do
+			unittest::BenchmarkTimer timer(_name + ", assign + asUTF8", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				text.assign(_utf8);
+				unittest::consume(text.asUTF8().size());
+			}
+		}
+		{
+			unittest::BenchmarkTimer timer(_name + ", asUTF8", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				// changing one code point drops cached conversions
+				text[0] = (MyGUI::UString::code_point)('A' + index % 26);
+				unittest::consume(text.asUTF8().size());
+			}
+		}
+		{
+			unittest::BenchmarkTimer timer(_name + ", asUTF32", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				text[0] = (MyGUI::UString::code_point)('A' + index % 26);
+				unittest::consume(text.asUTF32().size());
+			}
+		}
+		{
+			unittest::BenchmarkTimer timer(_name + ", asWStr", IterationCount);
+			for (size_t index = 0; index < IterationCount; ++index)
+			{
+				text[0] = (MyGUI::UString::code_point)('A' + index % 26);
+				unittest::consume(text.asWStr().size());
+			}
+		}
+	}
+
+} // namespace
+
+int main()
+{
+	std::cout << "UString conversions of short captions, time per conversion" << std::endl;
+	runConversions("ascii", "Score: 12345  Time: 01:23  Lives");
+	// two byte characters mixed with ascii ones
+	runConversions("cyrillic", "\xD0\x9E\xD1\x87\xD0\xBA\xD0\xB8: 12345  \xD0\x92\xD1\x80\xD0\xB5\xD0\xBC\xD1\x8F: 01:23 \xD0\x96\xD0\xB8\xD0\xB7\xD0\xBD\xD0\xB8");
+	return 0;
+}
@@ -0,0 +1,97 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_VertexUtility.h"
+#include <cstdlib>
+
+namespace
+{
+
+	using MyGUI::vertex_utility::QuadInfo;
+	using MyGUI::vertex_utility::QuadTransform;
+
+	typedef std::vector<QuadInfo> VectorQuadInfo;
+	typedef std::vector<MyGUI::VertexQuad> VectorVertexQuad;
+
+	// about one screen of text glyphs
+	const size_t QuadCount = 4000;
+	const size_t RepeatCount = 2000;
+
+	VectorQuadInfo createQuads()
+	{
+		VectorQuadInfo result(QuadCount);
+		for (size_t index = 0; index < QuadCount; ++index)
+		{
+			float left = (float)(index % 100) * 8.0f;
+			float top = (float)(index / 100) * 16.0f;
+			result[index].vertex.set(left, top, left + 8.0f, top + 16.0f);
+			result[index].texture.set(0.1f, 0.2f, 0.15f, 0.3f);
+			result[index].colour = 0xFF000000 | (MyGUI::uint32)rand();
+		}
+		return result;
+	}
+
+} // namespace
+
+int main()
+{
+	VectorQuadInfo quads = createQuads();
+	VectorVertexQuad vertex(QuadCount);
+
+	MyGUI::RenderTargetInfo info;
+	info.pixScaleX = 1.0f / 800.0f;
+	info.pixScaleY = 1.0f / 600.0f;
+	QuadTransform transform(info, 10.0f, 20.0f);
+
+	std::cout << QuadCount << " quads, time per quad" << std::endl;
+
+	// the way skins wrote verticies before, one VertexQuad::set per quad
+	{
+		unittest::BenchmarkTimer timer("VertexQuad::set", QuadCount * RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+		{
+			float depth = (float)repeat;
+			for (size_t index = 0; index < QuadCount; ++index)
+			{
+				const QuadInfo& quad = quads[index];
+				vertex[index].set(
+					quad.vertex.left * transform.scaleX + transform.offsetX,
+					quad.vertex.top * transform.scaleY + transform.offsetY,
+					quad.vertex.right * transform.scaleX + transform.offsetX,
+					quad.vertex.bottom * transform.scaleY + transform.offsetY,
+					depth,
+					quad.texture.left,
+					quad.texture.top,
+					quad.texture.right,
+					quad.texture.bottom,
+					quad.colour);
+			}
+			unittest::consume((size_t)vertex[repeat % QuadCount].vertex[0].z);
+		}
+	}
+
+	{
+		unittest::BenchmarkTimer timer("writeQuads", QuadCount * RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+		{
+			MyGUI::vertex_utility::writeQuads(vertex[0].vertex, &quads[0], QuadCount, (float)repeat, transform);
+			unittest::consume((size_t)vertex[repeat % QuadCount].vertex[0].z);
+		}
+	}
+
+	{
+		unittest::BenchmarkTimer timer("QuadWriter", QuadCount * RepeatCount);
+		for (size_t repeat = 0; repeat < RepeatCount; ++repeat)
+		{
+			MyGUI::vertex_utility::QuadWriter writer(vertex[0].vertex, (float)repeat, transform);
+			for (size_t index = 0; index < QuadCount; ++index)
+				writer.add(quads[index].vertex, quads[index].texture, quads[index].colour);
+			writer.flush();
+			unittest::consume(writer.getVertexCount());
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#ifndef __CONSOLE_TEST_H__
+#define __CONSOLE_TEST_H__
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Timer.h"
+#include <iostream>
+
+namespace unittest
+{
+
+	/** Number of failed checks, console tests return it from main. */
+	inline int& getFailedCount()
+	{
+		static int count = 0;
+		return count;
+	}
+
+	inline void checkFailed(const char* _expression, const char* _file, int _line)
+	{
+		std::cout << _file << "(" << _line << "): check failed: " << _expression << std::endl;
+		++ getFailedCount();
+	}
+
+	inline int getResult(const char* _name)
+	{
+		if (getFailedCount() == 0)
+			std::cout << _name << ": all checks passed" << std::endl;
+		else
+			std::cout << _name << ": " << getFailedCount() << " checks failed" << std::endl;
+		return getFailedCount() == 0 ? 0 : 1;
+	}
+
+	/** Prints wall time of the scope and time of one iteration when destroyed. */
+	class BenchmarkTimer
+	{
+	public:
+		BenchmarkTimer(const std::string& _name, size_t _iterations) :
+			mName(_name),
+			mIterations(_iterations)
+		{
+			mTimer.reset();
+		}
+
+		~BenchmarkTimer()
+		{
+			unsigned long time = mTimer.getMilliseconds();
+			double perIteration = mIterations != 0 ? (double)time * 1000.0 / (double)mIterations : 0;
+			std::cout << mName << ": " << time << " ms, " << perIteration << " us per iteration" << std::endl;
+		}
+
+	private:
+		std::string mName;
+		size_t mIterations;
+		MyGUI::Timer mTimer;
+	};
+
+	/** Media folder of MyGUI sources, benchmarks that read real resources use it by default. */
+	inline std::string getMediaFolder()
+	{
+#ifdef MYGUI_MEDIA_FOLDER
+		return MYGUI_MEDIA_FOLDER;
+#else
+		return "../../Media";
+#endif
+	}
+
+	/** Keeps benchmark results alive so that the compiler can't drop the measured work. */
+	inline void consume(size_t _value)
+	{
+		static volatile size_t sink = 0;
+		sink += _value;
+	}
+
+} // namespace unittest
+
+#define UNITTEST_CHECK(expression) \
+	do \
+	{ \
+		if (!(expression)) \
+			unittest::checkFailed(#expression, __FILE__, __LINE__); \
+	} while (false)
+
+#endif // __CONSOLE_TEST_H__
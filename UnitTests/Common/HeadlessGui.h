@@ -0,0 +1,158 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#ifndef __HEADLESS_GUI_H__
+#define __HEADLESS_GUI_H__
+
+#include "MyGUI.h"
+#include "MyGUI_DataManager.h"
+#include "MyGUI_DataMemoryStream.h"
+#include "MyGUI_DummyRenderManager.h"
+
+namespace unittest
+{
+
+	/** Data manager that serves data added from memory, masks are not supported. */
+	class MemoryDataManager :
+		public MyGUI::DataManager
+	{
+	public:
+		void addData(const std::string& _name, const std::string& _data)
+		{
+			mData[_name] = _data;
+		}
+
+		virtual MyGUI::IDataStream* getData(const std::string& _name)
+		{
+			MapData::iterator item = mData.find(_name);
+			if (item == mData.end())
+				return nullptr;
+			return new MyGUI::DataMemoryStream((unsigned char*)item->second.data(), item->second.size());
+		}
+
+		virtual void freeData(MyGUI::IDataStream* _data)
+		{
+			delete _data;
+		}
+
+		virtual bool isDataExist(const std::string& _name)
+		{
+			return mData.find(_name) != mData.end();
+		}
+
+		virtual const MyGUI::VectorString& getDataListNames(const std::string& _pattern)
+		{
+			mDataListNames.clear();
+			if (isDataExist(_pattern))
+				mDataListNames.push_back(_pattern);
+			return mDataListNames;
+		}
+
+		virtual const std::string& getDataPath(const std::string& _name)
+		{
+			return mDataPath;
+		}
+
+	private:
+		typedef std::map<std::string, std::string> MapData;
+		MapData mData;
+		MyGUI::VectorString mDataListNames;
+		std::string mDataPath;
+	};
+
+	/** Gui on the Dummy render system with "Main" overlapped layer, warnings go to the console.
+		@param _renderManager Render manager to use instead of DummyRenderManager, HeadlessGui deletes it
+	*/
+	class HeadlessGui
+	{
+	public:
+		HeadlessGui(int _width = 1024, int _height = 768, MyGUI::DummyRenderManager* _renderManager = nullptr) :
+			mLogManager(nullptr),
+			mRenderManager(nullptr),
+			mDataManager(nullptr),
+			mGui(nullptr),
+			mResourceIndex(0)
+		{
+			mLogManager = new MyGUI::LogManager();
+			mLogManager->setLoggingLevel(MyGUI::LogLevel::Warning);
+			mLogManager->createDefaultSource("");
+
+			mRenderManager = _renderManager != nullptr ? _renderManager : new MyGUI::DummyRenderManager();
+			mDataManager = new MemoryDataManager();
+			mRenderManager->initialise();
+			mRenderManager->setViewSize(_width, _height);
+
+			mGui = new MyGUI::Gui();
+			mGui->initialise("");
+
+			loadResources(
+				"<MyGUI type=\"Layer\" version=\"1.2\">"
+				"<Layer type=\"OverlappedLayer\" name=\"Main\"><Property key=\"Pick\" value=\"true\"/></Layer>"
+				"</MyGUI>");
+		}
+
+		~HeadlessGui()
+		{
+			mGui->shutdown();
+			delete mGui;
+
+			mRenderManager->shutdown();
+			delete mRenderManager;
+			delete mDataManager;
+			delete mLogManager;
+		}
+
+		/** Load resources from xml text, the same way as ResourceManager::load. */
+		bool loadResources(const std::string& _xml)
+		{
+			std::string name = "headless_" + MyGUI::utility::toString(mResourceIndex ++) + ".xml";
+			mDataManager->addData(name, _xml);
+			return MyGUI::ResourceManager::getInstance().load(name);
+		}
+
+		/** Load skin of one 16x16 state with its own texture _name + ".png".
+			Dummy textures are not loaded from files, so texture is created empty with createManual.
+			@param _basisType Type of sub widget of skin: SubSkin, MainSkin, PolygonalSkin, RotatingSkin
+		*/
+		bool loadBoxSkin(const std::string& _name = "Box", const std::string& _basisType = "SubSkin")
+		{
+			std::string texture = _name + ".png";
+			mRenderManager->createTexture(texture)->createManual(16, 16, MyGUI::TextureUsage::Static | MyGUI::TextureUsage::Write, MyGUI::PixelFormat::R8G8B8A8);
+
+			return loadResources(
+				"<MyGUI type=\"Resource\" version=\"1.1\">"
+				"<Resource type=\"ResourceSkin\" name=\"" + _name + "\" size=\"16 16\" texture=\"" + texture + "\">"
+				"<BasisSkin type=\"" + _basisType + "\" offset=\"0 0 16 16\" align=\"Stretch\">"
+				"<State name=\"normal\" offset=\"0 0 16 16\"/>"
+				"</BasisSkin>"
+				"</Resource>"
+				"</MyGUI>");
+		}
+
+		MyGUI::Gui* getGui()
+		{
+			return mGui;
+		}
+
+		MyGUI::DummyRenderManager* getRenderManager()
+		{
+			return mRenderManager;
+		}
+
+		MemoryDataManager* getDataManager()
+		{
+			return mDataManager;
+		}
+
+	private:
+		MyGUI::LogManager* mLogManager;
+		MyGUI::DummyRenderManager* mRenderManager;
+		MemoryDataManager* mDataManager;
+		MyGUI::Gui* mGui;
+		size_t mResourceIndex;
+	};
+
+} // namespace unittest
+
+#endif // __HEADLESS_GUI_H__
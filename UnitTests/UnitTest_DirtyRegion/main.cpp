@@ -0,0 +1,216 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include "MyGUI_DirtyRegion.h"
+#include <algorithm>
+
+namespace
+{
+
+	bool hasRect(const MyGUI::DirtyRegion& _region, const MyGUI::IntRect& _rect)
+	{
+		const MyGUI::DirtyRegion::VectorIntRect& rects = _region.getRects();
+		return std::find(rects.begin(), rects.end(), _rect) != rects.end();
+	}
+
+	// true if some rectangle of region contains _rect
+	bool isCovered(const MyGUI::DirtyRegion& _region, const MyGUI::IntRect& _rect)
+	{
+		const MyGUI::DirtyRegion::VectorIntRect& rects = _region.getRects();
+		for (MyGUI::DirtyRegion::VectorIntRect::const_iterator item = rects.begin(); item != rects.end(); ++item)
+		{
+			if (item->left <= _rect.left && item->top <= _rect.top && item->right >= _rect.right && item->bottom >= _rect.bottom)
+				return true;
+		}
+		return false;
+	}
+
+	void testRegion()
+	{
+		const MyGUI::IntSize view(800, 600);
+		MyGUI::DirtyRegion region;
+		UNITTEST_CHECK(region.empty());
+		UNITTEST_CHECK(!region.isFull());
+		UNITTEST_CHECK(!region.intersect(MyGUI::IntRect(0, 0, 800, 600)));
+
+		// rectangles without area are ignored
+		region.addRect(MyGUI::IntRect(5, 5, 5, 9));
+		region.addRect(MyGUI::IntRect(5, 9, 8, 5));
+		UNITTEST_CHECK(region.empty());
+
+		// overlapping and touching rectangles are merged, distant ones are kept apart
+		region.addRect(MyGUI::IntRect(10, 10, 20, 20));
+		region.addRect(MyGUI::IntRect(15, 15, 30, 30));
+		region.addRect(MyGUI::IntRect(30, 10, 40, 20));
+		region.addRect(MyGUI::IntRect(500, 500, 510, 510));
+		UNITTEST_CHECK(region.getRects().size() == 2);
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(10, 10, 40, 30)));
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(500, 500, 510, 510)));
+
+		// edges are exclusive
+		UNITTEST_CHECK(region.intersect(MyGUI::IntRect(39, 29, 50, 50)));
+		UNITTEST_CHECK(!region.intersect(MyGUI::IntRect(40, 0, 50, 50)));
+		UNITTEST_CHECK(!region.intersect(MyGUI::IntRect(0, 30, 50, 50)));
+
+		// optimise crops to view and drops rectangles outside of it
+		region.addRect(MyGUI::IntRect(-5, 200, 3, 210));
+		region.addRect(MyGUI::IntRect(900, 100, 950, 150));
+		region.optimise(view);
+		UNITTEST_CHECK(!region.isFull());
+		UNITTEST_CHECK(region.getRects().size() == 3);
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(0, 200, 3, 210)));
+
+		// nothing is added to full region
+		region.setFull();
+		UNITTEST_CHECK(region.isFull());
+		UNITTEST_CHECK(!region.empty());
+		UNITTEST_CHECK(region.intersect(MyGUI::IntRect(1, 1, 2, 2)));
+		region.addRect(MyGUI::IntRect(10, 10, 20, 20));
+		region.optimise(view);
+		UNITTEST_CHECK(region.getRects().size() == 1);
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(0, 0, 800, 600)));
+
+		region.clear();
+		UNITTEST_CHECK(region.empty());
+		UNITTEST_CHECK(!region.isFull());
+
+		// region becomes full when 3/4 of view changed
+		region.addRect(MyGUI::IntRect(0, 0, 800, 400));
+		region.optimise(view);
+		UNITTEST_CHECK(!region.isFull());
+		region.clear();
+		region.addRect(MyGUI::IntRect(0, 0, 800, 450));
+		region.optimise(view);
+		UNITTEST_CHECK(region.isFull());
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(0, 0, 800, 600)));
+
+		// count of rectangles is limited, above the limit they are merged to bounding one
+		region.clear();
+		UNITTEST_CHECK(region.getMaxRectCount() == 8);
+		for (int index = 0; index < 8; ++index)
+			region.addRect(MyGUI::IntRect(index * 30, 0, index * 30 + 10, 10));
+		UNITTEST_CHECK(region.getRects().size() == 8);
+		region.addRect(MyGUI::IntRect(0, 100, 10, 110));
+		UNITTEST_CHECK(region.getRects().size() == 1);
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(0, 0, 220, 110)));
+
+		for (int index = 0; index < 1000; ++index)
+		{
+			region.addRect(MyGUI::IntRect((index * 37) % 790, (index * 53) % 590, (index * 37) % 790 + 5, (index * 53) % 590 + 5));
+			UNITTEST_CHECK(region.getRects().size() <= region.getMaxRectCount());
+		}
+
+		// lower limit merges existing rectangles at once
+		region.clear();
+		region.addRect(MyGUI::IntRect(0, 0, 10, 10));
+		region.addRect(MyGUI::IntRect(100, 0, 110, 10));
+		region.addRect(MyGUI::IntRect(200, 0, 210, 10));
+		region.setMaxRectCount(2);
+		UNITTEST_CHECK(region.getRects().size() == 1);
+		UNITTEST_CHECK(hasRect(region, MyGUI::IntRect(0, 0, 210, 10)));
+		region.setMaxRectCount(0);
+		UNITTEST_CHECK(region.getMaxRectCount() == 1);
+
+		UNITTEST_CHECK(MyGUI::DirtyRegion::combine(MyGUI::IntRect(), MyGUI::IntRect(1, 2, 3, 4)) == MyGUI::IntRect(1, 2, 3, 4));
+		UNITTEST_CHECK(MyGUI::DirtyRegion::combine(MyGUI::IntRect(1, 2, 3, 4), MyGUI::IntRect(5, 5, 5, 9)) == MyGUI::IntRect(1, 2, 3, 4));
+		UNITTEST_CHECK(MyGUI::DirtyRegion::combine(MyGUI::IntRect(1, 2, 3, 4), MyGUI::IntRect(0, 3, 2, 8)) == MyGUI::IntRect(0, 2, 3, 8));
+	}
+
+	// platform that can't keep previous frame
+	class FullRedrawRenderManager :
+		public MyGUI::DummyRenderManager
+	{
+	public:
+		virtual bool isPartialRedrawSupported() const
+		{
+			return false;
+		}
+	};
+
+	void testUnsupported()
+	{
+		unittest::HeadlessGui gui(800, 600, new FullRedrawRenderManager());
+		MyGUI::LayerManager& layers = MyGUI::LayerManager::getInstance();
+		layers.setPartialRedraw(true);
+		UNITTEST_CHECK(!layers.getPartialRedraw());
+	}
+
+	// every top level widget of overlapped layer has its own render item, so each of them is one batch
+	void testPartialRedraw()
+	{
+		unittest::HeadlessGui gui(800, 600);
+		gui.loadBoxSkin();
+
+		const size_t count = 10;
+		std::vector<MyGUI::Widget*> widgets;
+		for (size_t index = 0; index < count; ++index)
+			widgets.push_back(gui.getGui()->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord((int)index * 70, 10, 50, 50), MyGUI::Align::Default, "Main"));
+
+		MyGUI::LayerManager& layers = MyGUI::LayerManager::getInstance();
+		MyGUI::DummyRenderManager* render = gui.getRenderManager();
+		layers.setPartialRedraw(true);
+		UNITTEST_CHECK(layers.getPartialRedraw());
+
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == count);
+		UNITTEST_CHECK(layers.getDirtyRegion().isFull());
+
+		// nothing changed, frame is skipped
+		size_t skipped = render->getSkippedFrameCount();
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getSkippedFrameCount() == skipped + 1);
+		UNITTEST_CHECK(render->getBatchCount() == 0);
+
+		// moved widget is redrawn at both places, other widgets are kept
+		widgets[0]->setPosition(0, 100);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 1);
+		UNITTEST_CHECK(!layers.getDirtyRegion().isFull());
+		UNITTEST_CHECK(isCovered(layers.getDirtyRegion(), MyGUI::IntRect(0, 10, 50, 60)));
+		UNITTEST_CHECK(isCovered(layers.getDirtyRegion(), MyGUI::IntRect(0, 100, 50, 150)));
+		UNITTEST_CHECK(!layers.getDirtyRegion().intersect(widgets[1]->getAbsoluteRect()));
+
+		// widget under changed one is redrawn too
+		widgets[3]->setPosition(widgets[2]->getLeft() + 20, widgets[2]->getTop());
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 2);
+
+		widgets[5]->setAlpha(0.5f);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 1);
+		UNITTEST_CHECK(isCovered(layers.getDirtyRegion(), widgets[5]->getAbsoluteRect()));
+
+		// hidden widget leaves its rectangle dirty, nothing else is drawn there
+		widgets[7]->setVisible(false);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 0);
+		UNITTEST_CHECK(isCovered(layers.getDirtyRegion(), widgets[7]->getAbsoluteRect()));
+		UNITTEST_CHECK(render->getSkippedFrameCount() == skipped + 1);
+
+		// without partial redraw changed frame draws everything
+		layers.setPartialRedraw(false);
+		widgets[0]->setPosition(0, 200);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == count - 1);
+		UNITTEST_CHECK(!layers.getDirtyRegion().isFull());
+
+		// resize of view redraws everything
+		layers.setPartialRedraw(true);
+		render->setViewSize(1024, 768);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == count - 1);
+		UNITTEST_CHECK(layers.getDirtyRegion().isFull());
+	}
+
+} // namespace
+
+int main()
+{
+	testRegion();
+	testUnsupported();
+	testPartialRedraw();
+	return unittest::getResult("UnitTest_DirtyRegion");
+}
@@ -0,0 +1,151 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_TextureUtility.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+
+	typedef std::vector<MyGUI::uint8> VectorByte;
+
+	// exact distance to the nearest pixel of other kind, same mapping as generateDistanceField
+	void generateReference(const VectorByte& _source, int _width, int _height, VectorByte& _dest, int _spread)
+	{
+		int destWidth = _width + _spread * 2;
+		int destHeight = _height + _spread * 2;
+		VectorByte coverage(destWidth * destHeight, 0);
+		for (int y = 0; y < _height; ++y)
+		{
+			for (int x = 0; x < _width; ++x)
+				coverage[(y + _spread) * destWidth + x + _spread] = _source[y * _width + x];
+		}
+
+		float scale = 127.5f / (float)_spread;
+		_dest.resize(coverage.size());
+		for (int y = 0; y < destHeight; ++y)
+		{
+			for (int x = 0; x < destWidth; ++x)
+			{
+				MyGUI::uint8 value = coverage[y * destWidth + x];
+				bool inside = value >= 128;
+
+				float nearest = 1e9f;
+				for (int otherY = 0; otherY < destHeight; ++otherY)
+				{
+					for (int otherX = 0; otherX < destWidth; ++otherX)
+					{
+						if ((coverage[otherY * destWidth + otherX] >= 128) != inside)
+							nearest = std::min(nearest, (float)((otherX - x) * (otherX - x) + (otherY - y) * (otherY - y)));
+					}
+				}
+
+				float distance;
+				if (value != 0 && value != 255)
+					distance = (float)value / 255.0f - 0.5f;
+				else if (inside)
+					distance = std::sqrt(nearest) - 0.5f;
+				else
+					distance = 0.5f - std::sqrt(nearest);
+
+				float field = 127.5f + distance * scale;
+				_dest[y * destWidth + x] = (MyGUI::uint8)(field < 0.0f ? 0.0f : (field > 255.0f ? 255.0f : field + 0.5f));
+			}
+		}
+	}
+
+	// 8SSEDT propagates nearest seed from neighbours, it can miss exact nearest pixel by a small fraction of pixel
+	int checkShape(const std::string& _name, const VectorByte& _source, int _width, int _height, int _spread, int _tolerance, bool _print = true)
+	{
+		int destWidth = _width + _spread * 2;
+		int destHeight = _height + _spread * 2;
+		VectorByte result(destWidth * destHeight, 0xCD);
+		MyGUI::texture_utility::generateDistanceField(&_source[0], _width, _height, _width, &result[0], destWidth, destHeight, _spread);
+
+		VectorByte reference;
+		generateReference(_source, _width, _height, reference, _spread);
+
+		int maxDifference = 0;
+		for (size_t index = 0; index < result.size(); ++index)
+			maxDifference = std::max(maxDifference, std::abs((int)result[index] - (int)reference[index]));
+
+		if (_print)
+			std::cout << _name << ": max difference from exact field " << maxDifference << std::endl;
+		UNITTEST_CHECK(maxDifference <= _tolerance);
+		return maxDifference;
+	}
+
+	VectorByte createCircle(int _size, float _radius, bool _antialiased)
+	{
+		VectorByte result(_size * _size, 0);
+		float center = (float)_size * 0.5f;
+		for (int y = 0; y < _size; ++y)
+		{
+			for (int x = 0; x < _size; ++x)
+			{
+				float dx = (float)x + 0.5f - center;
+				float dy = (float)y + 0.5f - center;
+				float distance = _radius - std::sqrt(dx * dx + dy * dy);
+				float coverage = _antialiased ? std::max(0.0f, std::min(1.0f, distance + 0.5f)) : (distance >= 0.0f ? 1.0f : 0.0f);
+				result[y * _size + x] = (MyGUI::uint8)(coverage * 255.0f + 0.5f);
+			}
+		}
+		return result;
+	}
+
+} // namespace
+
+int main()
+{
+	const int spread = 4;
+	// one byte of field is 1/32 of pixel with spread 4
+	const int tolerance = 4;
+
+	VectorByte empty(16 * 16, 0);
+	checkShape("empty", empty, 16, 16, spread, 0);
+
+	VectorByte full(16 * 16, 255);
+	checkShape("full", full, 16, 16, spread, 0);
+
+	VectorByte rect(20 * 12, 0);
+	for (int y = 3; y < 9; ++y)
+		for (int x = 2; x < 17; ++x)
+			rect[y * 20 + x] = 255;
+	checkShape("rectangle", rect, 20, 12, spread, 0);
+
+	checkShape("circle", createCircle(24, 8.0f, false), 24, 24, spread, tolerance);
+	checkShape("antialiased circle", createCircle(24, 8.3f, true), 24, 24, spread, tolerance);
+
+	VectorByte ring = createCircle(32, 13.0f, false);
+	VectorByte hole = createCircle(32, 7.0f, false);
+	for (size_t index = 0; index < ring.size(); ++index)
+		ring[index] = hole[index] != 0 ? 0 : ring[index];
+	checkShape("ring", ring, 32, 32, spread, tolerance);
+	checkShape("large circle, spread 12", createCircle(48, 17.5f, true), 48, 48, 12, tolerance);
+
+	srand(1);
+	int noiseDifference = 0;
+	for (int shape = 0; shape < 20; ++shape)
+	{
+		VectorByte noise(16 * 16);
+		for (size_t index = 0; index < noise.size(); ++index)
+			noise[index] = (rand() % 3 == 0) ? 255 : 0;
+		noiseDifference = std::max(noiseDifference, checkShape(MyGUI::utility::toString("noise ", shape), noise, 16, 16, 8, tolerance, false));
+	}
+	std::cout << "random noise, spread 8: max difference from exact field " << noiseDifference << std::endl;
+
+	// edge of filled glyph is at the middle of the range, field far outside is zero
+	int width = 8 + spread * 2;
+	VectorByte glyph(8 * 8, 255);
+	VectorByte field(width * width);
+	MyGUI::texture_utility::generateDistanceField(&glyph[0], 8, 8, 8, &field[0], width, width, spread);
+	UNITTEST_CHECK(field[0] == 0);
+	UNITTEST_CHECK(std::abs((int)field[spread * width + spread] - 144) <= 1);
+	UNITTEST_CHECK(std::abs((int)field[spread * width + spread - 1] - 112) <= 1);
+
+	return unittest::getResult("UnitTest_DistanceField");
+}
@@ -0,0 +1,142 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include "MyGUI_ToolTipManager.h"
+
+namespace
+{
+
+	// delays are measured by real timer, so only their range is checked
+	const float KeyFirstDelay = 0.4f;
+
+	class FrameListener
+	{
+	public:
+		FrameListener() :
+			mCount(0)
+		{
+		}
+
+		void notifyFrameStart(float _time)
+		{
+			++ mCount;
+		}
+
+		size_t mCount;
+	};
+
+	bool isIdle(MyGUI::Gui* _gui)
+	{
+		return !_gui->isFrameRequired() && _gui->getNextFrameDelay() < 0.0f;
+	}
+
+	// Dummy counts frames without frame event and frames with nothing to draw
+	bool isFrameSkipped(MyGUI::DummyRenderManager* _render)
+	{
+		size_t skipped = _render->getSkippedFrameCount();
+		_render->drawOneFrame();
+		return _render->getSkippedFrameCount() == skipped + 1;
+	}
+
+} // namespace
+
+int main()
+{
+	unittest::HeadlessGui gui;
+	gui.loadBoxSkin();
+
+	MyGUI::Gui* myGui = gui.getGui();
+	MyGUI::DummyRenderManager* render = gui.getRenderManager();
+	MyGUI::InputManager& input = MyGUI::InputManager::getInstance();
+
+	MyGUI::Widget* widget = myGui->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(100, 100, 50, 50), MyGUI::Align::Default, "Main");
+	MyGUI::Widget* other = myGui->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(300, 100, 50, 50), MyGUI::Align::Default, "Main");
+
+	// new widgets and view size need a frame, then nothing happens
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	UNITTEST_CHECK(!isFrameSkipped(render));
+	UNITTEST_CHECK(isIdle(myGui));
+	UNITTEST_CHECK(isFrameSkipped(render));
+	UNITTEST_CHECK(isFrameSkipped(render));
+	UNITTEST_CHECK(render->getBatchCount() == 0);
+
+	// changed widget
+	widget->setPosition(110, 100);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	UNITTEST_CHECK(myGui->getNextFrameDelay() == 0.0f);
+	UNITTEST_CHECK(!isFrameSkipped(render));
+	UNITTEST_CHECK(isIdle(myGui));
+
+	// frame handler means animation, every frame is required
+	FrameListener listener;
+	myGui->eventFrameStart += MyGUI::newDelegate(&listener, &FrameListener::notifyFrameStart);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	render->drawOneFrame();
+	render->drawOneFrame();
+	UNITTEST_CHECK(listener.mCount == 2);
+	myGui->eventFrameStart -= MyGUI::newDelegate(&listener, &FrameListener::notifyFrameStart);
+	UNITTEST_CHECK(isIdle(myGui));
+	UNITTEST_CHECK(isFrameSkipped(render));
+
+	// delayed destruction
+	MyGUI::Widget* temporary = myGui->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(500, 100, 50, 50), MyGUI::Align::Default, "Main");
+	render->drawOneFrame();
+	UNITTEST_CHECK(isIdle(myGui));
+	MyGUI::WidgetManager::getInstance().destroyWidget(temporary);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	UNITTEST_CHECK(!isFrameSkipped(render));
+	UNITTEST_CHECK(isIdle(myGui));
+
+	// queued layout
+	MyGUI::WidgetManager::getInstance().setDeferredLayout(true);
+	other->setSize(60, 60);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	UNITTEST_CHECK(!isFrameSkipped(render));
+	UNITTEST_CHECK(other->getWidth() == 60);
+	UNITTEST_CHECK(isIdle(myGui));
+	MyGUI::WidgetManager::getInstance().setDeferredLayout(false);
+
+	// mouse move is input even if nothing is drawn after it
+	input.injectMouseMove(10, 10, 0);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	render->drawOneFrame();
+	UNITTEST_CHECK(isIdle(myGui));
+
+	// held key repeats after delay, frame is not required till then
+	input.setKeyFocusWidget(widget);
+	render->drawOneFrame();
+	input.injectKeyPress(MyGUI::KeyCode::A, 'a');
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	render->drawOneFrame();
+	float delay = myGui->getNextFrameDelay();
+	UNITTEST_CHECK(delay > 0.0f && delay <= KeyFirstDelay);
+	UNITTEST_CHECK(!myGui->isFrameRequired());
+	UNITTEST_CHECK(isFrameSkipped(render));
+	input.injectKeyRelease(MyGUI::KeyCode::A);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	render->drawOneFrame();
+	UNITTEST_CHECK(isIdle(myGui));
+	input.setKeyFocusWidget(nullptr);
+	render->drawOneFrame();
+
+	// tool tip waits for its delay after mouse focus change
+	MyGUI::ToolTipManager& toolTip = MyGUI::ToolTipManager::getInstance();
+	widget->setNeedToolTip(true);
+	input.injectMouseMove(120, 120, 0);
+	render->drawOneFrame();
+	UNITTEST_CHECK(input.getMouseFocusWidget() == widget);
+	delay = myGui->getNextFrameDelay();
+	UNITTEST_CHECK(delay > 0.0f && delay <= toolTip.getDelayVisible());
+	UNITTEST_CHECK(isFrameSkipped(render));
+
+	// tool tip is due once its delay passed
+	toolTip.setDelayVisible(0.0f);
+	UNITTEST_CHECK(myGui->isFrameRequired());
+	render->drawOneFrame();
+	UNITTEST_CHECK(isIdle(myGui));
+
+	return unittest::getResult("UnitTest_IdleFrame");
+}
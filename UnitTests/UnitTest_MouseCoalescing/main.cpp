@@ -0,0 +1,191 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+
+namespace
+{
+
+	/** Records events of widgets in order they come. */
+	class EventLog
+	{
+	public:
+		void subscribe(MyGUI::Widget* _widget)
+		{
+			_widget->eventMouseSetFocus += MyGUI::newDelegate(this, &EventLog::notifySetFocus);
+			_widget->eventMouseMove += MyGUI::newDelegate(this, &EventLog::notifyMove);
+			_widget->eventMouseDrag += MyGUI::newDelegate(this, &EventLog::notifyDrag);
+			_widget->eventMouseButtonPressed += MyGUI::newDelegate(this, &EventLog::notifyPressed);
+			_widget->eventMouseButtonReleased += MyGUI::newDelegate(this, &EventLog::notifyReleased);
+			_widget->eventMouseWheel += MyGUI::newDelegate(this, &EventLog::notifyWheel);
+			_widget->eventKeyButtonPressed += MyGUI::newDelegate(this, &EventLog::notifyKey);
+		}
+
+		std::string get()
+		{
+			std::string result = mLog;
+			mLog.clear();
+			return result;
+		}
+
+	private:
+		void add(MyGUI::Widget* _sender, const std::string& _event)
+		{
+			if (!mLog.empty())
+				mLog += " ";
+			mLog += _sender->getName() + "." + _event;
+		}
+
+		void notifySetFocus(MyGUI::Widget* _sender, MyGUI::Widget* _old)
+		{
+			add(_sender, "focus");
+		}
+
+		void notifyMove(MyGUI::Widget* _sender, int _left, int _top)
+		{
+			add(_sender, "move(" + MyGUI::utility::toString(_left, ",", _top) + ")");
+		}
+
+		void notifyDrag(MyGUI::Widget* _sender, int _left, int _top, MyGUI::MouseButton _id)
+		{
+			add(_sender, "drag(" + MyGUI::utility::toString(_left, ",", _top) + ")");
+		}
+
+		void notifyPressed(MyGUI::Widget* _sender, int _left, int _top, MyGUI::MouseButton _id)
+		{
+			add(_sender, "press");
+		}
+
+		void notifyReleased(MyGUI::Widget* _sender, int _left, int _top, MyGUI::MouseButton _id)
+		{
+			add(_sender, "release");
+		}
+
+		void notifyWheel(MyGUI::Widget* _sender, int _rel)
+		{
+			add(_sender, "wheel");
+		}
+
+		void notifyKey(MyGUI::Widget* _sender, MyGUI::KeyCode _key, MyGUI::Char _char)
+		{
+			add(_sender, "key");
+		}
+
+	private:
+		std::string mLog;
+	};
+
+	bool checkStatistics(size_t _received, size_t _processed, size_t _picks)
+	{
+		const MyGUI::InputManager::Statistics& statistics = MyGUI::InputManager::getInstance().getStatistics();
+		bool result = statistics.eventsReceived == _received && statistics.eventsProcessed == _processed && statistics.picks == _picks;
+		if (!result)
+			std::cout << "statistics: " << statistics.eventsReceived << " received, " << statistics.eventsProcessed << " processed, " << statistics.picks << " picks" << std::endl;
+		MyGUI::InputManager::getInstance().resetStatistics();
+		return result;
+	}
+
+} // namespace
+
+int main()
+{
+	unittest::HeadlessGui gui;
+	gui.loadBoxSkin();
+
+	MyGUI::Gui* myGui = gui.getGui();
+	MyGUI::DummyRenderManager* render = gui.getRenderManager();
+	MyGUI::InputManager& input = MyGUI::InputManager::getInstance();
+
+	MyGUI::Widget* left = myGui->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(100, 100, 100, 100), MyGUI::Align::Default, "Main", "left");
+	MyGUI::Widget* right = myGui->createWidget<MyGUI::Widget>("Box", MyGUI::IntCoord(300, 100, 100, 100), MyGUI::Align::Default, "Main", "right");
+
+	EventLog log;
+	log.subscribe(left);
+	log.subscribe(right);
+	render->drawOneFrame();
+
+	// disabled by default, every move is picked
+	UNITTEST_CHECK(!input.getMouseMoveCoalescing());
+	input.resetStatistics();
+	UNITTEST_CHECK(input.injectMouseMove(110, 110, 0));
+	UNITTEST_CHECK(input.injectMouseMove(120, 110, 0));
+	UNITTEST_CHECK(!input.injectMouseMove(250, 110, 0));
+	UNITTEST_CHECK(log.get() == "left.move(110,110) left.focus left.move(120,110)");
+	UNITTEST_CHECK(checkStatistics(3, 3, 3));
+
+	// moves are stored, nothing is picked before frame
+	input.setMouseMoveCoalescing(true);
+	UNITTEST_CHECK(input.getMouseMoveCoalescing());
+	render->drawOneFrame();
+	input.resetStatistics();
+	UNITTEST_CHECK(!input.injectMouseMove(110, 110, 0));
+	UNITTEST_CHECK(!input.injectMouseMove(310, 110, 0));
+	UNITTEST_CHECK(!input.injectMouseMove(320, 120, 0));
+	UNITTEST_CHECK(input.getMouseFocusWidget() == nullptr);
+	UNITTEST_CHECK(input.getMousePosition() == MyGUI::IntPoint(320, 120));
+	UNITTEST_CHECK(log.get().empty());
+	UNITTEST_CHECK(myGui->getNextFrameDelay() == 0.0f);
+	UNITTEST_CHECK(checkStatistics(3, 0, 0));
+
+	// last position is processed once at beginning of frame
+	render->drawOneFrame();
+	UNITTEST_CHECK(input.getMouseFocusWidget() == right);
+	UNITTEST_CHECK(log.get() == "right.move(320,120) right.focus");
+	UNITTEST_CHECK(checkStatistics(0, 1, 1));
+	UNITTEST_CHECK(myGui->getNextFrameDelay() < 0.0f);
+
+	// result of the last processed event is returned
+	UNITTEST_CHECK(input.injectMouseMove(330, 120, 0));
+	input.flushMouseMove();
+	UNITTEST_CHECK(log.get() == "right.move(330,120)");
+	UNITTEST_CHECK(checkStatistics(1, 1, 1));
+
+	// nothing to flush
+	input.flushMouseMove();
+	render->drawOneFrame();
+	UNITTEST_CHECK(checkStatistics(0, 0, 0));
+
+	// press replaces stored move
+	input.injectMouseMove(250, 110, 0);
+	input.injectMouseMove(150, 150, 0);
+	UNITTEST_CHECK(input.injectMousePress(160, 150, MyGUI::MouseButton::Left));
+	UNITTEST_CHECK(log.get() == "left.move(160,150) left.focus left.press");
+	UNITTEST_CHECK(checkStatistics(3, 1, 1));
+	render->drawOneFrame();
+	UNITTEST_CHECK(checkStatistics(0, 0, 0));
+
+	// stored drag is delivered before release, captured drag is not picked
+	UNITTEST_CHECK(input.injectMouseMove(170, 150, 0));
+	UNITTEST_CHECK(input.injectMouseMove(180, 150, 0));
+	UNITTEST_CHECK(log.get().empty());
+	UNITTEST_CHECK(input.injectMouseRelease(180, 150, MyGUI::MouseButton::Left));
+	UNITTEST_CHECK(log.get() == "left.drag(180,150) left.release left.move(180,150)");
+	UNITTEST_CHECK(checkStatistics(3, 2, 1));
+
+	// wheel is never coalesced, stored move goes first, wheel itself is not picked
+	input.injectMouseMove(190, 150, 0);
+	UNITTEST_CHECK(input.injectMouseMove(190, 160, 120));
+	UNITTEST_CHECK(log.get() == "left.move(190,150) left.wheel");
+	UNITTEST_CHECK(checkStatistics(2, 2, 1));
+
+	// key goes after stored move
+	input.setKeyFocusWidget(left);
+	input.injectMouseMove(195, 160, 120);
+	UNITTEST_CHECK(log.get().empty());
+	input.injectKeyPress(MyGUI::KeyCode::A, 'a');
+	input.injectKeyRelease(MyGUI::KeyCode::A);
+	UNITTEST_CHECK(log.get() == "left.move(195,160) left.key");
+	UNITTEST_CHECK(checkStatistics(3, 3, 1));
+
+	// disabling processes stored move
+	input.injectMouseMove(310, 160, 120);
+	input.setMouseMoveCoalescing(false);
+	UNITTEST_CHECK(!input.getMouseMoveCoalescing());
+	UNITTEST_CHECK(input.getMouseFocusWidget() == right);
+	UNITTEST_CHECK(log.get() == "right.move(310,160) right.focus");
+	UNITTEST_CHECK(checkStatistics(1, 1, 1));
+
+	return unittest::getResult("UnitTest_MouseCoalescing");
+}
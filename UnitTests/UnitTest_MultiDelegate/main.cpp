@@ -0,0 +1,166 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_Delegate.h"
+#include "MyGUI_Exception.h"
+#include "MyGUI_LogManager.h"
+
+namespace
+{
+
+	typedef MyGUI::delegates::CMultiDelegate1<int> EventHandle_Int;
+
+	EventHandle_Int gEvent;
+	int gStaticSum = 0;
+
+	void notifyStatic(int _value)
+	{
+		gStaticSum += _value;
+	}
+
+	class Listener :
+		public MyGUI::delegates::IDelegateUnlink
+	{
+	public:
+		Listener() :
+			mSum(0),
+			mSelfRemoveSum(0),
+			mAddSum(0)
+		{
+		}
+
+		void notifyAdd(int _value)
+		{
+			mSum += _value;
+		}
+
+		// removes itself during dispatch
+		void notifySelfRemove(int _value)
+		{
+			mSelfRemoveSum += _value;
+			gEvent -= MyGUI::newDelegate(this, &Listener::notifySelfRemove);
+		}
+
+		// subscribes one more delegate during dispatch
+		void notifySubscribe(int _value)
+		{
+			gEvent -= MyGUI::newDelegate(this, &Listener::notifySubscribe);
+			gEvent += MyGUI::newDelegate(this, &Listener::notifyAdded);
+		}
+
+		void notifyAdded(int _value)
+		{
+			mAddSum += _value;
+		}
+
+		int mSum;
+		int mSelfRemoveSum;
+		int mAddSum;
+	};
+
+	bool addTwice(Listener& _listener)
+	{
+		try
+		{
+			gEvent += MyGUI::newDelegate(&_listener, &Listener::notifyAdd);
+		}
+		catch (MyGUI::Exception&)
+		{
+			return true;
+		}
+		return false;
+	}
+
+} // namespace
+
+int main()
+{
+	// duplicate add reports through MYGUI_EXCEPT, log goes nowhere
+	MyGUI::LogManager* logManager = new MyGUI::LogManager();
+
+	Listener first;
+	Listener second;
+	{
+		UNITTEST_CHECK(gEvent.empty());
+		gEvent += MyGUI::newDelegate(&first, &Listener::notifyAdd);
+		gEvent += MyGUI::newDelegate(&first, &Listener::notifySelfRemove);
+		gEvent += MyGUI::newDelegate(&second, &Listener::notifyAdd);
+		gEvent += MyGUI::newDelegate(notifyStatic);
+		UNITTEST_CHECK(!gEvent.empty());
+
+		// same object and method is rejected, other method of same object is accepted above
+		UNITTEST_CHECK(addTwice(first));
+
+		gEvent(1);
+		gEvent(2);
+		UNITTEST_CHECK(first.mSum == 3);
+		UNITTEST_CHECK(first.mSelfRemoveSum == 1);
+		UNITTEST_CHECK(second.mSum == 3);
+		UNITTEST_CHECK(gStaticSum == 3);
+
+		gEvent -= MyGUI::newDelegate(notifyStatic);
+		gEvent(4);
+		UNITTEST_CHECK(first.mSum == 7);
+		UNITTEST_CHECK(second.mSum == 7);
+		UNITTEST_CHECK(gStaticSum == 3);
+
+		// removing delegate that is not subscribed changes nothing
+		gEvent -= MyGUI::newDelegate(&second, &Listener::notifySelfRemove);
+		gEvent(1);
+		UNITTEST_CHECK(first.mSum == 8);
+		UNITTEST_CHECK(second.mSum == 8);
+	}
+
+	{
+		// remove without allocation finds the same delegates as -= newDelegate
+		gEvent += MyGUI::newDelegate(notifyStatic);
+		gEvent.remove(&second, &Listener::notifySelfRemove);
+		gEvent.remove(notifyStatic);
+		gEvent.remove(&first, &Listener::notifyAdd);
+		gEvent.remove(&second, &Listener::notifyAdd);
+		gEvent(1);
+		UNITTEST_CHECK(first.mSum == 8);
+		UNITTEST_CHECK(second.mSum == 8);
+		UNITTEST_CHECK(gStaticSum == 3);
+		UNITTEST_CHECK(gEvent.empty());
+
+		// removed entries can be subscribed again
+		gEvent += MyGUI::newDelegate(&first, &Listener::notifyAdd);
+		gEvent += MyGUI::newDelegate(&second, &Listener::notifyAdd);
+	}
+
+	{
+		// delegate added during dispatch is called in the same dispatch
+		gEvent += MyGUI::newDelegate(&second, &Listener::notifySubscribe);
+		gEvent(5);
+		UNITTEST_CHECK(second.mAddSum == 5);
+		gEvent(1);
+		UNITTEST_CHECK(second.mAddSum == 6);
+	}
+
+	{
+		// clear by unlink removes all delegates of one object
+		gEvent.clear(&second);
+		gEvent(1);
+		UNITTEST_CHECK(first.mSum == 15);
+		UNITTEST_CHECK(second.mSum == 14);
+		UNITTEST_CHECK(second.mAddSum == 6);
+		UNITTEST_CHECK(!gEvent.empty());
+
+		// removed entries can be subscribed again
+		gEvent += MyGUI::newDelegate(&second, &Listener::notifyAdd);
+		gEvent(1);
+		UNITTEST_CHECK(second.mSum == 15);
+
+		gEvent.clear();
+		UNITTEST_CHECK(gEvent.empty());
+		gEvent(1);
+		UNITTEST_CHECK(first.mSum == 16);
+		UNITTEST_CHECK(second.mSum == 15);
+	}
+
+	delete logManager;
+	return unittest::getResult("UnitTest_MultiDelegate");
+}
@@ -0,0 +1,76 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include "MyGUI_TextureAtlasBaker.h"
+
+namespace
+{
+
+	const size_t SkinCount = 4;
+
+	std::string getSkinName(size_t _index)
+	{
+		return "Box" + MyGUI::utility::toString(_index);
+	}
+
+	// each skin has its own texture
+	void loadSkins(unittest::HeadlessGui& _gui)
+	{
+		for (size_t index = 0; index < SkinCount; ++index)
+			_gui.loadBoxSkin(getSkinName(index));
+	}
+
+	// window of first skin with children of other skins, one top level widget is one layer node
+	MyGUI::Widget* createScene(unittest::HeadlessGui& _gui)
+	{
+		MyGUI::Widget* window = _gui.getGui()->createWidget<MyGUI::Widget>(getSkinName(0), MyGUI::IntCoord(10, 10, 600, 100), MyGUI::Align::Default, "Main");
+		for (size_t index = 0; index < (SkinCount - 1) * 2; ++index)
+			window->createWidget<MyGUI::Widget>(getSkinName(index % (SkinCount - 1) + 1), MyGUI::IntCoord((int)index * 60 + 10, 10, 50, 50), MyGUI::Align::Default);
+		return window;
+	}
+
+	MyGUI::ResourceSkin* getSkin(size_t _index)
+	{
+		return MyGUI::ResourceManager::getInstance().getByName(getSkinName(_index))->castType<MyGUI::ResourceSkin>();
+	}
+
+	void testBatchCount()
+	{
+		unittest::HeadlessGui gui(800, 600);
+		loadSkins(gui);
+		MyGUI::DummyRenderManager* render = gui.getRenderManager();
+
+		// neighbour children have different textures, so every widget is a separate batch
+		MyGUI::Widget* window = createScene(gui);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 1 + (SkinCount - 1) * 2);
+		MyGUI::WidgetManager::getInstance().destroyWidget(window);
+
+		MyGUI::TextureAtlasBaker baker;
+		baker.addAllResources();
+		UNITTEST_CHECK(baker.bake());
+		UNITTEST_CHECK(baker.getStatistics().textures == SkinCount);
+		UNITTEST_CHECK(baker.getStatistics().bakedTextures == SkinCount);
+		UNITTEST_CHECK(baker.getStatistics().pages == 1);
+		UNITTEST_CHECK(baker.getStatistics().skins == SkinCount);
+		for (size_t index = 1; index < SkinCount; ++index)
+			UNITTEST_CHECK(getSkin(index)->getTextureName() == getSkin(0)->getTextureName());
+		UNITTEST_CHECK(getSkin(0)->getTextureName() != getSkinName(0) + ".png");
+
+		// widgets created after bake share the page
+		window = createScene(gui);
+		render->drawOneFrame();
+		UNITTEST_CHECK(render->getBatchCount() == 1);
+		MyGUI::WidgetManager::getInstance().destroyWidget(window);
+	}
+
+} // namespace
+
+int main()
+{
+	testBatchCount();
+	return unittest::getResult("UnitTest_TextureAtlasBaker");
+}
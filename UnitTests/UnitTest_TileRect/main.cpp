@@ -0,0 +1,248 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "HeadlessGui.h"
+#include "MyGUI_VertexUtility.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+namespace
+{
+
+	const int TextureSize = 256;
+
+	/** One tile quad in absolute pixels. */
+	struct TileQuad
+	{
+		MyGUI::FloatRect vertex;
+		MyGUI::FloatRect texture;
+
+		bool operator < (const TileQuad& _other) const
+		{
+			if (vertex.top != _other.vertex.top)
+				return vertex.top < _other.vertex.top;
+			return vertex.left < _other.vertex.left;
+		}
+	};
+
+	typedef std::vector<TileQuad> VectorTileQuad;
+
+	/** Keeps verticies of the last frame. */
+	class CaptureRenderManager :
+		public MyGUI::DummyRenderManager
+	{
+	public:
+		virtual void doRender(MyGUI::IVertexBuffer* _buffer, MyGUI::ITexture* _texture, size_t _count)
+		{
+			MyGUI::DummyRenderManager::doRender(_buffer, _texture, _count);
+
+			const MyGUI::Vertex* vertex = _buffer->lock();
+			mVertex.insert(mVertex.end(), vertex, vertex + _count);
+			_buffer->unlock();
+		}
+
+		// convert render target coordinates back to pixels
+		VectorTileQuad getQuads()
+		{
+			MyGUI::vertex_utility::QuadTransform transform(getInfo(), 0, 0);
+
+			VectorTileQuad result;
+			for (size_t index = 0; index + MyGUI::VertexQuad::VertexCount <= mVertex.size(); index += MyGUI::VertexQuad::VertexCount)
+			{
+				const MyGUI::Vertex* quad = &mVertex[index];
+				const MyGUI::Vertex& leftTop = quad[MyGUI::VertexQuad::CornerLT];
+				const MyGUI::Vertex& rightBottom = quad[MyGUI::VertexQuad::CornerRB];
+
+				TileQuad tile;
+				tile.vertex.set(
+					(leftTop.x - transform.offsetX) / transform.scaleX,
+					(leftTop.y - transform.offsetY) / transform.scaleY,
+					(rightBottom.x - transform.offsetX) / transform.scaleX,
+					(rightBottom.y - transform.offsetY) / transform.scaleY);
+				tile.texture.set(leftTop.u, leftTop.v, rightBottom.u, rightBottom.v);
+				result.push_back(tile);
+
+				// other corners are combinations of these two
+				const MyGUI::Vertex& rightTop = quad[MyGUI::VertexQuad::CornerRT];
+				const MyGUI::Vertex& leftBottom = quad[MyGUI::VertexQuad::CornerLB];
+				UNITTEST_CHECK(rightTop.x == rightBottom.x && rightTop.y == leftTop.y && rightTop.u == rightBottom.u && rightTop.v == leftTop.v);
+				UNITTEST_CHECK(leftBottom.x == leftTop.x && leftBottom.y == rightBottom.y && leftBottom.u == leftTop.u && leftBottom.v == rightBottom.v);
+			}
+			return result;
+		}
+
+		void clearVertex()
+		{
+			mVertex.clear();
+		}
+
+	private:
+		std::vector<MyGUI::Vertex> mVertex;
+	};
+
+	struct TileSkin
+	{
+		std::string name;
+		MyGUI::IntCoord offset;
+		MyGUI::IntSize tileSize;
+		bool tileH;
+		bool tileV;
+	};
+
+	// every tile is cropped by the view separately, texture coordinates follow the cropped part
+	void addAxisTiles(std::vector<MyGUI::FloatRect>& _result, int _start, int _size, int _tile, int _viewStart, int _viewEnd, float _texture0, float _texture1)
+	{
+		for (int tile = _start; tile < _start + _size; tile += _tile)
+		{
+			int start = std::max(tile, _viewStart);
+			int end = std::min(tile + _tile, _viewEnd);
+			if (start >= end)
+				continue;
+
+			float scale = (_texture1 - _texture0) / (float)_tile;
+			_result.push_back(MyGUI::FloatRect((float)start, _texture0 + (float)(start - tile) * scale, (float)end, _texture1 - (float)(tile + _tile - end) * scale));
+		}
+	}
+
+	VectorTileQuad getReference(const MyGUI::IntRect& _widget, const MyGUI::IntRect& _view, const TileSkin& _skin)
+	{
+		VectorTileQuad result;
+		MyGUI::IntRect view(
+			std::max(_widget.left, _view.left),
+			std::max(_widget.top, _view.top),
+			std::min(_widget.right, _view.right),
+			std::min(_widget.bottom, _view.bottom));
+		if (view.left >= view.right || view.top >= view.bottom)
+			return result;
+
+		float textureLeft = (float)_skin.offset.left / (float)TextureSize;
+		float textureTop = (float)_skin.offset.top / (float)TextureSize;
+		float textureRight = (float)_skin.offset.right() / (float)TextureSize;
+		float textureBottom = (float)_skin.offset.bottom() / (float)TextureSize;
+
+		// axis without tiling has one tile of the widget size
+		int tileWidth = _skin.tileH ? _skin.tileSize.width : _widget.width();
+		int tileHeight = _skin.tileV ? _skin.tileSize.height : _widget.height();
+
+		// x and texture u are in left and top, end and texture u in right and bottom
+		std::vector<MyGUI::FloatRect> columns;
+		std::vector<MyGUI::FloatRect> rows;
+		addAxisTiles(columns, _widget.left, _widget.width(), tileWidth, view.left, view.right, textureLeft, textureRight);
+		addAxisTiles(rows, _widget.top, _widget.height(), tileHeight, view.top, view.bottom, textureTop, textureBottom);
+
+		for (size_t row = 0; row < rows.size(); ++row)
+		{
+			for (size_t column = 0; column < columns.size(); ++column)
+			{
+				TileQuad quad;
+				quad.vertex.set(columns[column].left, rows[row].left, columns[column].right, rows[row].right);
+				quad.texture.set(columns[column].top, rows[row].top, columns[column].bottom, rows[row].bottom);
+				result.push_back(quad);
+			}
+		}
+		return result;
+	}
+
+	bool isNear(float _left, float _right, float _tolerance)
+	{
+		return std::fabs(_left - _right) <= _tolerance;
+	}
+
+	bool isEqual(const TileQuad& _left, const TileQuad& _right)
+	{
+		const float vertexTolerance = 0.01f;
+		const float textureTolerance = 1e-5f;
+		return isNear(_left.vertex.left, _right.vertex.left, vertexTolerance) &&
+			isNear(_left.vertex.top, _right.vertex.top, vertexTolerance) &&
+			isNear(_left.vertex.right, _right.vertex.right, vertexTolerance) &&
+			isNear(_left.vertex.bottom, _right.vertex.bottom, vertexTolerance) &&
+			isNear(_left.texture.left, _right.texture.left, textureTolerance) &&
+			isNear(_left.texture.top, _right.texture.top, textureTolerance) &&
+			isNear(_left.texture.right, _right.texture.right, textureTolerance) &&
+			isNear(_left.texture.bottom, _right.texture.bottom, textureTolerance);
+	}
+
+	// returns false on the first difference, so one broken layout doesn't flood the output
+	bool checkLayout(unittest::HeadlessGui& _gui, CaptureRenderManager* _renderManager, MyGUI::Widget* _parent, MyGUI::Widget* _widget, const TileSkin& _skin, const MyGUI::IntCoord& _coord)
+	{
+		_widget->setCoord(_coord);
+		_renderManager->clearVertex();
+		_renderManager->drawOneFrame();
+
+		VectorTileQuad quads = _renderManager->getQuads();
+		VectorTileQuad expected = getReference(_widget->getAbsoluteRect(), _parent->getAbsoluteRect(), _skin);
+		std::sort(quads.begin(), quads.end());
+		std::sort(expected.begin(), expected.end());
+
+		bool equal = quads.size() == expected.size();
+		for (size_t index = 0; equal && index < quads.size(); ++index)
+			equal = isEqual(quads[index], expected[index]);
+
+		if (!equal)
+		{
+			std::cout << "skin " << _skin.name << ", coord " << _coord.print() << ": " << quads.size() << " quads, expected " << expected.size() << std::endl;
+			UNITTEST_CHECK(equal);
+		}
+		return equal;
+	}
+
+} // namespace
+
+int main()
+{
+	CaptureRenderManager* renderManager = new CaptureRenderManager();
+	unittest::HeadlessGui gui(1024, 768, renderManager);
+	MyGUI::RenderManager::getInstance().createTexture("Tiles.png")->createManual(TextureSize, TextureSize, MyGUI::TextureUsage::Static | MyGUI::TextureUsage::Write, MyGUI::PixelFormat::R8G8B8A8);
+
+	std::vector<TileSkin> skins;
+	const int tileSizes[][4] = { { 1, 1, 1, 1 }, { 8, 8, 1, 1 }, { 7, 13, 1, 1 }, { 32, 5, 1, 1 }, { 40, 40, 1, 1 }, { 10, 6, 1, 0 }, { 6, 10, 0, 1 }, { 17, 23, 0, 0 } };
+	std::ostringstream xml;
+	xml << "<MyGUI type=\"Resource\" version=\"1.1\"><Resource type=\"ResourceSkin\" name=\"Empty\" size=\"1 1\"/>";
+	for (size_t index = 0; index < sizeof(tileSizes) / sizeof(tileSizes[0]); ++index)
+	{
+		TileSkin skin;
+		skin.name = MyGUI::utility::toString("Tiles", index);
+		skin.tileSize.set(tileSizes[index][0], tileSizes[index][1]);
+		skin.offset.set((int)index * 3, (int)index * 5, skin.tileSize.width, skin.tileSize.height);
+		skin.tileH = tileSizes[index][2] != 0;
+		skin.tileV = tileSizes[index][3] != 0;
+		skins.push_back(skin);
+
+		xml << "<Resource type=\"ResourceSkin\" name=\"" << skin.name << "\" size=\"" << skin.tileSize.print() << "\" texture=\"Tiles.png\">"
+			<< "<BasisSkin type=\"TileRect\" offset=\"0 0 " << skin.tileSize.print() << "\" align=\"Stretch\">"
+			<< "<State name=\"normal\" offset=\"" << skin.offset.print() << "\">"
+			<< "<Property key=\"TileSize\" value=\"" << skin.tileSize.print() << "\"/>"
+			<< "<Property key=\"TileH\" value=\"" << (skin.tileH ? "true" : "false") << "\"/>"
+			<< "<Property key=\"TileV\" value=\"" << (skin.tileV ? "true" : "false") << "\"/>"
+			<< "</State></BasisSkin></Resource>";
+	}
+	xml << "</MyGUI>";
+	gui.loadResources(xml.str());
+
+	// widget moves around the cropping parent, partially and fully outside of it
+	srand(1);
+	MyGUI::Widget* parent = gui.getGui()->createWidget<MyGUI::Widget>("Empty", MyGUI::IntCoord(100, 50, 300, 200), MyGUI::Align::Default, "Main");
+	for (size_t index = 0; index < skins.size(); ++index)
+	{
+		MyGUI::Widget* widget = parent->createWidget<MyGUI::Widget>(skins[index].name, MyGUI::IntCoord(0, 0, 1, 1), MyGUI::Align::Default);
+
+		checkLayout(gui, renderManager, parent, widget, skins[index], MyGUI::IntCoord(0, 0, 300, 200));
+		checkLayout(gui, renderManager, parent, widget, skins[index], MyGUI::IntCoord(-50, -70, 400, 350));
+		checkLayout(gui, renderManager, parent, widget, skins[index], MyGUI::IntCoord(400, 0, 10, 10));
+
+		for (size_t layout = 0; layout < 300; ++layout)
+		{
+			MyGUI::IntCoord coord(rand() % 500 - 150, rand() % 400 - 150, rand() % 400 + 1, rand() % 300 + 1);
+			if (!checkLayout(gui, renderManager, parent, widget, skins[index], coord))
+				break;
+		}
+
+		MyGUI::WidgetManager::getInstance().destroyWidget(widget);
+	}
+
+	return unittest::getResult("UnitTest_TileRect");
+}
@@ -0,0 +1,126 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_UString.h"
+
+namespace
+{
+
+	// four cyrillic letters followed by ": 12"
+	const char* Cyrillic = "\xD0\x9E\xD1\x87\xD0\xBA\xD0\xB8: 12";
+
+	// conversion without any cached UTF-8 form
+	std::string convert(const MyGUI::UString& _value)
+	{
+		MyGUI::UString copy;
+		copy.append(_value.data(), _value.size());
+		return copy.asUTF8();
+	}
+
+	bool checkUTF8(const MyGUI::UString& _value, const std::string& _expected)
+	{
+		return _value.asUTF8() == _expected && convert(_value) == _expected && std::string(_value.asUTF8_c_str()) == _expected;
+	}
+
+	void testAssign()
+	{
+		MyGUI::UString text(Cyrillic);
+		UNITTEST_CHECK(text.size() == 8);
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+
+		text.assign(std::string("ascii"));
+		UNITTEST_CHECK(checkUTF8(text, "ascii"));
+
+		text = MyGUI::UString(std::string(Cyrillic));
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+
+		// source may be the cached form itself
+		text.assign(text.asUTF8());
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+		text.assign(text.asUTF8_c_str());
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+	}
+
+	void testModify()
+	{
+		MyGUI::UString text(Cyrillic);
+		text.asUTF8();
+		text.append(std::string("3"));
+		UNITTEST_CHECK(checkUTF8(text, std::string(Cyrillic) + "3"));
+
+		text.erase(0, 1);
+		UNITTEST_CHECK(checkUTF8(text, std::string(Cyrillic + 2) + "3"));
+
+		text.insert(0, 1, (MyGUI::UString::code_point)'-');
+		UNITTEST_CHECK(checkUTF8(text, std::string("-") + (Cyrillic + 2) + "3"));
+
+		text.replace(0, 1, MyGUI::UString("+"));
+		UNITTEST_CHECK(checkUTF8(text, std::string("+") + (Cyrillic + 2) + "3"));
+
+		text.push_back((MyGUI::UString::code_point)'!');
+		UNITTEST_CHECK(checkUTF8(text, std::string("+") + (Cyrillic + 2) + "3!"));
+
+		text.setChar(0, (MyGUI::UString::unicode_char)'#');
+		UNITTEST_CHECK(checkUTF8(text, std::string("#") + (Cyrillic + 2) + "3!"));
+
+		text.resize(1);
+		UNITTEST_CHECK(checkUTF8(text, "#"));
+
+		text.clear();
+		UNITTEST_CHECK(checkUTF8(text, ""));
+	}
+
+	void testExposed()
+	{
+		// references and iterators handed out before the conversion write into the data later
+		MyGUI::UString text(Cyrillic);
+		MyGUI::UString::code_point& first = text[0];
+		MyGUI::UString::iterator last = text.end() - 1;
+		text.asUTF8();
+		first = 'A';
+		UNITTEST_CHECK(checkUTF8(text, std::string("A") + (Cyrillic + 2)));
+		*last = 'B';
+		UNITTEST_CHECK(checkUTF8(text, std::string("A") + std::string(Cyrillic + 2, 9) + "B"));
+
+		// whole data replaced, caching works again
+		text.assign(Cyrillic);
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+	}
+
+	void testCopy()
+	{
+		MyGUI::UString text(Cyrillic);
+		MyGUI::UString copy(text);
+		UNITTEST_CHECK(checkUTF8(copy, Cyrillic));
+
+		copy.append(std::string("3"));
+		UNITTEST_CHECK(checkUTF8(copy, std::string(Cyrillic) + "3"));
+		UNITTEST_CHECK(checkUTF8(text, Cyrillic));
+
+		copy = text;
+		UNITTEST_CHECK(checkUTF8(copy, Cyrillic));
+
+		MyGUI::UString other("other");
+		other.swap(text);
+		UNITTEST_CHECK(checkUTF8(text, "other"));
+		UNITTEST_CHECK(checkUTF8(other, Cyrillic));
+
+		// other conversions share the scratch buffer
+		other.asWStr();
+		UNITTEST_CHECK(checkUTF8(other, Cyrillic));
+		other.asUTF32();
+		UNITTEST_CHECK(checkUTF8(other, Cyrillic));
+	}
+
+} // namespace
+
+int main()
+{
+	testAssign();
+	testModify();
+	testExposed();
+	testCopy();
+	return unittest::getResult("UnitTest_UString");
+}
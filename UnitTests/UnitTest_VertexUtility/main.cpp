@@ -0,0 +1,116 @@
+/*!
+	@file
+	@date		10/2026
+*/
+#include "ConsoleTest.h"
+#include "MyGUI_VertexUtility.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+	using MyGUI::vertex_utility::QuadInfo;
+	using MyGUI::vertex_utility::QuadTransform;
+
+	typedef std::vector<QuadInfo> VectorQuadInfo;
+	typedef std::vector<MyGUI::VertexQuad> VectorVertexQuad;
+
+	float randomFloat(float _range)
+	{
+		return (float)(rand() % 10000) / 10000.0f * _range;
+	}
+
+	// colours include NaN patterns, they must be copied as bits
+	VectorQuadInfo createQuads(size_t _count)
+	{
+		VectorQuadInfo result(_count);
+		for (size_t index = 0; index < _count; ++index)
+		{
+			QuadInfo& quad = result[index];
+			float left = randomFloat(1000.0f) - 100.0f;
+			float top = randomFloat(1000.0f) - 100.0f;
+			quad.vertex.set(left, top, left + randomFloat(200.0f), top + randomFloat(200.0f));
+			quad.texture.set(randomFloat(1.0f), randomFloat(1.0f), randomFloat(1.0f), randomFloat(1.0f));
+			if (index % 3 == 0)
+				quad.colour = 0x7F800001 + (MyGUI::uint32)index;
+			else if (index % 3 == 1)
+				quad.colour = 0xFF800001 + (MyGUI::uint32)index;
+			else
+				quad.colour = (MyGUI::uint32)rand() * 65599 + (MyGUI::uint32)rand();
+		}
+		return result;
+	}
+
+	void writeReference(VectorVertexQuad& _dest, const VectorQuadInfo& _quads, float _z, const QuadTransform& _transform)
+	{
+		for (size_t index = 0; index < _quads.size(); ++index)
+		{
+			const QuadInfo& quad = _quads[index];
+			_dest[index].set(
+				quad.vertex.left * _transform.scaleX + _transform.offsetX,
+				quad.vertex.top * _transform.scaleY + _transform.offsetY,
+				quad.vertex.right * _transform.scaleX + _transform.offsetX,
+				quad.vertex.bottom * _transform.scaleY + _transform.offsetY,
+				_z,
+				quad.texture.left,
+				quad.texture.top,
+				quad.texture.right,
+				quad.texture.bottom,
+				quad.colour);
+		}
+	}
+
+	bool isEqual(const VectorVertexQuad& _left, const VectorVertexQuad& _right)
+	{
+		return _left.size() == _right.size() &&
+			(_left.empty() || memcmp(&_left[0], &_right[0], _left.size() * sizeof(MyGUI::VertexQuad)) == 0);
+	}
+
+	void checkQuads(size_t _count, const QuadTransform& _transform)
+	{
+		VectorQuadInfo quads = createQuads(_count);
+		const float depth = 0.5f;
+
+		// one more quad after the end must stay untouched
+		VectorVertexQuad expected(_count + 1);
+		memset(&expected[0], 0xCD, expected.size() * sizeof(MyGUI::VertexQuad));
+		VectorVertexQuad written(expected);
+		VectorVertexQuad batched(expected);
+
+		writeReference(expected, quads, depth, _transform);
+		MyGUI::vertex_utility::writeQuads(written[0].vertex, quads.empty() ? nullptr : &quads[0], quads.size(), depth, _transform);
+		UNITTEST_CHECK(isEqual(written, expected));
+
+		MyGUI::vertex_utility::QuadWriter writer(batched[0].vertex, depth, _transform);
+		for (size_t index = 0; index < quads.size(); ++index)
+			writer.add(quads[index].vertex, quads[index].texture, quads[index].colour);
+		writer.flush();
+		UNITTEST_CHECK(writer.getVertexCount() == _count * MyGUI::VertexQuad::VertexCount);
+		UNITTEST_CHECK(isEqual(batched, expected));
+	}
+
+} // namespace
+
+int main()
+{
+	srand(1);
+
+	MyGUI::RenderTargetInfo info;
+	info.pixScaleX = 1.0f / 800.0f;
+	info.pixScaleY = 1.0f / 600.0f;
+	info.hOffset = 0.001f;
+	info.vOffset = -0.002f;
+	QuadTransform transform(info, 10.0f, 20.0f);
+	QuadTransform identity;
+
+	// counts around QuadWriter batch size
+	const size_t counts[] = { 0, 1, 3, 63, 64, 65, 130, 1000 };
+	for (size_t index = 0; index < sizeof(counts) / sizeof(counts[0]); ++index)
+	{
+		checkQuads(counts[index], transform);
+		checkQuads(counts[index], identity);
+	}
+
+	return unittest::getResult("UnitTest_VertexUtility");
+}